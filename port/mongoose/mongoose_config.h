@@ -8,6 +8,9 @@
 #define MG_ENABLE_DRIVER_W 1
 #define MG_IO_SIZE 2048
 
+// Allocations come from the fixed size pools in src/mem_pool.cpp
+#define MG_ENABLE_CUSTOM_CALLOC 1
+
 
 // Using a custom function:
 extern void wifi_setconfig(void *data);
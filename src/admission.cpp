@@ -0,0 +1,177 @@
+/*
+ * admission.cpp
+ *
+ * Connection admission control and per-IP rate limiting for the HTTP listener
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#include "admission.h"
+
+// Canned rejections, sent without any formatting
+static const char k_reply_503[] = "HTTP/1.1 503 Service Unavailable\r\nRetry-After: 2\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+static const char k_reply_429[] = "HTTP/1.1 429 Too Many Requests\r\nRetry-After: 1\r\nContent-Length: 0\r\n\r\n";
+static const char k_reply_429_flash[] = "HTTP/1.1 429 Too Many Requests\r\nRetry-After: 10\r\nContent-Length: 0\r\n\r\n";
+
+static const uint8_t k_class_limit[CONN_CLASSES] = {MAX_CONN_STATIC, MAX_CONN_API, MAX_CONN_STREAM};
+
+// Token buckets per source address
+// Credit is in milliseconds, refilled one for one as time passes, and each request spends one token's worth
+struct s_bucket {
+	uint32_t ip;
+	uint32_t last_ms;
+	uint32_t req_credit;
+	uint32_t flash_credit;
+};
+static s_bucket s_buckets[RATE_LIMIT_IPS];
+
+// Rejection counters
+static struct {
+	uint32_t accept; // Over MAX_CONNECTIONS
+	uint32_t busy[CONN_CLASSES]; // Over the class limit
+	uint32_t rate; // Request bucket empty
+	uint32_t flash; // Flash write bucket empty
+} s_rejected;
+
+/***
+ * Send a canned reply and finish the response
+ */
+static void reject(struct mg_connection *c, const char *reply, size_t len) {
+	mg_send(c, reply, len);
+	c->is_resp = 0;
+}
+
+/***
+ * Class of an HTTP request from its URI
+ */
+static conn_class classify(struct mg_http_message *hm) {
+	if (mg_match(hm->uri, mg_str("/websocket"), NULL) || mg_match(hm->uri, mg_str("/events"), NULL) ||
+			mg_match(hm->uri, mg_str("/logs"), NULL))
+		return CONN_STREAM;
+	if (mg_match(hm->uri, mg_str("/api#"), NULL))
+		return CONN_API;
+	return CONN_STATIC;
+}
+
+/***
+ * Find the bucket for a connection's source address and top it up
+ * An unknown address takes over the least recently seen bucket, starting full
+ */
+static s_bucket *bucket_for(struct mg_connection *c) {
+	uint32_t ip, now = (uint32_t) mg_millis();
+	memcpy(&ip, c->rem.ip, sizeof(ip));
+	s_bucket *b = &s_buckets[0];
+	for (s_bucket *p = s_buckets; p < s_buckets + RATE_LIMIT_IPS; p++) {
+		if (p->ip == ip) {
+			b = p;
+			break;
+		}
+		if (now - p->last_ms > now - b->last_ms)
+			b = p;
+	}
+	if (b->ip != ip) {
+		b->ip = ip;
+		b->req_credit = RATE_REQ_MS * RATE_REQ_BURST;
+		b->flash_credit = RATE_FLASH_MS * RATE_FLASH_BURST;
+	} else {
+		uint32_t elapsed = now - b->last_ms;
+		b->req_credit = MG_MIN(b->req_credit + elapsed, (uint32_t) RATE_REQ_MS * RATE_REQ_BURST);
+		b->flash_credit = MG_MIN(b->flash_credit + elapsed, (uint32_t) RATE_FLASH_MS * RATE_FLASH_BURST);
+	}
+	b->last_ms = now;
+	return b;
+}
+
+/***
+ * Check a newly accepted connection against the overall cap
+ * Over the cap a 503 is queued and the connection drains and closes
+ * @param c connection from MG_EV_ACCEPT
+ * @return true if admitted
+ */
+bool admission_accept(struct mg_connection *c) {
+	int n = 0;
+	for (struct mg_connection *t = c->mgr->conns; t != NULL; t = t->next)
+		if (t->is_accepted) n++;
+	if (n <= MAX_CONNECTIONS)
+		return true;
+	s_rejected.accept++;
+	reject(c, k_reply_503, sizeof(k_reply_503) - 1);
+	c->is_draining = 1;
+	return false;
+}
+
+/***
+ * Check an HTTP request against its class limit and the source address request budget
+ * On rejection a 503 or 429 has already been queued
+ * @param c connection
+ * @param hm HTTP request
+ * @return true if the request should be handled
+ */
+bool admission_request(struct mg_connection *c, struct mg_http_message *hm) {
+	conn_class cls = classify(hm);
+	c->data[1] = cls + 1; // Class is kept in c->data[1], 0 if not classified yet
+
+	int busy = 0;
+	for (struct mg_connection *t = c->mgr->conns; t != NULL; t = t->next) {
+		if (t == c || !t->is_accepted || t->data[1] != cls + 1) continue;
+		// A parked long-poll ('L') only waits for a status change, so it does not hold back control requests
+		if (t->data[0] == 'L') continue;
+		// Pushed streams are always busy, others only while a response is in progress
+		if (cls == CONN_STREAM || t->is_resp) busy++;
+	}
+	if (busy >= k_class_limit[cls]) {
+		s_rejected.busy[cls]++;
+		reject(c, k_reply_503, sizeof(k_reply_503) - 1);
+		c->is_draining = 1;
+		return false;
+	}
+
+	s_bucket *b = bucket_for(c);
+	if (b->req_credit < RATE_REQ_MS) {
+		s_rejected.rate++;
+		reject(c, k_reply_429, sizeof(k_reply_429) - 1);
+		return false;
+	}
+	b->req_credit -= RATE_REQ_MS;
+	return true;
+}
+
+/***
+ * Check an action that commits to flash against the stricter flash budget of its source address
+ * Nothing is taken until admission_flash_spend(), so a request that fails validation costs nothing
+ * On rejection a 429 has already been queued
+ * @param c connection
+ * @return true if the write may go ahead
+ */
+bool admission_flash_allowed(struct mg_connection *c) {
+	s_bucket *b = bucket_for(c);
+	if (b->flash_credit < RATE_FLASH_MS) {
+		s_rejected.flash++;
+		reject(c, k_reply_429_flash, sizeof(k_reply_429_flash) - 1);
+		return false;
+	}
+	return true;
+}
+
+/***
+ * Take a flash write from the budget of a connection's source address, once the write has been made
+ * @param c connection passed by admission_flash_allowed()
+ */
+void admission_flash_spend(struct mg_connection *c) {
+	s_bucket *b = bucket_for(c);
+	b->flash_credit -= MG_MIN(b->flash_credit, (uint32_t) RATE_FLASH_MS);
+}
+
+/***
+ * Print the rejection counters as a JSON object, for use with %M
+ */
+size_t admission_print_stats(void (*out)(char, void *), void *arg, va_list *ap) {
+	(void) ap;
+	return mg_xprintf(out, arg, "{%m: %lu, %m: %lu, %m: %lu, %m: %lu, %m: %lu, %m: %lu}",
+		MG_ESC("accept"), (unsigned long) s_rejected.accept,
+		MG_ESC("static_busy"), (unsigned long) s_rejected.busy[CONN_STATIC],
+		MG_ESC("api_busy"), (unsigned long) s_rejected.busy[CONN_API],
+		MG_ESC("stream_busy"), (unsigned long) s_rejected.busy[CONN_STREAM],
+		MG_ESC("rate"), (unsigned long) s_rejected.rate,
+		MG_ESC("flash_rate"), (unsigned long) s_rejected.flash);
+}
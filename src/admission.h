@@ -0,0 +1,40 @@
+/*
+ * admission.h
+ *
+ * Connection admission control and per-IP rate limiting for the HTTP listener
+ * Caps concurrent connections per class and rations requests and flash writes with token buckets
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#ifndef SRC_ADMISSION_H_
+#define SRC_ADMISSION_H_
+
+#include <stdarg.h>
+#include "mongoose.h"
+
+#define MAX_CONNECTIONS 12 // Accepted connections of any kind
+#define MAX_CONN_STATIC 4 // Busy static file downloads
+#define MAX_CONN_API 4 // Busy /api requests, parked long-polls are only bounded by MAX_CONNECTIONS
+#define MAX_CONN_STREAM 6 // Websockets and event streams
+
+#define RATE_LIMIT_IPS 8 // Source addresses tracked, least recently seen is replaced
+#define RATE_REQ_MS 200 // Request tokens refill one every 200ms (5 per second)
+#define RATE_REQ_BURST 20
+#define RATE_FLASH_MS 10000 // Flash writing actions refill one every 10 seconds
+#define RATE_FLASH_BURST 3
+
+enum conn_class {
+	CONN_STATIC,
+	CONN_API,
+	CONN_STREAM,
+	CONN_CLASSES
+};
+
+bool admission_accept(struct mg_connection *c);
+bool admission_request(struct mg_connection *c, struct mg_http_message *hm);
+bool admission_flash_allowed(struct mg_connection *c);
+void admission_flash_spend(struct mg_connection *c);
+size_t admission_print_stats(void (*out)(char, void *), void *arg, va_list *ap);
+
+#endif /* SRC_ADMISSION_H_ */
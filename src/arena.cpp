@@ -0,0 +1,101 @@
+/*
+ * arena.cpp
+ *
+ * Per-request bump arena for transient parsing and formatting memory in HTTP handlers
+ * Requests are handled one at a time on the Mongoose event loop, so one arena serves them all
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#include "arena.h"
+
+static struct {
+	alignas(8) uint8_t buf[REQUEST_ARENA_SIZE];
+	size_t used;
+	size_t high_water; // Most used by a single request
+	uint32_t failures; // Allocations that did not fit
+} s_arena;
+
+/***
+ * Allocate from the arena, 4 byte aligned
+ * @param size bytes required
+ * @return memory, or NULL if the arena is full
+ */
+void *arena_alloc(size_t size) {
+	size_t start = (s_arena.used + 3) & ~(size_t) 3;
+	if (size > sizeof(s_arena.buf) - start) {
+		s_arena.failures++;
+		return NULL;
+	}
+	s_arena.used = start + size;
+	if (s_arena.used > s_arena.high_water)
+		s_arena.high_water = s_arena.used;
+	return s_arena.buf + start;
+}
+
+/***
+ * Get a JSON string value, unescaped into the arena
+ * Like mg_json_get_str, but the result must not be freed and lasts until the arena is reset
+ * @param json JSON document
+ * @param path JSON path, e.g. "$.action"
+ * @return NUL terminated string, or NULL if missing, not a string or the arena is full
+ */
+char *arena_json_str(struct mg_str json, const char *path) {
+	int len = 0;
+	int off = mg_json_get(json, path, &len);
+	if (off < 0 || len < 2 || json.buf[off] != '"')
+		return NULL;
+
+	const char *src = json.buf + off + 1;
+	const char *end = json.buf + off + len - 1; // Closing quote
+	char *str = (char *) arena_alloc(end - src + 1); // Unescaping never makes it longer
+	if (str == NULL)
+		return NULL;
+
+	char *dst = str;
+	while (src < end) {
+		char ch = *src++;
+		if (ch == '\\' && src < end) {
+			ch = *src++;
+			switch (ch) {
+				case 'b': ch = '\b'; break;
+				case 'f': ch = '\f'; break;
+				case 'n': ch = '\n'; break;
+				case 'r': ch = '\r'; break;
+				case 't': ch = '\t'; break;
+				case 'u':
+					// Only ASCII is expected in values, anything else becomes '?'
+					if (end - src >= 4 && src[0] == '0' && src[1] == '0' && src[2] < '8') {
+						char hex[3] = {src[2], src[3], 0};
+						ch = (char) strtoul(hex, NULL, 16);
+					} else {
+						ch = '?';
+					}
+					src += MG_MIN(4, end - src);
+					break;
+				default: break; // \" \\ and \/ are the character itself
+			}
+		}
+		*dst++ = ch;
+	}
+	*dst = 0;
+	return str;
+}
+
+/***
+ * Release everything allocated since the last reset
+ */
+void arena_reset() {
+	s_arena.used = 0;
+}
+
+/***
+ * Print arena size, high-water mark and failures as a JSON object, for use with %M
+ */
+size_t arena_print_stats(void (*out)(char, void *), void *arg, va_list *ap) {
+	(void) ap;
+	return mg_xprintf(out, arg, "{%m: %lu, %m: %lu, %m: %lu}",
+		MG_ESC("size"), (unsigned long) sizeof(s_arena.buf),
+		MG_ESC("high_water"), (unsigned long) s_arena.high_water,
+		MG_ESC("failures"), (unsigned long) s_arena.failures);
+}
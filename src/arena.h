@@ -0,0 +1,34 @@
+/*
+ * arena.h
+ *
+ * Per-request bump arena for transient parsing and formatting memory in HTTP handlers
+ * Nothing is freed individually, the whole arena is reset when the handler returns
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#ifndef SRC_ARENA_H_
+#define SRC_ARENA_H_
+
+#include <stdarg.h>
+#include "mongoose.h"
+
+#define REQUEST_ARENA_SIZE 1024
+
+void *arena_alloc(size_t size);
+char *arena_json_str(struct mg_str json, const char *path);
+void arena_reset();
+size_t arena_print_stats(void (*out)(char, void *), void *arg, va_list *ap);
+
+/***
+ * Resets the arena when it goes out of scope, so every return path of a handler releases its memory
+ */
+class ArenaScope {
+public:
+	ArenaScope() = default;
+	~ArenaScope() { arena_reset(); }
+	ArenaScope(const ArenaScope &) = delete;
+	ArenaScope &operator=(const ArenaScope &) = delete;
+};
+
+#endif /* SRC_ARENA_H_ */
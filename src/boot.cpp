@@ -0,0 +1,95 @@
+/*
+ * boot.cpp
+ *
+ * Boot phase timing, and the last known time kept in NVS
+ * The saved time is behind by however long the power was off, plus up to BOOT_EPOCH_SAVE_S,
+ * which is still far closer than 2000-01-01 until SNTP answers. A save is skipped while the saved
+ * time is younger than BOOT_EPOCH_SAVE_S, and the age is taken from the saved value itself so
+ * restarts do not bring a save forward
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#include "hardware/rtc.h"
+#include "NVSOnboard.h"
+#include "boot.h"
+#include "ring_log.h"
+
+static uint32_t s_phase_us[BOOT_PHASES]; // Time since reset each phase was reached, 0 if not yet
+static bool s_clock_restored = false;
+static uint32_t s_restored_epoch = 0;
+static uint32_t s_saved_epoch = 0; // Time in flash, read on first use
+static bool s_saved_read = false;
+
+/***
+ * Record the first time a phase is reached
+ */
+void boot_mark(boot_phase phase) {
+	if (s_phase_us[phase] == 0)
+		s_phase_us[phase] = time_us_32();
+}
+
+/***
+ * Start the RTC from the time last saved, if there is one
+ * @return true if the time was restored
+ */
+bool boot_clock_restore() {
+	NVSOnboard *nvs = NVSOnboard::getInstance();
+	uint32_t epoch;
+	datetime_t dt;
+	if (!nvs->contains("epoch") || nvs->get_u32("epoch", &epoch) != NVS_OK || epoch < BOOT_EPOCH_MIN ||
+			!time_to_datetime(epoch, &dt))
+		return false;
+	rtc_set_datetime(&dt);
+	s_saved_epoch = epoch;
+	s_saved_read = true;
+	s_clock_restored = true;
+	s_restored_epoch = epoch;
+	RLOG_INFO("Clock restored to %lu s from epoch", epoch);
+	return true;
+}
+
+/***
+ * Save the time to flash, after an SNTP update and from the tick, once the saved time is a day old
+ * A saved time ahead of the clock is always replaced, it came from a clock that was wrong
+ * @param utc current time, seconds from epoch
+ */
+void boot_clock_save(uint32_t utc) {
+	if (utc < BOOT_EPOCH_MIN)
+		return;
+	NVSOnboard *nvs = NVSOnboard::getInstance();
+	if (!s_saved_read) {
+		// After a warm reset the clock was not restored, so the saved time has not been read yet
+		if (!nvs->contains("epoch") || nvs->get_u32("epoch", &s_saved_epoch) != NVS_OK)
+			s_saved_epoch = 0;
+		s_saved_read = true;
+	}
+	if (utc >= s_saved_epoch && utc - s_saved_epoch < BOOT_EPOCH_SAVE_S)
+		return;
+	nvs->set_u32("epoch", utc);
+	nvs->commit();
+	s_saved_epoch = utc;
+}
+
+/***
+ * Save the time when due, called from the one second timer
+ * @param utc current time, seconds from epoch
+ */
+void boot_clock_tick(uint32_t utc) {
+	boot_clock_save(utc);
+}
+
+/***
+ * Print the phase times in microseconds and where the clock came from, as a JSON object for get_boot
+ */
+size_t boot_print_stats(void (*out)(char, void *), void *arg, va_list *ap) {
+	static const char *const k_names[BOOT_PHASES] = {"stdio", "settings", "clock", "decision", "storage", "netif", "online", "sntp"};
+	(void) ap;
+	size_t n = mg_xprintf(out, arg, "{%m: {", MG_ESC("phases_us"));
+	for (int i = 0; i < BOOT_PHASES; i++) {
+		n += mg_xprintf(out, arg, "%s%m: ", i ? ", " : "", MG_ESC(k_names[i]));
+		n += s_phase_us[i] ? mg_xprintf(out, arg, "%lu", (unsigned long) s_phase_us[i]) : mg_xprintf(out, arg, "null");
+	}
+	return n + mg_xprintf(out, arg, "}, %m: %m, %m: %lu, %m: %d}", MG_ESC("clock"), MG_ESC(s_clock_restored ? "restored" : "default"),
+		MG_ESC("restored_epoch"), (unsigned long) s_restored_epoch, MG_ESC("usb_wait_ms"), BOOT_USB_WAIT_MS);
+}
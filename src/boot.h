@@ -0,0 +1,45 @@
+/*
+ * boot.h
+ *
+ * Boot phase timing, and the last known time kept in NVS so a restart resumes the schedule
+ * on near-correct time instead of waiting for SNTP
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#ifndef SRC_BOOT_H_
+#define SRC_BOOT_H_
+
+#include <stdarg.h>
+#include "pico/stdlib.h"
+#include "pico/util/datetime.h"
+#include "mongoose.h"
+
+#ifndef BOOT_USB_WAIT_MS
+#define BOOT_USB_WAIT_MS 0 // Longest wait for a USB serial terminal before starting, 0 to start straight away
+#endif
+// The saved time only has to get the schedule close until SNTP answers, seconds after coming online, so it is
+// saved at most once a day. That is about 365 NVS commits a year on the sector shared with the settings,
+// far inside the flash's endurance
+#define BOOT_EPOCH_SAVE_S 86400 // Least age of the saved clock before it is saved again
+#define BOOT_EPOCH_MIN 1577836800 // 2020-01-01, anything earlier is the RTC's unset date
+
+enum boot_phase {
+	BOOT_STDIO, // USB stdio up, after any wait for a terminal
+	BOOT_SETTINGS, // Timers read from flash, or taken back from retained RAM after a warm reset
+	BOOT_CLOCK, // RTC running on restored or default time
+	BOOT_DECISION, // First relay decision made
+	BOOT_STORAGE, // Energy, history and rollups loaded
+	BOOT_NETIF, // Network interface started
+	BOOT_ONLINE, // IP address obtained
+	BOOT_SNTP, // Time set by SNTP
+	BOOT_PHASES
+};
+
+void boot_mark(boot_phase phase);
+bool boot_clock_restore();
+void boot_clock_save(uint32_t utc);
+void boot_clock_tick(uint32_t utc);
+size_t boot_print_stats(void (*out)(char, void *), void *arg, va_list *ap);
+
+#endif /* SRC_BOOT_H_ */
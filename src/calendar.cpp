@@ -0,0 +1,113 @@
+/*
+ * calendar.cpp
+ *
+ * The RTC is read as epoch seconds: its date only goes through days_from_civil() when the date
+ * changes, otherwise the hours, minutes and seconds are multiplied onto the start of the day.
+ * Local time is then the time zone offset added, and the local fields are counted on from the
+ * previous second. The M0+ has no divide instruction, so divisions are left to start up, the
+ * RTC's date changing, and jumps of the clock
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#include "hardware/rtc.h"
+#include "pico/util/datetime.h"
+#include "calendar.h"
+#include "tz.h"
+
+static uint32_t s_date_key = 0; // RTC year, month and day the start of day was worked out for
+static uint32_t s_date_utc = 0; // UTC seconds at the start of that day
+static s_calendar s_cal;
+static bool s_valid = false;
+
+/***
+ * Read the RTC as UTC seconds from epoch
+ */
+uint32_t calendar_read_rtc() {
+	datetime_t dt;
+	rtc_get_datetime(&dt);
+	uint32_t key = (uint32_t) dt.year << 9 | dt.month << 5 | dt.day;
+	if (key != s_date_key) {
+		s_date_key = key;
+		s_date_utc = (uint32_t) days_from_civil(dt.year, dt.month, dt.day) * 86400;
+	}
+	return s_date_utc + dt.hour * 3600 + dt.min * 60 + dt.sec;
+}
+
+/***
+ * Move the calendar to a UTC second, called each second
+ * @param utc seconds from epoch
+ * @return the calendar, valid until the next call
+ */
+const s_calendar *calendar_tick(uint32_t utc) {
+	int32_t offset = tz_offset(utc);
+	uint32_t local = utc + offset;
+	uint32_t gap = local - s_cal.local;
+	if (!s_valid || gap > CALENDAR_STEP_MAX) {
+		calendar_from_local(s_cal, local);
+		s_valid = true;
+	} else {
+		while (gap--)
+			calendar_step(s_cal);
+	}
+	s_cal.utc = utc;
+	s_cal.offset = offset;
+	return &s_cal;
+}
+
+// Self checks, evaluated by the compiler
+
+static constexpr bool same(const s_calendar &a, const s_calendar &b) {
+	return a.local == b.local && a.day == b.day && a.minute == b.minute && a.sec == b.sec && a.dow == b.dow;
+}
+
+/***
+ * Every day from 2000 to 2100 against a calendar kept by counting days through month lengths:
+ * days_from_civil, civil_from_days, year_from_days and the day of the week, and that counting on from the last
+ * second of each day gives the same as working out the first second of the next
+ */
+static constexpr bool check_days() {
+	const uint8_t k_month_days[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+	int32_t y = 2000, m = 1, d = 1;
+	uint8_t dow = 6; // 2000-01-01 was a Saturday
+	for (int32_t n = CALENDAR_EPOCH_DAY; y <= 2100; n++) {
+		if (days_from_civil(y, m, d) != n || year_from_days(n) != y || weekday(n) != dow % 7)
+			return false;
+		int32_t cy = 0;
+		uint32_t cm = 0, cd = 0;
+		civil_from_days(n, cy, cm, cd);
+		if (cy != y || cm != (uint32_t) m || cd != (uint32_t) d)
+			return false;
+		s_calendar a{}, b{};
+		calendar_from_local(a, (uint32_t) n * 86400 + 86399);
+		calendar_step(a);
+		calendar_from_local(b, (uint32_t) (n + 1) * 86400);
+		if (a.day != n + 1 - CALENDAR_EPOCH_DAY || a.dow != (dow == 7 ? 1 : dow + 1) || !same(a, b))
+			return false;
+		dow = dow == 7 ? 1 : dow + 1;
+		int32_t month_days = k_month_days[m - 1] + (m == 2 && is_leap(y));
+		if (++d > month_days) {
+			d = 1;
+			if (++m > 12) {
+				m = 1;
+				y++;
+			}
+		}
+	}
+	return true;
+}
+static_assert(check_days(), "Calendar 2000-2100");
+
+/*** Every second of one day counted on matches working each out */
+static constexpr bool check_seconds(uint32_t start) {
+	s_calendar a{}, b{};
+	calendar_from_local(a, start);
+	for (uint32_t s = 1; s <= 86400; s++) {
+		calendar_step(a);
+		calendar_from_local(b, start + s);
+		if (!same(a, b))
+			return false;
+	}
+	return true;
+}
+static_assert(check_seconds((uint32_t) days_from_civil(2024, 2, 29) * 86400), "Seconds through 2024-02-29");
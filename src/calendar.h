@@ -0,0 +1,99 @@
+/*
+ * calendar.h
+ *
+ * Epoch seconds as the one time source, with the local day, day of the week and minute of the day
+ * carried forward by counting rather than worked out from a date each second
+ * The date arithmetic is constexpr so the calendar is checked while compiling, see calendar.cpp
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#ifndef SRC_CALENDAR_H_
+#define SRC_CALENDAR_H_
+
+#include <stdint.h>
+
+#define CALENDAR_EPOCH_DAY 10957 // 2000-01-01 in days from 1970-01-01, energy, history and rollup days count from it
+#define CALENDAR_STEP_MAX 60 // Forward jumps up to this many seconds are counted through, larger ones recalculate
+
+/*** Days from 1970-01-01 to a date, from Howard Hinnant's days_from_civil */
+constexpr int32_t days_from_civil(int32_t y, uint32_t m, uint32_t d) {
+	y -= m <= 2;
+	int32_t era = (y >= 0 ? y : y - 399) / 400;
+	uint32_t yoe = (uint32_t) (y - era * 400);
+	uint32_t doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+	return era * 146097 + (int32_t) (yoe * 365 + yoe / 4 - yoe / 100 + doy) - 719468;
+}
+
+/*** Year containing a day from 1970-01-01, from Howard Hinnant's civil_from_days */
+constexpr int32_t year_from_days(int32_t z) {
+	z += 719468;
+	int32_t era = (z >= 0 ? z : z - 146096) / 146097;
+	uint32_t doe = (uint32_t) (z - era * 146097);
+	uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+	uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+	uint32_t mp = (5 * doy + 2) / 153;
+	return (int32_t) yoe + era * 400 + (mp >= 10);
+}
+
+/*** Date of a day from 1970-01-01, from Howard Hinnant's civil_from_days */
+constexpr void civil_from_days(int32_t z, int32_t &y, uint32_t &m, uint32_t &d) {
+	z += 719468;
+	int32_t era = (z >= 0 ? z : z - 146096) / 146097;
+	uint32_t doe = (uint32_t) (z - era * 146097);
+	uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+	uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+	uint32_t mp = (5 * doy + 2) / 153;
+	d = doy - (153 * mp + 2) / 5 + 1;
+	m = mp < 10 ? mp + 3 : mp - 9;
+	y = (int32_t) yoe + era * 400 + (m <= 2);
+}
+
+/*** Day of the week from days since 1970-01-01, a Thursday, 0 Sunday - 6 Saturday */
+constexpr uint32_t weekday(int32_t days) {
+	return (uint32_t) ((days % 7 + 11) % 7);
+}
+
+constexpr bool is_leap(int32_t y) {
+	return (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+}
+
+// Current time, UTC and local
+struct s_calendar {
+	uint32_t utc; // Seconds from epoch
+	uint32_t local; // utc plus offset
+	int32_t offset; // Seconds added to UTC for local time
+	uint16_t day; // Local days since 2000-01-01
+	uint16_t minute; // Local minute of the day
+	uint8_t sec; // Second of the minute
+	uint8_t dow; // Day of the week, 1 Monday - 7 Sunday
+};
+
+/*** Fill in the local fields from local seconds, with divisions - at start up and when the clock jumps */
+constexpr void calendar_from_local(s_calendar &c, uint32_t local) {
+	uint32_t days = local / 86400;
+	uint32_t s = local - days * 86400;
+	c.local = local;
+	c.day = (uint16_t) (days - CALENDAR_EPOCH_DAY);
+	c.dow = (uint8_t) ((days + 3) % 7 + 1);
+	c.minute = (uint16_t) (s / 60);
+	c.sec = (uint8_t) (s - c.minute * 60u);
+}
+
+/*** Move the local fields on one second, by counting */
+constexpr void calendar_step(s_calendar &c) {
+	c.local++;
+	if (++c.sec < 60)
+		return;
+	c.sec = 0;
+	if (++c.minute < 1440)
+		return;
+	c.minute = 0;
+	c.day++;
+	c.dow = c.dow == 7 ? 1 : c.dow + 1;
+}
+
+uint32_t calendar_read_rtc();
+const s_calendar *calendar_tick(uint32_t utc);
+
+#endif /* SRC_CALENDAR_H_ */
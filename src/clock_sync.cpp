@@ -0,0 +1,312 @@
+/*
+ * clock_sync.cpp
+ *
+ * SNTP round: each server in SNTP_SERVERS is asked in turn, one request at a time because
+ * mg_sntp_parse() adds half the round trip using a single send time of its own.
+ * Each answer becomes an offset from time_us_64() to UTC, answers far from the median are discarded
+ * and the one with the lowest round trip is used. A one-shot alarm then writes the RTC exactly
+ * as the next UTC second starts, rather than truncating the milliseconds.
+ * The RTC and time_us_64() both run from the crystal, so the change in offset between syncs is the
+ * crystal's drift. It is averaged in parts per billion and kept in NVS. Between syncs the RTC is
+ * realigned whenever the drift adds up to SNTP_CORRECT_MS, and the time to the next sync is how long
+ * the variation in drift takes to reach SNTP_TARGET_MS
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#include <cstring>
+#include "hardware/rtc.h"
+#include "pico/util/datetime.h"
+#include "NVSOnboard.h"
+#include "boot.h"
+#include "clock_sync.h"
+#include "ring_log.h"
+
+static const char *const k_servers[] = {SNTP_SERVERS};
+static constexpr size_t k_server_count = sizeof(k_servers) / sizeof(k_servers[0]);
+
+struct s_sntp_sample {
+	int64_t offset_us; // UTC in microseconds minus time_us_64()
+	uint32_t rtt_us;
+	bool valid;
+};
+
+struct s_sntp_stats {
+	uint32_t syncs;
+	uint32_t failed; // Rounds where no server answered
+	uint32_t answers;
+	uint32_t rejected; // Answers discarded as outliers
+	uint32_t rtt_us; // Round trip of the answer used at the last sync
+	uint32_t min_rtt_us;
+	uint32_t max_rtt_us;
+	int32_t error_us; // Error found at the last sync after drift correction, 0 before a second sync
+	uint32_t epoch; // UTC seconds of the last sync
+	uint32_t interval_s; // Time from the last sync to the next
+	uint32_t corrections; // RTC realignments between syncs
+	uint32_t drift_rejected; // Drift measurements discarded as beyond SNTP_DRIFT_MAX_PPB
+	uint8_t server; // Index of the server used at the last sync
+};
+
+// Drift of the crystal against UTC, saved as the NVS blob "drift"
+struct s_drift {
+	int32_t ppb; // Rate of UTC minus the crystal, averaged
+	uint32_t dev_ppb; // Average deviation of measurements from ppb
+	uint32_t samples;
+};
+
+static s_sntp_sample s_samples[k_server_count];
+static s_sntp_stats s_stats;
+static s_drift s_drift_est;
+static bool s_drift_loaded = false;
+static struct mg_connection *s_conn = NULL;
+static int s_server = -1; // Server being asked, -1 between rounds
+static uint64_t s_sent_us = 0;
+static int64_t s_offset_us = 0; // Offset measured at the last sync
+static uint64_t s_sync_us = 0; // time_us_64() at the last sync
+static int64_t s_rtc_offset_us = 0; // Offset the RTC was last written with
+static bool s_synced = false;
+static alarm_id_t s_alarm = 0;
+static volatile bool s_rtc_set = false; // Set by the alarm, the flash save is left to clock_sync_tick()
+static bool s_save = false; // The pending RTC write is from a sync, drift realignments are not saved
+static uint32_t s_next_sync = 0; // Uptime in seconds of the next round
+
+static void sntp_fn(struct mg_connection *c, int ev, void *ev_data);
+
+/***
+ * Alarm at the start of a UTC second, in interrupt context so only the RTC is written here
+ */
+static int64_t rtc_alarm(alarm_id_t id, void *user_data) {
+	(void) id;
+	(void) user_data;
+	datetime_t dt;
+	// Rounded, the alarm fires a few microseconds either side of the boundary
+	if (time_to_datetime((time_t) ((time_us_64() + s_rtc_offset_us + 500000) / 1000000), &dt))
+		rtc_set_datetime(&dt);
+	s_alarm = 0;
+	s_rtc_set = true;
+	return 0;
+}
+
+/***
+ * Write the RTC from an offset: the alarm is set for the sub-second remaining until the next UTC second
+ * @param offset_us UTC in microseconds minus time_us_64()
+ */
+static void rtc_align(int64_t offset_us) {
+	if (s_alarm)
+		cancel_alarm(s_alarm);
+	s_rtc_set = false;
+	s_rtc_offset_us = offset_us;
+	uint64_t utc_us = time_us_64() + offset_us;
+	s_alarm = add_alarm_in_us(1000000 - utc_us % 1000000, rtc_alarm, NULL, true);
+}
+
+/***
+ * Offset predicted from the last sync and the drift
+ * @param now time_us_64()
+ */
+static int64_t offset_at(uint64_t now) {
+	return s_offset_us + (int64_t) s_drift_est.ppb * (int64_t) (now - s_sync_us) / 1000000000;
+}
+
+/***
+ * Time to the next sync, from how far the drift measurements vary
+ * @return seconds
+ */
+static uint32_t sync_interval() {
+	if (s_drift_est.samples == 0)
+		return SNTP_INTERVAL_MIN_S;
+	uint32_t ppb = MG_MAX(s_drift_est.dev_ppb, (uint32_t) SNTP_DRIFT_FLOOR_PPB);
+	if (s_drift_est.samples < 3)
+		ppb = MG_MAX(ppb, (uint32_t) SNTP_DRIFT_UNKNOWN_PPB);
+	// Error in microseconds is ppb * seconds / 1000
+	uint64_t s = (uint64_t) SNTP_TARGET_MS * 1000000 / ppb;
+	return (uint32_t) MG_MIN(MG_MAX(s, (uint64_t) SNTP_INTERVAL_MIN_S), (uint64_t) SNTP_INTERVAL_MAX_S);
+}
+
+/***
+ * Use a measured offset, updating the drift from the previous sync
+ * @param offset_us UTC in microseconds minus time_us_64()
+ */
+static void clock_apply(int64_t offset_us) {
+	uint64_t now = time_us_64();
+	if (s_synced) {
+		s_stats.error_us = (int32_t) MG_MAX(MG_MIN(offset_us - offset_at(now), INT32_MAX), INT32_MIN);
+		uint64_t elapsed = now - s_sync_us;
+		int64_t moved_us = offset_us - s_offset_us;
+		int64_t limit_us = (int64_t) (elapsed / 1000) * SNTP_DRIFT_MAX_PPB / 1000000;
+		if (elapsed >= (uint64_t) SNTP_DRIFT_MIN_S * 1000000 && (moved_us > limit_us || moved_us < -limit_us)) {
+			s_stats.drift_rejected++;
+			RLOG_INFO("SNTP: drift of %ld ms in %lu s discarded", (int32_t) MG_MAX(MG_MIN(moved_us / 1000, INT32_MAX), INT32_MIN),
+				(uint32_t) (elapsed / 1000000));
+		} else if (elapsed >= (uint64_t) SNTP_DRIFT_MIN_S * 1000000) {
+			// In milliseconds over the elapsed time, so a long gap cannot overflow
+			int32_t ppb = (int32_t) (moved_us * 1000000 / (int64_t) (elapsed / 1000));
+			if (s_drift_est.samples == 0) {
+				s_drift_est.ppb = ppb;
+			} else {
+				// Averages over about four syncs
+				int32_t dev = ppb - s_drift_est.ppb;
+				s_drift_est.dev_ppb += ((int32_t) (dev < 0 ? -dev : dev) - (int32_t) s_drift_est.dev_ppb) / 4;
+				s_drift_est.ppb += dev / 4;
+			}
+			s_drift_est.samples++;
+			NVSOnboard *nvs = NVSOnboard::getInstance();
+			nvs->set_blob("drift", &s_drift_est, sizeof(s_drift_est));
+			nvs->commit();
+		}
+	}
+	s_offset_us = offset_us;
+	s_sync_us = now;
+	s_synced = true;
+	s_save = true;
+	rtc_align(offset_us);
+}
+
+/***
+ * End of a round, choose the answer to use
+ */
+static void round_finish() {
+	s_server = -1;
+	int64_t sorted[k_server_count];
+	size_t n = 0;
+	for (size_t i = 0; i < k_server_count; i++) {
+		if (!s_samples[i].valid)
+			continue;
+		// Insertion sort, there are only a few servers
+		size_t j = n++;
+		for (; j > 0 && sorted[j - 1] > s_samples[i].offset_us; j--)
+			sorted[j] = sorted[j - 1];
+		sorted[j] = s_samples[i].offset_us;
+	}
+	uint32_t now = time_us_64() / 1000000;
+	if (n == 0) {
+		s_stats.failed++;
+		s_next_sync = now + SNTP_RETRY_S;
+		RLOG_INFO("SNTP: no answers");
+		return;
+	}
+	// With two answers neither can be called the outlier, the round trip decides
+	int64_t median = sorted[n / 2];
+	int best = -1;
+	for (size_t i = 0; i < k_server_count; i++) {
+		if (!s_samples[i].valid)
+			continue;
+		int64_t diff = s_samples[i].offset_us - median;
+		if (n >= 3 && (diff > SNTP_OUTLIER_MS * 1000 || diff < -SNTP_OUTLIER_MS * 1000)) {
+			s_stats.rejected++;
+			RLOG_INFO("SNTP: server %u is %ld ms from the median", (unsigned) i, (int32_t) (diff / 1000));
+			continue;
+		}
+		if (best < 0 || s_samples[i].rtt_us < s_samples[best].rtt_us)
+			best = i;
+	}
+	clock_apply(s_samples[best].offset_us);
+	s_stats.syncs++;
+	s_stats.server = best;
+	s_stats.rtt_us = s_samples[best].rtt_us;
+	if (s_stats.min_rtt_us == 0 || s_stats.rtt_us < s_stats.min_rtt_us)
+		s_stats.min_rtt_us = s_stats.rtt_us;
+	if (s_stats.rtt_us > s_stats.max_rtt_us)
+		s_stats.max_rtt_us = s_stats.rtt_us;
+	s_stats.epoch = (uint32_t) ((time_us_64() + s_offset_us) / 1000000);
+	s_stats.interval_s = sync_interval();
+	s_next_sync = now + s_stats.interval_s;
+	RLOG_INFO("SNTP: server %u, rtt %lu us, error %ld us", (unsigned) best, s_stats.rtt_us, s_stats.error_us);
+	RLOG_INFO("SNTP: drift %ld ppb, next sync in %lu s", s_drift_est.ppb, s_stats.interval_s);
+}
+
+/***
+ * Ask the next server in the round, or finish the round after the last
+ * @param mgr event manager
+ */
+static void round_next(struct mg_mgr *mgr) {
+	for (; s_server < (int) k_server_count; s_server++) {
+		s_conn = mg_sntp_connect(mgr, k_servers[s_server], sntp_fn, NULL);
+		if (s_conn != NULL)
+			return;
+	}
+	round_finish();
+}
+
+/***
+ * SNTP connection handler, Mongoose sends the request on MG_EV_CONNECT and times out after 3 s
+ */
+static void sntp_fn(struct mg_connection *c, int ev, void *ev_data) {
+	if (ev == MG_EV_CONNECT) {
+		s_sent_us = time_us_64();
+	} else if (ev == MG_EV_SNTP_TIME) {
+		uint64_t now = time_us_64();
+		s_samples[s_server].offset_us = *(int64_t *) ev_data * 1000 - (int64_t) now;
+		s_samples[s_server].rtt_us = (uint32_t) (now - s_sent_us);
+		s_samples[s_server].valid = true;
+		s_stats.answers++;
+		c->is_closing = 1;
+	} else if (ev == MG_EV_CLOSE) {
+		s_conn = NULL;
+		s_server++;
+		round_next(c->mgr);
+	}
+}
+
+/***
+ * Start a round when due, realign the RTC for drift and save the clock once the alarm has set it,
+ * called every 10 seconds
+ * @param mgr event manager
+ */
+void clock_sync_tick(struct mg_mgr *mgr) {
+	if (!s_drift_loaded) {
+		s_drift_loaded = true;
+		NVSOnboard *nvs = NVSOnboard::getInstance();
+		size_t len = sizeof(s_drift_est);
+		if (!nvs->contains("drift") || nvs->get_blob("drift", &s_drift_est, &len) != NVS_OK || len != sizeof(s_drift_est))
+			memset(&s_drift_est, 0, sizeof(s_drift_est));
+	}
+	if (s_synced && !s_alarm) {
+		int64_t offset = offset_at(time_us_64());
+		int64_t diff = offset - s_rtc_offset_us;
+		if (diff >= SNTP_CORRECT_MS * 1000 || diff <= -SNTP_CORRECT_MS * 1000) {
+			s_stats.corrections++;
+			rtc_align(offset);
+		}
+	}
+	if (s_rtc_set) {
+		s_rtc_set = false;
+		if (s_save) {
+			s_save = false;
+			uint32_t utc = (uint32_t) ((time_us_64() + s_rtc_offset_us) / 1000000);
+			RLOG_DEBUG("RTC set to %lu s from epoch", utc);
+			boot_mark(BOOT_SNTP);
+			boot_clock_save(utc);
+		}
+	}
+	if (s_server >= 0 || (int32_t) (time_us_64() / 1000000 - s_next_sync) < 0 || mgr->ifp->state != MG_TCPIP_STATE_READY)
+		return;
+	for (size_t i = 0; i < k_server_count; i++)
+		s_samples[i].valid = false;
+	s_server = 0;
+	round_next(mgr);
+}
+
+/***
+ * Print sync counters, round trips and the last correction, as a JSON object for get_stats
+ */
+size_t clock_sync_print_stats(void (*out)(char, void *), void *arg, va_list *ap) {
+	(void) ap;
+	size_t n = mg_xprintf(out, arg, "{%m: %g, %m: %lu, %m: %lu, %m: %lu, %m: %lu, %m: %lu, ",
+		MG_ESC("drift_ppm"), (double) s_drift_est.ppb / 1000, MG_ESC("drift_dev_ppb"), (unsigned long) s_drift_est.dev_ppb,
+		MG_ESC("drift_samples"), (unsigned long) s_drift_est.samples, MG_ESC("drift_rejected"), (unsigned long) s_stats.drift_rejected,
+		MG_ESC("interval_s"), (unsigned long) s_stats.interval_s,
+		MG_ESC("corrections"), (unsigned long) s_stats.corrections);
+	n += mg_xprintf(out, arg, "%m: %lu, %m: %lu, %m: %lu, %m: %lu, %m: %lu, %m: %lu, %m: %lu, %m: %ld, %m: %lu, %m: %m, %m: [",
+		MG_ESC("syncs"), (unsigned long) s_stats.syncs, MG_ESC("failed"), (unsigned long) s_stats.failed,
+		MG_ESC("answers"), (unsigned long) s_stats.answers, MG_ESC("rejected"), (unsigned long) s_stats.rejected,
+		MG_ESC("rtt_us"), (unsigned long) s_stats.rtt_us, MG_ESC("min_rtt_us"), (unsigned long) s_stats.min_rtt_us,
+		MG_ESC("max_rtt_us"), (unsigned long) s_stats.max_rtt_us, MG_ESC("error_us"), (long) s_stats.error_us,
+		MG_ESC("epoch"), (unsigned long) s_stats.epoch, MG_ESC("server"), MG_ESC(s_stats.syncs ? k_servers[s_stats.server] : ""),
+		MG_ESC("rtt_by_server_us"));
+	for (size_t i = 0; i < k_server_count; i++) {
+		n += s_samples[i].valid ? mg_xprintf(out, arg, "%s%lu", i ? ", " : "", (unsigned long) s_samples[i].rtt_us) :
+			mg_xprintf(out, arg, "%snull", i ? ", " : "");
+	}
+	return n + mg_xprintf(out, arg, "]}");
+}
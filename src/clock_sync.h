@@ -0,0 +1,35 @@
+/*
+ * clock_sync.h
+ *
+ * SNTP against several servers, keeping the answer with the lowest round trip, and setting the RTC
+ * on a second boundary so the schedule runs to within tens of milliseconds
+ * The crystal's drift is measured between syncs and corrected for, so syncs can be further apart
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#ifndef SRC_CLOCK_SYNC_H_
+#define SRC_CLOCK_SYNC_H_
+
+#include <stdarg.h>
+#include "pico/stdlib.h"
+#include "mongoose.h"
+
+#ifndef SNTP_SERVERS
+#define SNTP_SERVERS "udp://time.google.com:123", "udp://time.cloudflare.com:123", "udp://pool.ntp.org:123"
+#endif
+#define SNTP_INTERVAL_MIN_S 3600 // Shortest time between syncs, used until the drift has been measured
+#define SNTP_INTERVAL_MAX_S 604800 // Longest time between syncs, a week
+#define SNTP_TARGET_MS 50 // Clock error allowed to build up from drift uncertainty before the next sync
+#define SNTP_DRIFT_MIN_S 1800 // Shortest time between syncs that gives a drift measurement
+#define SNTP_DRIFT_FLOOR_PPB 50 // Drift uncertainty is never taken as less than this
+#define SNTP_DRIFT_UNKNOWN_PPB 1000 // Drift uncertainty assumed until three measurements
+#define SNTP_DRIFT_MAX_PPB 500000 // Measurements beyond 500 ppm are not crystal drift, such as after the RTC was set by hand, and are discarded
+#define SNTP_CORRECT_MS 20 // RTC is realigned between syncs once the predicted drift reaches this
+#define SNTP_RETRY_S 10 // Seconds before trying again when no server answered
+#define SNTP_OUTLIER_MS 100 // Answers further than this from the median are discarded, with three or more answers
+
+void clock_sync_tick(struct mg_mgr *mgr);
+size_t clock_sync_print_stats(void (*out)(char, void *), void *arg, va_list *ap);
+
+#endif /* SRC_CLOCK_SYNC_H_ */
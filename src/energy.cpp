@@ -0,0 +1,145 @@
+/*
+ * energy.cpp
+ *
+ * Estimated heater energy from relay on-time, per day and per timer
+ * The tick is one increment, days are closed into a fixed ring and the ring is kept as one NVS blob
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#include "NVSOnboard.h"
+#include "energy.h"
+#include "ring_log.h"
+
+uint16_t element_watts = ELEMENT_WATTS;
+
+static s_energy_state s_energy;
+
+static uint16_t s_checkpoint = 0; // Seconds since today's counters were last saved
+static bool s_dirty = false;
+
+/***
+ * Save the counters and day ring to flash
+ */
+static void energy_save() {
+	NVSOnboard *nvs = NVSOnboard::getInstance();
+	nvs->set_blob("energy", &s_energy, sizeof(s_energy));
+	nvs->commit();
+	s_checkpoint = 0;
+	s_dirty = false;
+}
+
+/***
+ * Restore the counters and day ring, if a blob of the current layout was saved
+ */
+void energy_load() {
+	NVSOnboard *nvs = NVSOnboard::getInstance();
+	size_t len = sizeof(s_energy);
+	if (!nvs->contains("energy") || nvs->get_blob("energy", &s_energy, &len) != NVS_OK || len != sizeof(s_energy)) {
+		memset(&s_energy, 0, sizeof(s_energy));
+		return;
+	}
+	if (s_energy.next >= ENERGY_DAYS)
+		s_energy.next = 0;
+}
+
+/***
+ * Copy the counters out for retained RAM
+ */
+void energy_retain(s_energy_state *st) {
+	*st = s_energy;
+}
+
+/***
+ * Take the counters back from retained RAM after a warm reset, instead of energy_load()
+ */
+void energy_resume(const s_energy_state *st) {
+	s_energy = *st;
+}
+
+/***
+ * Move today's counters into the ring and start a new day
+ */
+static void energy_close_day(uint16_t day) {
+	s_energy_day *d = &s_energy.days[s_energy.next];
+	d->day = s_energy.day;
+	for (int i = 0; i < ENERGY_SOURCES; i++) {
+		d->on[i] = (s_energy.today[i] + ENERGY_UNIT_S / 2) / ENERGY_UNIT_S;
+		s_energy.today[i] = 0;
+	}
+	s_energy.next = (s_energy.next + 1) % ENERGY_DAYS;
+	s_energy.day = day;
+	energy_save();
+}
+
+/***
+ * Count one second, called from the one second timer
+ * @param day current day number, days since 2000-01-01
+ * @param source timer index, ENERGY_BOOST or ENERGY_NONE when the relay is off
+ */
+void energy_tick(uint16_t day, uint8_t source) {
+	if (day != s_energy.day) {
+		// Time counted before the clock was set belongs to the first real day
+		if (s_energy.day == 0)
+			s_energy.day = day;
+		else
+			energy_close_day(day);
+	}
+	if (source < ENERGY_SOURCES) {
+		s_energy.today[source]++;
+		s_dirty = true;
+	}
+	if (++s_checkpoint >= ENERGY_CHECKPOINT_S && s_dirty)
+		energy_save();
+}
+
+/***
+ * Energy used so far today
+ * @return watt-hours at the configured element rating
+ */
+uint32_t energy_today_wh() {
+	uint32_t secs = 0;
+	for (int i = 0; i < ENERGY_SOURCES; i++)
+		secs += s_energy.today[i];
+	return secs * element_watts / 3600;
+}
+
+/***
+ * Print a day's on-time and watt-hours as a JSON object
+ * @param secs seconds on per source
+ */
+static size_t energy_print_day(void (*out)(char, void *), void *arg, uint16_t day, const uint32_t *secs) {
+	uint32_t total = 0;
+	for (int i = 0; i < ENERGY_SOURCES; i++)
+		total += secs[i];
+	size_t n = mg_xprintf(out, arg, "{%m: %u, %m: %lu, %m: %lu, %m: [", MG_ESC("day"), day, MG_ESC("on_s"), (unsigned long) total,
+		MG_ESC("wh"), (unsigned long) (total * element_watts / 3600), MG_ESC("source_wh"));
+	for (int i = 0; i < ENERGY_SOURCES; i++)
+		n += mg_xprintf(out, arg, "%s%lu", i ? ", " : "", (unsigned long) (secs[i] * element_watts / 3600));
+	return n + mg_xprintf(out, arg, "]}");
+}
+
+/***
+ * Print today and the stored days, newest first, as a JSON object for the get_energy action
+ * Days are numbered from 2000-01-01, sources are timers 1-6 then boost
+ */
+size_t energy_print(void (*out)(char, void *), void *arg, va_list *ap) {
+	(void) ap;
+	size_t n = mg_xprintf(out, arg, "{%m: %u, %m: ", MG_ESC("element_watts"), element_watts, MG_ESC("today"));
+	n += energy_print_day(out, arg, s_energy.day, s_energy.today);
+	n += mg_xprintf(out, arg, ", %m: [", MG_ESC("days"));
+	bool first = true;
+	for (int i = 1; i <= ENERGY_DAYS; i++) {
+		const s_energy_day *d = &s_energy.days[(s_energy.next + ENERGY_DAYS - i) % ENERGY_DAYS];
+		if (d->day == 0)
+			continue;
+		uint32_t secs[ENERGY_SOURCES];
+		for (int j = 0; j < ENERGY_SOURCES; j++)
+			secs[j] = d->on[j] * ENERGY_UNIT_S;
+		if (!first)
+			n += mg_xprintf(out, arg, ", ");
+		n += energy_print_day(out, arg, d->day, secs);
+		first = false;
+	}
+	return n + mg_xprintf(out, arg, "]}");
+}
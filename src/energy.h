@@ -0,0 +1,48 @@
+/*
+ * energy.h
+ *
+ * Estimated heater energy from relay on-time, per day and per timer
+ * Seconds are counted on the one second tick and only multiplied by the element rating when reported
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#ifndef SRC_ENERGY_H_
+#define SRC_ENERGY_H_
+
+#include <stdarg.h>
+#include "mongoose.h"
+
+#define ELEMENT_WATTS 3000 // Default immersion element rating
+#define ELEMENT_WATTS_MAX 10000 // Keeps a whole day of watt-seconds inside 32 bits
+#define ENERGY_DAYS 28 // Daily buckets kept in RAM and flash
+#define ENERGY_SOURCES 7 // Timers 1-6 then boost
+#define ENERGY_BOOST 6
+#define ENERGY_NONE 0xFF // Relay off
+#define ENERGY_UNIT_S 2 // Resolution of a stored day, so a full day fits 16 bits
+#define ENERGY_CHECKPOINT_S 14400 // Today's counters are saved this often if changed, as well as at midnight
+
+// A finished day, on-time per source in ENERGY_UNIT_S units
+struct s_energy_day {
+	uint16_t day; // Days since 2000-01-01, 0 for an unused bucket
+	uint16_t on[ENERGY_SOURCES];
+};
+
+// Counters and day ring, saved to flash as one blob and kept across warm resets
+struct s_energy_state {
+	uint16_t day; // Day being counted, 0 until the clock has been set
+	uint8_t next; // Ring slot for the next finished day
+	uint32_t today[ENERGY_SOURCES]; // Seconds on so far today
+	s_energy_day days[ENERGY_DAYS];
+};
+
+extern uint16_t element_watts;
+
+void energy_load();
+void energy_retain(s_energy_state *st);
+void energy_resume(const s_energy_state *st);
+void energy_tick(uint16_t day, uint8_t source);
+uint32_t energy_today_wh();
+size_t energy_print(void (*out)(char, void *), void *arg, va_list *ap);
+
+#endif /* SRC_ENERGY_H_ */
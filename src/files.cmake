@@ -1,3 +1,19 @@
 set(SRC_FILES 
     ${CMAKE_CURRENT_LIST_DIR}/fs.c
+    ${CMAKE_CURRENT_LIST_DIR}/admission.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/arena.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/boot.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/calendar.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/clock_sync.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/energy.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/history.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/holiday.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/mem_pool.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/mem_watch.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/net.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/retain.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/ring_log.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/rollup.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/tariff.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/tz.cpp
 )
\ No newline at end of file
@@ -17,291 +17,312 @@ static const unsigned char v1[] = {
  112, 100,  97, 116, 105, 110, 103,  32,  99, 111, 110, 116, // pdating cont
  114, 111, 108, 115,  32, 119, 104, 101, 110,  32,  98, 101, // rols when be
  105, 110, 103,  32, 101, 100, 105, 116, 101, 100,  13,  10, // ing edited..
- 118,  97, 114,  32, 119, 115,  59,  32,  47,  47,  32,  87, // var ws; // W
- 101,  98,  83, 111,  99, 107, 101, 116,  13,  10, 118,  97, // ebSocket..va
- 114,  32, 119, 115,  82, 101, 116, 114, 121,  65, 116, 116, // r wsRetryAtt
- 101, 109, 112, 116, 115,  32,  61,  32,  48,  59,  13,  10, // empts = 0;..
- 118,  97, 114,  32, 111, 118, 101, 114, 108,  97, 121,  32, // var overlay 
-  61,  32, 100, 111,  99, 117, 109, 101, 110, 116,  46, 103, // = document.g
- 101, 116,  69, 108, 101, 109, 101, 110, 116,  66, 121,  73, // etElementByI
- 100,  40,  39, 111, 118, 101, 114, 108,  97, 121,  39,  41, // d('overlay')
-  59,  13,  10,  99, 111, 110, 115, 116,  32, 109,  97, 120, // ;..const max
-  82, 101, 116, 114, 121,  65, 116, 116, 101, 109, 112, 116, // RetryAttempt
- 115,  32,  61,  32,  53,  59,  32,  47,  47,  32,  77,  97, // s = 5; // Ma
- 120, 105, 109, 117, 109,  32, 110, 117, 109,  98, 101, 114, // ximum number
-  32, 111, 102,  32, 114, 101, 116, 114, 121,  32,  97, 116, //  of retry at
- 116, 101, 109, 112, 116, 115,  13,  10,  99, 111, 110, 115, // tempts..cons
- 116,  32, 114, 101, 116, 114, 121,  68, 101, 108,  97, 121, // t retryDelay
-  32,  61,  32,  49,  48,  48,  48,  59,  32,  47,  47,  32, //  = 1000; // 
-  68, 101, 108,  97, 121,  32,  98, 101, 116, 119, 101, 101, // Delay betwee
- 110,  32, 114, 101, 116, 114, 105, 101, 115,  32, 105, 110, // n retries in
-  32, 109, 105, 108, 108, 105, 115, 101,  99, 111, 110, 100, //  millisecond
- 115,  13,  10,  13,  10,  47,  47,  32, 104, 116, 116, 112, // s....// http
- 115,  58,  47,  47, 119, 119, 119,  46, 115, 108, 105, 110, // s://www.slin
- 103,  97,  99,  97, 100, 101, 109, 121,  46,  99, 111, 109, // gacademy.com
-  47,  97, 114, 116, 105,  99, 108, 101,  47, 106,  97, 118, // /article/jav
-  97, 115,  99, 114, 105, 112, 116,  45,  99, 104, 101,  99, // ascript-chec
- 107, 105, 110, 103,  45, 105, 102,  45,  97,  45, 116,  97, // king-if-a-ta
-  98,  45, 105, 115,  45,  99, 117, 114, 114, 101, 110, 116, // b-is-current
- 108, 121,  45, 102, 111,  99, 117, 115, 101, 100,  45,  97, // ly-focused-a
-  99, 116, 105, 118, 101,  47,  13,  10, 118,  97, 114,  32, // ctive/..var 
- 104, 105, 100, 100, 101, 110,  44,  32, 118, 105, 115, 105, // hidden, visi
-  98, 105, 108, 105, 116, 121,  67, 104,  97, 110, 103, 101, // bilityChange
-  59,  13,  10, 105, 102,  32,  40, 116, 121, 112, 101, 111, // ;..if (typeo
- 102,  32, 100, 111,  99, 117, 109, 101, 110, 116,  46, 104, // f document.h
- 105, 100, 100, 101, 110,  32,  33,  61,  61,  32,  34, 117, // idden !== "u
- 110, 100, 101, 102, 105, 110, 101, 100,  34,  41,  32, 123, // ndefined") {
-  13,  10,  32,  32,  32,  32, 104, 105, 100, 100, 101, 110, // ..    hidden
-  32,  61,  32,  34, 104, 105, 100, 100, 101, 110,  34,  59, //  = "hidden";
-  13,  10,  32,  32,  32,  32, 118, 105, 115, 105,  98, 105, // ..    visibi
- 108, 105, 116, 121,  67, 104,  97, 110, 103, 101,  32,  61, // lityChange =
-  32,  34, 118, 105, 115, 105,  98, 105, 108, 105, 116, 121, //  "visibility
-  99, 104,  97, 110, 103, 101,  34,  59,  13,  10, 125,  32, // change";..} 
- 101, 108, 115, 101,  32, 105, 102,  32,  40, 116, 121, 112, // else if (typ
- 101, 111, 102,  32, 100, 111,  99, 117, 109, 101, 110, 116, // eof document
-  46, 109, 115,  72, 105, 100, 100, 101, 110,  32,  33,  61, // .msHidden !=
-  61,  32,  34, 117, 110, 100, 101, 102, 105, 110, 101, 100, // = "undefined
-  34,  41,  32, 123,  13,  10,  32,  32,  32,  32, 104, 105, // ") {..    hi
- 100, 100, 101, 110,  32,  61,  32,  39, 109, 115,  72, 105, // dden = 'msHi
- 100, 100, 101, 110,  39,  59,  13,  10,  32,  32,  32,  32, // dden';..    
- 118, 105, 115, 105,  98, 105, 108, 105, 116, 121,  67, 104, // visibilityCh
-  97, 110, 103, 101,  32,  61,  32,  39, 109, 115, 118, 105, // ange = 'msvi
- 115, 105,  98, 105, 108, 105, 116, 121,  99, 104,  97, 110, // sibilitychan
- 103, 101,  39,  59,  13,  10, 125,  32, 101, 108, 115, 101, // ge';..} else
-  32, 105, 102,  32,  40, 116, 121, 112, 101, 111, 102,  32, //  if (typeof 
- 100, 111,  99, 117, 109, 101, 110, 116,  46, 119, 101,  98, // document.web
- 107, 105, 116,  72, 105, 100, 100, 101, 110,  32,  33,  61, // kitHidden !=
-  61,  32,  34, 117, 110, 100, 101, 102, 105, 110, 101, 100, // = "undefined
-  34,  41,  32, 123,  13,  10,  32,  32,  32,  32, 104, 105, // ") {..    hi
- 100, 100, 101, 110,  32,  61,  32,  39, 119, 101,  98, 107, // dden = 'webk
- 105, 116,  72, 105, 100, 100, 101, 110,  39,  59,  13,  10, // itHidden';..
+ 118,  97, 114,  32, 108,  97, 115, 116,  84, 105, 109, 101, // var lastTime
+ 114, 115,  32,  61,  32,  91,  93,  59,  32,  47,  47,  32, // rs = []; // 
+  84, 105, 109, 101, 114, 115,  32, 105, 110,  32, 116, 104, // Timers in th
+ 101,  32, 108,  97, 115, 116,  32, 115, 116,  97, 116, 117, // e last statu
+ 115,  44,  32, 116, 104, 101,  32, 111, 116, 104, 101, 114, // s, the other
+ 115,  32,  97, 114, 101,  32, 115, 101, 110, 116,  32, 117, // s are sent u
+ 110,  99, 104,  97, 110, 103, 101, 100,  32, 119, 104, 101, // nchanged whe
+ 110,  32, 111, 110, 101,  32, 116, 105, 109, 101, 114,  32, // n one timer 
+ 105, 115,  32, 115,  97, 118, 101, 100,  13,  10, 118,  97, // is saved..va
+ 114,  32, 119, 115,  59,  32,  47,  47,  32,  87, 101,  98, // r ws; // Web
+  83, 111,  99, 107, 101, 116,  13,  10, 118,  97, 114,  32, // Socket..var 
+ 119, 115,  82, 101, 116, 114, 121,  65, 116, 116, 101, 109, // wsRetryAttem
+ 112, 116, 115,  32,  61,  32,  48,  59,  13,  10, 118,  97, // pts = 0;..va
+ 114,  32, 111, 118, 101, 114, 108,  97, 121,  32,  61,  32, // r overlay = 
+ 100, 111,  99, 117, 109, 101, 110, 116,  46, 103, 101, 116, // document.get
+  69, 108, 101, 109, 101, 110, 116,  66, 121,  73, 100,  40, // ElementById(
+  39, 111, 118, 101, 114, 108,  97, 121,  39,  41,  59,  13, // 'overlay');.
+  10,  99, 111, 110, 115, 116,  32, 109,  97, 120,  82, 101, // .const maxRe
+ 116, 114, 121,  65, 116, 116, 101, 109, 112, 116, 115,  32, // tryAttempts 
+  61,  32,  53,  59,  32,  47,  47,  32,  77,  97, 120, 105, // = 5; // Maxi
+ 109, 117, 109,  32, 110, 117, 109,  98, 101, 114,  32, 111, // mum number o
+ 102,  32, 114, 101, 116, 114, 121,  32,  97, 116, 116, 101, // f retry atte
+ 109, 112, 116, 115,  13,  10,  99, 111, 110, 115, 116,  32, // mpts..const 
+ 114, 101, 116, 114, 121,  68, 101, 108,  97, 121,  32,  61, // retryDelay =
+  32,  49,  48,  48,  48,  59,  32,  47,  47,  32,  68, 101, //  1000; // De
+ 108,  97, 121,  32,  98, 101, 116, 119, 101, 101, 110,  32, // lay between 
+ 114, 101, 116, 114, 105, 101, 115,  32, 105, 110,  32, 109, // retries in m
+ 105, 108, 108, 105, 115, 101,  99, 111, 110, 100, 115,  13, // illiseconds.
+  10,  13,  10,  47,  47,  32, 104, 116, 116, 112, 115,  58, // ...// https:
+  47,  47, 119, 119, 119,  46, 115, 108, 105, 110, 103,  97, // //www.slinga
+  99,  97, 100, 101, 109, 121,  46,  99, 111, 109,  47,  97, // cademy.com/a
+ 114, 116, 105,  99, 108, 101,  47, 106,  97, 118,  97, 115, // rticle/javas
+  99, 114, 105, 112, 116,  45,  99, 104, 101,  99, 107, 105, // cript-checki
+ 110, 103,  45, 105, 102,  45,  97,  45, 116,  97,  98,  45, // ng-if-a-tab-
+ 105, 115,  45,  99, 117, 114, 114, 101, 110, 116, 108, 121, // is-currently
+  45, 102, 111,  99, 117, 115, 101, 100,  45,  97,  99, 116, // -focused-act
+ 105, 118, 101,  47,  13,  10, 118,  97, 114,  32, 104, 105, // ive/..var hi
+ 100, 100, 101, 110,  44,  32, 118, 105, 115, 105,  98, 105, // dden, visibi
+ 108, 105, 116, 121,  67, 104,  97, 110, 103, 101,  59,  13, // lityChange;.
+  10, 105, 102,  32,  40, 116, 121, 112, 101, 111, 102,  32, // .if (typeof 
+ 100, 111,  99, 117, 109, 101, 110, 116,  46, 104, 105, 100, // document.hid
+ 100, 101, 110,  32,  33,  61,  61,  32,  34, 117, 110, 100, // den !== "und
+ 101, 102, 105, 110, 101, 100,  34,  41,  32, 123,  13,  10, // efined") {..
+  32,  32,  32,  32, 104, 105, 100, 100, 101, 110,  32,  61, //     hidden =
+  32,  34, 104, 105, 100, 100, 101, 110,  34,  59,  13,  10, //  "hidden";..
   32,  32,  32,  32, 118, 105, 115, 105,  98, 105, 108, 105, //     visibili
- 116, 121,  67, 104,  97, 110, 103, 101,  32,  61,  32,  39, // tyChange = '
- 119, 101,  98, 107, 105, 116, 118, 105, 115, 105,  98, 105, // webkitvisibi
- 108, 105, 116, 121,  99, 104,  97, 110, 103, 101,  39,  59, // litychange';
-  13,  10, 125,  13,  10,  13,  10,  47,  47,  32,  87, 101, // ..}....// We
-  98,  83, 111,  99, 107, 101, 116,  32,  99,  97, 108, 108, // bSocket call
- 101, 100,  32, 111, 110,  32, 108, 111,  97, 100,  44,  32, // ed on load, 
- 115, 116, 114, 101,  97, 109, 115,  32, 102, 114, 111, 109, // streams from
-  32, 112, 105,  99, 111,  32, 116, 111,  32,  98, 114, 111, //  pico to bro
- 119, 115, 101, 114,  13,  10, 102, 117, 110,  99, 116, 105, // wser..functi
- 111, 110,  32, 115, 116, 114, 101,  97, 109,  83, 116,  97, // on streamSta
- 116, 117, 115,  40,  41,  32, 123,  13,  10,  32,  32,  32, // tus() {..   
-  32, 105, 102,  32,  40,  33, 100, 111,  99, 117, 109, 101, //  if (!docume
- 110, 116,  91, 104, 105, 100, 100, 101, 110,  93,  41,  32, // nt[hidden]) 
- 123,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  99, // {..        c
- 111, 110, 115, 111, 108, 101,  46, 108, 111, 103,  40,  34, // onsole.log("
-  86, 105, 115, 105,  98, 108, 101,  34,  41,  59,  13,  10, // Visible");..
-  32,  32,  32,  32,  32,  32,  32,  32, 105, 102,  32,  40, //         if (
-  33, 119, 115,  41,  32, 123,  13,  10,  32,  32,  32,  32, // !ws) {..    
-  32,  32,  32,  32,  32,  32,  32,  32,  99, 111, 110, 115, //         cons
- 111, 108, 101,  46, 108, 111, 103,  40,  34,  79, 112, 101, // ole.log("Ope
- 110, 105, 110, 103,  32, 119, 101,  98, 115, 111,  99, 107, // ning websock
- 101, 116,  46,  46,  46,  34,  41,  59,  13,  10,  32,  32, // et...");..  
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, 119, 115, //           ws
-  32,  61,  32, 110, 101, 119,  32,  87, 101,  98,  83, 111, //  = new WebSo
-  99, 107, 101, 116,  40,  34, 119, 115,  58,  47,  47,  34, // cket("ws://"
-  32,  43,  32, 108, 111,  99,  97, 116, 105, 111, 110,  46, //  + location.
- 104, 111, 115, 116,  32,  43,  32,  34,  47, 119, 101,  98, // host + "/web
- 115, 111,  99, 107, 101, 116,  34,  41,  59,  13,  10,  32, // socket");.. 
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, 119, //            w
- 115,  82, 101, 116, 114, 121,  65, 116, 116, 101, 109, 112, // sRetryAttemp
- 116, 115,  32,  61,  32,  48,  59,  13,  10,  32,  32,  32, // ts = 0;..   
-  32,  32,  32,  32,  32,  32,  32,  32,  32, 111, 118, 101, //          ove
- 114, 108,  97, 121,  46,  99, 108,  97, 115, 115,  76, 105, // rlay.classLi
- 115, 116,  46,  97, 100, 100,  40,  39, 104, 105, 100, 100, // st.add('hidd
- 101, 110,  39,  41,  59,  32,  47,  47,  32,  72, 105, 100, // en'); // Hid
- 101,  32, 111, 118, 101, 114, 108,  97, 121,  13,  10,  32, // e overlay.. 
-  32,  32,  32,  32,  32,  32,  32, 125,  13,  10,  32,  32, //        }..  
+ 116, 121,  67, 104,  97, 110, 103, 101,  32,  61,  32,  34, // tyChange = "
+ 118, 105, 115, 105,  98, 105, 108, 105, 116, 121,  99, 104, // visibilitych
+  97, 110, 103, 101,  34,  59,  13,  10, 125,  32, 101, 108, // ange";..} el
+ 115, 101,  32, 105, 102,  32,  40, 116, 121, 112, 101, 111, // se if (typeo
+ 102,  32, 100, 111,  99, 117, 109, 101, 110, 116,  46, 109, // f document.m
+ 115,  72, 105, 100, 100, 101, 110,  32,  33,  61,  61,  32, // sHidden !== 
+  34, 117, 110, 100, 101, 102, 105, 110, 101, 100,  34,  41, // "undefined")
+  32, 123,  13,  10,  32,  32,  32,  32, 104, 105, 100, 100, //  {..    hidd
+ 101, 110,  32,  61,  32,  39, 109, 115,  72, 105, 100, 100, // en = 'msHidd
+ 101, 110,  39,  59,  13,  10,  32,  32,  32,  32, 118, 105, // en';..    vi
+ 115, 105,  98, 105, 108, 105, 116, 121,  67, 104,  97, 110, // sibilityChan
+ 103, 101,  32,  61,  32,  39, 109, 115, 118, 105, 115, 105, // ge = 'msvisi
+  98, 105, 108, 105, 116, 121,  99, 104,  97, 110, 103, 101, // bilitychange
+  39,  59,  13,  10, 125,  32, 101, 108, 115, 101,  32, 105, // ';..} else i
+ 102,  32,  40, 116, 121, 112, 101, 111, 102,  32, 100, 111, // f (typeof do
+  99, 117, 109, 101, 110, 116,  46, 119, 101,  98, 107, 105, // cument.webki
+ 116,  72, 105, 100, 100, 101, 110,  32,  33,  61,  61,  32, // tHidden !== 
+  34, 117, 110, 100, 101, 102, 105, 110, 101, 100,  34,  41, // "undefined")
+  32, 123,  13,  10,  32,  32,  32,  32, 104, 105, 100, 100, //  {..    hidd
+ 101, 110,  32,  61,  32,  39, 119, 101,  98, 107, 105, 116, // en = 'webkit
+  72, 105, 100, 100, 101, 110,  39,  59,  13,  10,  32,  32, // Hidden';..  
+  32,  32, 118, 105, 115, 105,  98, 105, 108, 105, 116, 121, //   visibility
+  67, 104,  97, 110, 103, 101,  32,  61,  32,  39, 119, 101, // Change = 'we
+  98, 107, 105, 116, 118, 105, 115, 105,  98, 105, 108, 105, // bkitvisibili
+ 116, 121,  99, 104,  97, 110, 103, 101,  39,  59,  13,  10, // tychange';..
+ 125,  13,  10,  13,  10,  47,  47,  32,  87, 101,  98,  83, // }....// WebS
+ 111,  99, 107, 101, 116,  32,  99,  97, 108, 108, 101, 100, // ocket called
+  32, 111, 110,  32, 108, 111,  97, 100,  44,  32, 115, 116, //  on load, st
+ 114, 101,  97, 109, 115,  32, 102, 114, 111, 109,  32, 112, // reams from p
+ 105,  99, 111,  32, 116, 111,  32,  98, 114, 111, 119, 115, // ico to brows
+ 101, 114,  13,  10, 102, 117, 110,  99, 116, 105, 111, 110, // er..function
+  32, 115, 116, 114, 101,  97, 109,  83, 116,  97, 116, 117, //  streamStatu
+ 115,  40,  41,  32, 123,  13,  10,  32,  32,  32,  32, 105, // s() {..    i
+ 102,  32,  40,  33, 100, 111,  99, 117, 109, 101, 110, 116, // f (!document
+  91, 104, 105, 100, 100, 101, 110,  93,  41,  32, 123,  13, // [hidden]) {.
+  10,  32,  32,  32,  32,  32,  32,  32,  32,  99, 111, 110, // .        con
+ 115, 111, 108, 101,  46, 108, 111, 103,  40,  34,  86, 105, // sole.log("Vi
+ 115, 105,  98, 108, 101,  34,  41,  59,  13,  10,  32,  32, // sible");..  
   32,  32,  32,  32,  32,  32, 105, 102,  32,  40,  33, 119, //       if (!w
- 115,  41,  32, 114, 101, 116, 117, 114, 110,  59,  13,  10, // s) return;..
-  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, 119, 115, // ..        ws
-  46, 111, 110, 111, 112, 101, 110,  32,  61,  32, 102, 117, // .onopen = fu
- 110,  99, 116, 105, 111, 110,  40, 101, 118,  41,  32, 123, // nction(ev) {
-  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
-  32,  32,  99, 111, 110, 115, 111, 108, 101,  46, 108, 111, //   console.lo
- 103,  40,  39,  87, 101,  98,  83, 111,  99, 107, 101, 116, // g('WebSocket
-  32, 111, 112, 101, 110, 101, 100,  39,  41,  59,  13,  10, //  opened');..
-  32,  32,  32,  32,  32,  32,  32,  32, 125,  59,  13,  10, //         };..
+ 115,  41,  32, 123,  13,  10,  32,  32,  32,  32,  32,  32, // s) {..      
+  32,  32,  32,  32,  32,  32,  99, 111, 110, 115, 111, 108, //       consol
+ 101,  46, 108, 111, 103,  40,  34,  79, 112, 101, 110, 105, // e.log("Openi
+ 110, 103,  32, 119, 101,  98, 115, 111,  99, 107, 101, 116, // ng websocket
+  46,  46,  46,  34,  41,  59,  13,  10,  32,  32,  32,  32, // ...");..    
+  32,  32,  32,  32,  32,  32,  32,  32, 119, 115,  32,  61, //         ws =
+  32, 110, 101, 119,  32,  87, 101,  98,  83, 111,  99, 107, //  new WebSock
+ 101, 116,  40,  34, 119, 115,  58,  47,  47,  34,  32,  43, // et("ws://" +
+  32, 108, 111,  99,  97, 116, 105, 111, 110,  46, 104, 111, //  location.ho
+ 115, 116,  32,  43,  32,  34,  47, 119, 101,  98, 115, 111, // st + "/webso
+  99, 107, 101, 116,  34,  41,  59,  13,  10,  32,  32,  32, // cket");..   
+  32,  32,  32,  32,  32,  32,  32,  32,  32, 119, 115,  82, //          wsR
+ 101, 116, 114, 121,  65, 116, 116, 101, 109, 112, 116, 115, // etryAttempts
+  32,  61,  32,  48,  59,  13,  10,  32,  32,  32,  32,  32, //  = 0;..     
+  32,  32,  32,  32,  32,  32,  32, 111, 118, 101, 114, 108, //        overl
+  97, 121,  46,  99, 108,  97, 115, 115,  76, 105, 115, 116, // ay.classList
+  46,  97, 100, 100,  40,  39, 104, 105, 100, 100, 101, 110, // .add('hidden
+  39,  41,  59,  32,  47,  47,  32,  72, 105, 100, 101,  32, // '); // Hide 
+ 111, 118, 101, 114, 108,  97, 121,  13,  10,  32,  32,  32, // overlay..   
+  32,  32,  32,  32,  32, 125,  13,  10,  32,  32,  32,  32, //      }..    
+  32,  32,  32,  32, 105, 102,  32,  40,  33, 119, 115,  41, //     if (!ws)
+  32, 114, 101, 116, 117, 114, 110,  59,  13,  10,  13,  10, //  return;....
   32,  32,  32,  32,  32,  32,  32,  32, 119, 115,  46, 111, //         ws.o
- 110, 109, 101, 115, 115,  97, 103, 101,  32,  61,  32, 102, // nmessage = f
- 117, 110,  99, 116, 105, 111, 110,  40, 101, 118,  41,  32, // unction(ev) 
- 123,  32,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // { ..        
-  32,  32,  32,  32, 117, 112, 100,  97, 116, 101,  83, 116, //     updateSt
-  97, 116, 117, 115,  40, 101, 118,  46, 100,  97, 116,  97, // atus(ev.data
-  41,  59,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // );..        
- 125,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, 119, // }..        w
- 115,  46, 111, 110, 101, 114, 114, 111, 114,  32,  61,  32, // s.onerror = 
- 102, 117, 110,  99, 116, 105, 111, 110,  40, 101, 114, 114, // function(err
- 111, 114,  41,  32, 123,  32,  13,  10,  32,  32,  32,  32, // or) { ..    
+ 110, 111, 112, 101, 110,  32,  61,  32, 102, 117, 110,  99, // nopen = func
+ 116, 105, 111, 110,  40, 101, 118,  41,  32, 123,  13,  10, // tion(ev) {..
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
+  99, 111, 110, 115, 111, 108, 101,  46, 108, 111, 103,  40, // console.log(
+  39,  87, 101,  98,  83, 111,  99, 107, 101, 116,  32, 111, // 'WebSocket o
+ 112, 101, 110, 101, 100,  39,  41,  59,  13,  10,  32,  32, // pened');..  
+  32,  32,  32,  32,  32,  32, 125,  59,  13,  10,  32,  32, //       };..  
+  32,  32,  32,  32,  32,  32, 119, 115,  46, 111, 110, 109, //       ws.onm
+ 101, 115, 115,  97, 103, 101,  32,  61,  32, 102, 117, 110, // essage = fun
+  99, 116, 105, 111, 110,  40, 101, 118,  41,  32, 123,  32, // ction(ev) { 
+  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
+  32,  32, 117, 112, 100,  97, 116, 101,  83, 116,  97, 116, //   updateStat
+ 117, 115,  40, 101, 118,  46, 100,  97, 116,  97,  41,  59, // us(ev.data);
+  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, 125,  13, // ..        }.
+  10,  32,  32,  32,  32,  32,  32,  32,  32, 119, 115,  46, // .        ws.
+ 111, 110, 101, 114, 114, 111, 114,  32,  61,  32, 102, 117, // onerror = fu
+ 110,  99, 116, 105, 111, 110,  40, 101, 114, 114, 111, 114, // nction(error
+  41,  32, 123,  32,  13,  10,  32,  32,  32,  32,  32,  32, // ) { ..      
+  32,  32,  32,  32,  32,  32,  99, 111, 110, 115, 111, 108, //       consol
+ 101,  46, 108, 111, 103,  40,  39,  87, 101,  98,  83, 111, // e.log('WebSo
+  99, 107, 101, 116,  32, 101, 114, 114, 111, 114,  58,  39, // cket error:'
+  44,  32, 101, 114, 114, 111, 114,  41,  59,  13,  10,  32, // , error);.. 
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, 105, //            i
+ 102,  32,  40, 119, 115,  82, 101, 116, 114, 121,  65, 116, // f (wsRetryAt
+ 116, 101, 109, 112, 116, 115,  32,  60,  32, 109,  97, 120, // tempts < max
+  82, 101, 116, 114, 121,  65, 116, 116, 101, 109, 112, 116, // RetryAttempt
+ 115,  41,  32, 123,  13,  10,  32,  32,  32,  32,  32,  32, // s) {..      
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, 119, 115, //           ws
+  82, 101, 116, 114, 121,  65, 116, 116, 101, 109, 112, 116, // RetryAttempt
+ 115,  43,  43,  59,  13,  10,  32,  32,  32,  32,  32,  32, // s++;..      
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  99, 111, //           co
+ 110, 115, 111, 108, 101,  46, 108, 111, 103,  40,  39,  82, // nsole.log('R
+ 101,  99, 111, 110, 110, 101,  99, 116, 105, 110, 103,  46, // econnecting.
+  46,  46,  32,  97, 116, 116, 101, 109, 112, 116,  32,  35, // .. attempt #
+  39,  32,  43,  32, 119, 115,  82, 101, 116, 114, 121,  65, // ' + wsRetryA
+ 116, 116, 101, 109, 112, 116, 115,  41,  59,  13,  10,  32, // ttempts);.. 
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
+  32,  32,  32, 115, 101, 116,  84, 105, 109, 101, 111, 117, //    setTimeou
+ 116,  40, 115, 116, 114, 101,  97, 109,  83, 116,  97, 116, // t(streamStat
+ 117, 115,  44,  32, 114, 101, 116, 114, 121,  68, 101, 108, // us, retryDel
+  97, 121,  41,  59,  13,  10,  32,  32,  32,  32,  32,  32, // ay);..      
+  32,  32,  32,  32,  32,  32, 125,  13,  10,  32,  32,  32, //       }..   
+  32,  32,  32,  32,  32, 125,  13,  10,  32,  32,  32,  32, //      }..    
+  32,  32,  32,  32, 119, 115,  46, 111, 110,  99, 108, 111, //     ws.onclo
+ 115, 101,  32,  61,  32, 102, 117, 110,  99, 116, 105, 111, // se = functio
+ 110,  40,  41,  32, 123,  32,  13,  10,  32,  32,  32,  32, // n() { ..    
   32,  32,  32,  32,  32,  32,  32,  32,  99, 111, 110, 115, //         cons
  111, 108, 101,  46, 108, 111, 103,  40,  39,  87, 101,  98, // ole.log('Web
-  83, 111,  99, 107, 101, 116,  32, 101, 114, 114, 111, 114, // Socket error
-  58,  39,  44,  32, 101, 114, 114, 111, 114,  41,  59,  13, // :', error);.
-  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // .           
-  32, 105, 102,  32,  40, 119, 115,  82, 101, 116, 114, 121, //  if (wsRetry
-  65, 116, 116, 101, 109, 112, 116, 115,  32,  60,  32, 109, // Attempts < m
-  97, 120,  82, 101, 116, 114, 121,  65, 116, 116, 101, 109, // axRetryAttem
- 112, 116, 115,  41,  32, 123,  13,  10,  32,  32,  32,  32, // pts) {..    
+  83, 111,  99, 107, 101, 116,  32,  99, 108, 111, 115, 101, // Socket close
+ 100,  39,  41,  59,  13,  10,  32,  32,  32,  32,  32,  32, // d');..      
+  32,  32,  32,  32,  32,  32, 111, 118, 101, 114, 108,  97, //       overla
+ 121,  46,  99, 108,  97, 115, 115,  76, 105, 115, 116,  46, // y.classList.
+ 114, 101, 109, 111, 118, 101,  40,  39, 104, 105, 100, 100, // remove('hidd
+ 101, 110,  39,  41,  59,  32,  47,  47,  32,  83, 104, 111, // en'); // Sho
+ 119,  32, 111, 118, 101, 114, 108,  97, 121,  32,  97, 103, // w overlay ag
+  97, 105, 110,  13,  10,  32,  32,  32,  32,  32,  32,  32, // ain..       
+  32, 125,  13,  10,  32,  32,  32,  32, 125,  32, 101, 108, //  }..    } el
+ 115, 101,  32, 123,  13,  10,  32,  32,  32,  32,  32,  32, // se {..      
+  32,  32,  99, 111, 110, 115, 111, 108, 101,  46, 108, 111, //   console.lo
+ 103,  40,  34,  72, 105, 100, 100, 101, 110,  34,  41,  59, // g("Hidden");
+  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, 105, 102, // ..        if
+  32,  40, 119, 115,  41,  32, 123,  32,  13,  10,  32,  32, //  (ws) { ..  
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, 119, 115, //           ws
+  46,  99, 108, 111, 115, 101,  40,  41,  59,  32,  13,  10, // .close(); ..
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
- 119, 115,  82, 101, 116, 114, 121,  65, 116, 116, 101, 109, // wsRetryAttem
- 112, 116, 115,  43,  43,  59,  13,  10,  32,  32,  32,  32, // pts++;..    
+ 119, 115,  32,  61,  32, 110, 117, 108, 108,  59,  13,  10, // ws = null;..
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
   99, 111, 110, 115, 111, 108, 101,  46, 108, 111, 103,  40, // console.log(
-  39,  82, 101,  99, 111, 110, 110, 101,  99, 116, 105, 110, // 'Reconnectin
- 103,  46,  46,  46,  32,  97, 116, 116, 101, 109, 112, 116, // g... attempt
-  32,  35,  39,  32,  43,  32, 119, 115,  82, 101, 116, 114, //  #' + wsRetr
- 121,  65, 116, 116, 101, 109, 112, 116, 115,  41,  59,  13, // yAttempts);.
-  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // .           
-  32,  32,  32,  32,  32, 115, 101, 116,  84, 105, 109, 101, //      setTime
- 111, 117, 116,  40, 115, 116, 114, 101,  97, 109,  83, 116, // out(streamSt
-  97, 116, 117, 115,  44,  32, 114, 101, 116, 114, 121,  68, // atus, retryD
- 101, 108,  97, 121,  41,  59,  13,  10,  32,  32,  32,  32, // elay);..    
-  32,  32,  32,  32,  32,  32,  32,  32, 125,  13,  10,  32, //         }.. 
-  32,  32,  32,  32,  32,  32,  32, 125,  13,  10,  32,  32, //        }..  
-  32,  32,  32,  32,  32,  32, 119, 115,  46, 111, 110,  99, //       ws.onc
- 108, 111, 115, 101,  32,  61,  32, 102, 117, 110,  99, 116, // lose = funct
- 105, 111, 110,  40,  41,  32, 123,  32,  13,  10,  32,  32, // ion() { ..  
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  99, 111, //           co
- 110, 115, 111, 108, 101,  46, 108, 111, 103,  40,  39,  87, // nsole.log('W
- 101,  98,  83, 111,  99, 107, 101, 116,  32,  99, 108, 111, // ebSocket clo
- 115, 101, 100,  39,  41,  59,  13,  10,  32,  32,  32,  32, // sed');..    
-  32,  32,  32,  32,  32,  32,  32,  32, 111, 118, 101, 114, //         over
- 108,  97, 121,  46,  99, 108,  97, 115, 115,  76, 105, 115, // lay.classLis
- 116,  46, 114, 101, 109, 111, 118, 101,  40,  39, 104, 105, // t.remove('hi
- 100, 100, 101, 110,  39,  41,  59,  32,  47,  47,  32,  83, // dden'); // S
- 104, 111, 119,  32, 111, 118, 101, 114, 108,  97, 121,  32, // how overlay 
-  97, 103,  97, 105, 110,  13,  10,  32,  32,  32,  32,  32, // again..     
-  32,  32,  32, 125,  13,  10,  32,  32,  32,  32, 125,  32, //    }..    } 
- 101, 108, 115, 101,  32, 123,  13,  10,  32,  32,  32,  32, // else {..    
+  34,  67, 108, 111, 115, 101,  32, 119, 101,  98, 115, 111, // "Close webso
+  99, 107, 101, 116,  34,  41,  59,  13,  10,  32,  32,  32, // cket");..   
+  32,  32,  32,  32,  32,  32,  32,  32,  32, 111, 118, 101, //          ove
+ 114, 108,  97, 121,  46,  99, 108,  97, 115, 115,  76, 105, // rlay.classLi
+ 115, 116,  46, 114, 101, 109, 111, 118, 101,  40,  39, 104, // st.remove('h
+ 105, 100, 100, 101, 110,  39,  41,  59,  32,  47,  47,  32, // idden'); // 
+  83, 104, 111, 119,  32, 111, 118, 101, 114, 108,  97, 121, // Show overlay
+  32,  97, 103,  97, 105, 110,  13,  10,  32,  32,  32,  32, //  again..    
+  32,  32,  32,  32,  32,  32,  32,  32, 114, 101, 116, 117, //         retu
+ 114, 110,  59,  32,  13,  10,  32,  32,  32,  32,  32,  32, // rn; ..      
+  32,  32, 125,  13,  10,  32,  32,  32,  32, 125,  13,  10, //   }..    }..
+ 125,  13,  10,  13,  10,  47,  47,  32,  76, 101, 103,  97, // }....// Lega
+  99, 121,  32, 112, 111, 108, 108, 105, 110, 103,  32, 109, // cy polling m
+ 101, 116, 104, 111, 100,  32,  40, 110, 111, 116,  32, 117, // ethod (not u
+ 115, 101, 100,  41,  13,  10, 102, 117, 110,  99, 116, 105, // sed)..functi
+ 111, 110,  32, 103, 101, 116,  83, 116,  97, 116, 117, 115, // on getStatus
+  40,  41,  32, 123,  13,  10,  32,  32,  32,  32,  99, 111, // () {..    co
+ 110, 115, 116,  32, 106, 115, 111, 110,  68,  97, 116,  97, // nst jsonData
+  32,  61,  32, 123,  13,  10,  32,  32,  32,  32,  32,  32, //  = {..      
+  32,  32,  34,  97,  99, 116, 105, 111, 110,  34,  58,  32, //   "action": 
+  34, 103, 101, 116,  95, 115, 116,  97, 116, 117, 115,  34, // "get_status"
+  13,  10,  32,  32,  32,  32, 125,  59,  13,  10,  32,  32, // ..    };..  
+  32,  32,  47,  47,  32,  80, 111, 115, 116,  32,  98,  97, //   // Post ba
+  99, 107,  32, 116, 111,  32, 116, 104, 101,  32, 112, 121, // ck to the py
+ 116, 104, 111, 110,  32, 115, 101, 114, 118, 105,  99, 101, // thon service
+  13,  10,  32,  32,  32,  32,  99, 111, 110, 115, 116,  32, // ..    const 
+ 120, 104, 116, 116, 112,  32,  61,  32, 110, 101, 119,  32, // xhttp = new 
+  88,  77,  76,  72, 116, 116, 112,  82, 101, 113, 117, 101, // XMLHttpReque
+ 115, 116,  40,  41,  59,  13,  10,  32,  32,  32,  32, 120, // st();..    x
+ 104, 116, 116, 112,  46, 111, 110, 108, 111,  97, 100,  32, // http.onload 
+  61,  32, 102, 117, 110,  99, 116, 105, 111, 110,  40,  41, // = function()
+  32, 123,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, //  {..        
+ 117, 112, 100,  97, 116, 101,  83, 116,  97, 116, 117, 115, // updateStatus
+  40, 116, 104, 105, 115,  46, 114, 101, 115, 112, 111, 110, // (this.respon
+ 115, 101,  84, 101, 120, 116,  41,  59,  13,  10,  32,  32, // seText);..  
+  32,  32, 125,  13,  10,  32,  32,  32,  32, 120, 104, 116, //   }..    xht
+ 116, 112,  46, 111, 112, 101, 110,  40,  34,  80,  79,  83, // tp.open("POS
+  84,  34,  44,  32,  34,  47,  97, 112, 105,  34,  44,  32, // T", "/api", 
+ 116, 114, 117, 101,  41,  59,  13,  10,  32,  32,  32,  32, // true);..    
+ 120, 104, 116, 116, 112,  46, 115, 101, 116,  82, 101, 113, // xhttp.setReq
+ 117, 101, 115, 116,  72, 101,  97, 100, 101, 114,  40,  34, // uestHeader("
+  67, 111, 110, 116, 101, 110, 116,  45,  84, 121, 112, 101, // Content-Type
+  34,  44,  32,  34,  97, 112, 112, 108, 105,  99,  97, 116, // ", "applicat
+ 105, 111, 110,  47, 106, 115, 111, 110,  59,  99, 104,  97, // ion/json;cha
+ 114, 115, 101, 116,  61,  85,  84,  70,  45,  56,  34,  41, // rset=UTF-8")
+  59,  13,  10,  32,  32,  32,  32, 120, 104, 116, 116, 112, // ;..    xhttp
+  46, 115, 101, 110, 100,  40,  74,  83,  79,  78,  46, 115, // .send(JSON.s
+ 116, 114, 105, 110, 103, 105, 102, 121,  40, 106, 115, 111, // tringify(jso
+ 110,  68,  97, 116,  97,  41,  41,  59,  13,  10, 125,  13, // nData));..}.
+  10,  13,  10,  47,  47,  32,  80, 111, 112, 117, 108,  97, // ...// Popula
+ 116, 101,  32, 116, 104, 101,  32, 102, 105, 101, 108, 100, // te the field
+ 115,  32,  97, 110, 100,  32,  99, 111, 110, 116, 114, 111, // s and contro
+ 108, 115,  32, 119, 105, 116, 104,  32, 116, 104, 101,  32, // ls with the 
+  99, 117, 114, 114, 101, 110, 116,  32, 115, 116,  97, 116, // current stat
+ 117, 115,  32, 102, 114, 111, 109,  32, 116, 104, 101,  32, // us from the 
+  80, 105,  99, 111,  39, 115,  32,  74,  83,  79,  78,  32, // Pico's JSON 
+ 114, 101, 115, 112, 111, 110, 115, 101,  13,  10, 102, 117, // response..fu
+ 110,  99, 116, 105, 111, 110,  32, 117, 112, 100,  97, 116, // nction updat
+ 101,  83, 116,  97, 116, 117, 115,  40, 115, 116, 114,  82, // eStatus(strR
+ 101, 113, 117, 101, 115, 116,  41,  32, 123,  13,  10,  32, // equest) {.. 
+  32,  32,  32, 118,  97, 114,  32, 106, 115, 111, 110,  95, //    var json_
+ 114, 101, 115, 112, 111, 110, 115, 101,  32,  61,  32,  74, // response = J
+  83,  79,  78,  46, 112,  97, 114, 115, 101,  40, 115, 116, // SON.parse(st
+ 114,  82, 101, 113, 117, 101, 115, 116,  41,  59,  13,  10, // rRequest);..
   32,  32,  32,  32,  99, 111, 110, 115, 111, 108, 101,  46, //     console.
- 108, 111, 103,  40,  34,  72, 105, 100, 100, 101, 110,  34, // log("Hidden"
-  41,  59,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // );..        
- 105, 102,  32,  40, 119, 115,  41,  32, 123,  32,  13,  10, // if (ws) { ..
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
- 119, 115,  46,  99, 108, 111, 115, 101,  40,  41,  59,  32, // ws.close(); 
-  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
-  32,  32, 119, 115,  32,  61,  32, 110, 117, 108, 108,  59, //   ws = null;
-  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
-  32,  32,  99, 111, 110, 115, 111, 108, 101,  46, 108, 111, //   console.lo
- 103,  40,  34,  67, 108, 111, 115, 101,  32, 119, 101,  98, // g("Close web
- 115, 111,  99, 107, 101, 116,  34,  41,  59,  13,  10,  32, // socket");.. 
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, 111, //            o
- 118, 101, 114, 108,  97, 121,  46,  99, 108,  97, 115, 115, // verlay.class
-  76, 105, 115, 116,  46, 114, 101, 109, 111, 118, 101,  40, // List.remove(
-  39, 104, 105, 100, 100, 101, 110,  39,  41,  59,  32,  47, // 'hidden'); /
-  47,  32,  83, 104, 111, 119,  32, 111, 118, 101, 114, 108, // / Show overl
-  97, 121,  32,  97, 103,  97, 105, 110,  13,  10,  32,  32, // ay again..  
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, 114, 101, //           re
- 116, 117, 114, 110,  59,  32,  13,  10,  32,  32,  32,  32, // turn; ..    
-  32,  32,  32,  32, 125,  13,  10,  32,  32,  32,  32, 125, //     }..    }
-  13,  10, 125,  13,  10,  13,  10,  47,  47,  32,  76, 101, // ..}....// Le
- 103,  97,  99, 121,  32, 112, 111, 108, 108, 105, 110, 103, // gacy polling
-  32, 109, 101, 116, 104, 111, 100,  32,  40, 110, 111, 116, //  method (not
-  32, 117, 115, 101, 100,  41,  13,  10, 102, 117, 110,  99, //  used)..func
- 116, 105, 111, 110,  32, 103, 101, 116,  83, 116,  97, 116, // tion getStat
- 117, 115,  40,  41,  32, 123,  13,  10,  32,  32,  32,  32, // us() {..    
-  99, 111, 110, 115, 116,  32, 106, 115, 111, 110,  68,  97, // const jsonDa
- 116,  97,  32,  61,  32, 123,  13,  10,  32,  32,  32,  32, // ta = {..    
-  32,  32,  32,  32,  34,  97,  99, 116, 105, 111, 110,  34, //     "action"
-  58,  32,  34, 103, 101, 116,  95, 115, 116,  97, 116, 117, // : "get_statu
- 115,  34,  13,  10,  32,  32,  32,  32, 125,  59,  13,  10, // s"..    };..
-  32,  32,  32,  32,  47,  47,  32,  80, 111, 115, 116,  32, //     // Post 
-  98,  97,  99, 107,  32, 116, 111,  32, 116, 104, 101,  32, // back to the 
- 112, 121, 116, 104, 111, 110,  32, 115, 101, 114, 118, 105, // python servi
-  99, 101,  13,  10,  32,  32,  32,  32,  99, 111, 110, 115, // ce..    cons
- 116,  32, 120, 104, 116, 116, 112,  32,  61,  32, 110, 101, // t xhttp = ne
- 119,  32,  88,  77,  76,  72, 116, 116, 112,  82, 101, 113, // w XMLHttpReq
- 117, 101, 115, 116,  40,  41,  59,  13,  10,  32,  32,  32, // uest();..   
-  32, 120, 104, 116, 116, 112,  46, 111, 110, 108, 111,  97, //  xhttp.onloa
- 100,  32,  61,  32, 102, 117, 110,  99, 116, 105, 111, 110, // d = function
-  40,  41,  32, 123,  13,  10,  32,  32,  32,  32,  32,  32, // () {..      
-  32,  32, 117, 112, 100,  97, 116, 101,  83, 116,  97, 116, //   updateStat
- 117, 115,  40, 116, 104, 105, 115,  46, 114, 101, 115, 112, // us(this.resp
- 111, 110, 115, 101,  84, 101, 120, 116,  41,  59,  13,  10, // onseText);..
-  32,  32,  32,  32, 125,  13,  10,  32,  32,  32,  32, 120, //     }..    x
- 104, 116, 116, 112,  46, 111, 112, 101, 110,  40,  34,  80, // http.open("P
-  79,  83,  84,  34,  44,  32,  34,  47,  97, 112, 105,  34, // OST", "/api"
-  44,  32, 116, 114, 117, 101,  41,  59,  13,  10,  32,  32, // , true);..  
-  32,  32, 120, 104, 116, 116, 112,  46, 115, 101, 116,  82, //   xhttp.setR
- 101, 113, 117, 101, 115, 116,  72, 101,  97, 100, 101, 114, // equestHeader
-  40,  34,  67, 111, 110, 116, 101, 110, 116,  45,  84, 121, // ("Content-Ty
- 112, 101,  34,  44,  32,  34,  97, 112, 112, 108, 105,  99, // pe", "applic
-  97, 116, 105, 111, 110,  47, 106, 115, 111, 110,  59,  99, // ation/json;c
- 104,  97, 114, 115, 101, 116,  61,  85,  84,  70,  45,  56, // harset=UTF-8
-  34,  41,  59,  13,  10,  32,  32,  32,  32, 120, 104, 116, // ");..    xht
- 116, 112,  46, 115, 101, 110, 100,  40,  74,  83,  79,  78, // tp.send(JSON
-  46, 115, 116, 114, 105, 110, 103, 105, 102, 121,  40, 106, // .stringify(j
- 115, 111, 110,  68,  97, 116,  97,  41,  41,  59,  13,  10, // sonData));..
- 125,  13,  10,  13,  10,  47,  47,  32,  80, 111, 112, 117, // }....// Popu
- 108,  97, 116, 101,  32, 116, 104, 101,  32, 102, 105, 101, // late the fie
- 108, 100, 115,  32,  97, 110, 100,  32,  99, 111, 110, 116, // lds and cont
- 114, 111, 108, 115,  32, 119, 105, 116, 104,  32, 116, 104, // rols with th
- 101,  32,  99, 117, 114, 114, 101, 110, 116,  32, 115, 116, // e current st
-  97, 116, 117, 115,  32, 102, 114, 111, 109,  32, 116, 104, // atus from th
- 101,  32,  80, 105,  99, 111,  39, 115,  32,  74,  83,  79, // e Pico's JSO
-  78,  32, 114, 101, 115, 112, 111, 110, 115, 101,  13,  10, // N response..
- 102, 117, 110,  99, 116, 105, 111, 110,  32, 117, 112, 100, // function upd
-  97, 116, 101,  83, 116,  97, 116, 117, 115,  40, 115, 116, // ateStatus(st
- 114,  82, 101, 113, 117, 101, 115, 116,  41,  32, 123,  13, // rRequest) {.
-  10,  32,  32,  32,  32, 118,  97, 114,  32, 106, 115, 111, // .    var jso
- 110,  95, 114, 101, 115, 112, 111, 110, 115, 101,  32,  61, // n_response =
-  32,  74,  83,  79,  78,  46, 112,  97, 114, 115, 101,  40, //  JSON.parse(
- 115, 116, 114,  82, 101, 113, 117, 101, 115, 116,  41,  59, // strRequest);
-  13,  10,  32,  32,  32,  32,  99, 111, 110, 115, 111, 108, // ..    consol
- 101,  46, 108, 111, 103,  40, 106, 115, 111, 110,  95, 114, // e.log(json_r
- 101, 115, 112, 111, 110, 115, 101,  41,  59,  13,  10,  13, // esponse);...
-  10,  32,  32,  32,  32, 105, 102,  32,  40, 106, 115, 111, // .    if (jso
- 110,  95, 114, 101, 115, 112, 111, 110, 115, 101,  46, 115, // n_response.s
- 116,  97, 116, 117, 115,  32,  61,  61,  32,  34,  79,  75, // tatus == "OK
-  34,  41,  32, 123,  13,  10,  32,  32,  32,  32,  32,  32, // ") {..      
-  32,  32, 118,  97, 114,  32, 100,  97, 121,  79, 102,  87, //   var dayOfW
- 101, 101, 107,  32,  61,  32,  91,  34,  77, 111, 110,  34, // eek = ["Mon"
-  44,  32,  34,  84, 117, 101,  34,  44,  32,  34,  87, 101, // , "Tue", "We
- 100,  34,  44,  32,  34,  84, 104, 117,  34,  44,  32,  34, // d", "Thu", "
-  70, 114, 105,  34,  44,  32,  34,  83,  97, 116,  34,  44, // Fri", "Sat",
-  32,  34,  83, 117, 110,  34,  93,  59,  13,  10,  32,  32, //  "Sun"];..  
-  32,  32,  32,  32,  32,  32, 100, 111,  99, 117, 109, 101, //       docume
- 110, 116,  46, 103, 101, 116,  69, 108, 101, 109, 101, 110, // nt.getElemen
- 116,  66, 121,  73, 100,  40,  34, 108, 111,  99,  97, 108, // tById("local
-  84, 105, 109, 101,  34,  41,  46, 105, 110, 110, 101, 114, // Time").inner
-  72,  84,  77,  76,  32,  61,  32, 100,  97, 121,  79, 102, // HTML = dayOf
-  87, 101, 101, 107,  91, 106, 115, 111, 110,  95, 114, 101, // Week[json_re
- 115, 112, 111, 110, 115, 101,  46,  99, 117, 114, 114, 101, // sponse.curre
- 110, 116,  95, 100,  97, 121,  32,  45,  32,  49,  93,  32, // nt_day - 1] 
-  43,  32,  34,  32,  34,  32,  43,  32, 102, 111, 114, 109, // + " " + form
-  97, 116,  84, 105, 109, 101,  40, 106, 115, 111, 110,  95, // atTime(json_
- 114, 101, 115, 112, 111, 110, 115, 101,  46,  99, 117, 114, // response.cur
- 114, 101, 110, 116,  95, 116, 105, 109, 101,  41,  32,  43, // rent_time) +
-  32,  34,  32,  85,  84,  67,  34,  59,  13,  10,  32,  32, //  " UTC";..  
-  32,  32,  32,  32,  32,  32, 100, 111,  99, 117, 109, 101, //       docume
- 110, 116,  46, 103, 101, 116,  69, 108, 101, 109, 101, 110, // nt.getElemen
- 116,  66, 121,  73, 100,  40,  34,  98, 111, 111, 115, 116, // tById("boost
-  84, 105, 109, 101, 114,  34,  41,  46, 105, 110, 110, 101, // Timer").inne
- 114,  72,  84,  77,  76,  32,  61,  32, 102, 111, 114, 109, // rHTML = form
-  97, 116,  67, 111, 117, 110, 116, 100, 111, 119, 110,  40, // atCountdown(
- 106, 115, 111, 110,  95, 114, 101, 115, 112, 111, 110, 115, // json_respons
- 101,  46,  98, 111, 111, 115, 116,  95, 116, 105, 109, 101, // e.boost_time
- 114,  95,  99, 111, 117, 110, 116, 100, 111, 119, 110,  41, // r_countdown)
-  59,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, 100, // ;..        d
- 111,  99, 117, 109, 101, 110, 116,  46, 103, 101, 116,  69, // ocument.getE
- 108, 101, 109, 101, 110, 116,  66, 121,  73, 100,  40,  34, // lementById("
- 104, 101,  97, 116, 105, 110, 103,  83, 116,  97, 116, 101, // heatingState
-  34,  41,  46, 105, 110, 110, 101, 114,  72,  84,  77,  76, // ").innerHTML
-  32,  61,  32,  40, 106, 115, 111, 110,  95, 114, 101, 115, //  = (json_res
- 112, 111, 110, 115, 101,  46, 104, 101,  97, 116, 105, 110, // ponse.heatin
- 103,  95, 115, 116,  97, 116, 101,  32,  63,  32,  34,  69, // g_state ? "E
-  78,  65,  66,  76,  69,  68,  34,  32,  58,  32,  34,  68, // NABLED" : "D
-  73,  83,  65,  66,  76,  69,  68,  34,  41,  59,  13,  10, // ISABLED");..
+ 108, 111, 103,  40, 106, 115, 111, 110,  95, 114, 101, 115, // log(json_res
+ 112, 111, 110, 115, 101,  41,  59,  13,  10,  13,  10,  32, // ponse);.... 
+  32,  32,  32, 105, 102,  32,  40, 106, 115, 111, 110,  95, //    if (json_
+ 114, 101, 115, 112, 111, 110, 115, 101,  46, 115, 116,  97, // response.sta
+ 116, 117, 115,  32,  61,  61,  32,  34,  79,  75,  34,  41, // tus == "OK")
+  32, 123,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, //  {..        
+ 108,  97, 115, 116,  84, 105, 109, 101, 114, 115,  32,  61, // lastTimers =
+  32, 106, 115, 111, 110,  95, 114, 101, 115, 112, 111, 110, //  json_respon
+ 115, 101,  46, 116, 105, 109, 101, 114, 115,  59,  13,  10, // se.timers;..
+  32,  32,  32,  32,  32,  32,  32,  32, 118,  97, 114,  32, //         var 
+ 100,  97, 121,  79, 102,  87, 101, 101, 107,  32,  61,  32, // dayOfWeek = 
+  91,  34,  77, 111, 110,  34,  44,  32,  34,  84, 117, 101, // ["Mon", "Tue
+  34,  44,  32,  34,  87, 101, 100,  34,  44,  32,  34,  84, // ", "Wed", "T
+ 104, 117,  34,  44,  32,  34,  70, 114, 105,  34,  44,  32, // hu", "Fri", 
+  34,  83,  97, 116,  34,  44,  32,  34,  83, 117, 110,  34, // "Sat", "Sun"
+  93,  59,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // ];..        
+ 100, 111,  99, 117, 109, 101, 110, 116,  46, 103, 101, 116, // document.get
+  69, 108, 101, 109, 101, 110, 116,  66, 121,  73, 100,  40, // ElementById(
+  34, 108, 111,  99,  97, 108,  84, 105, 109, 101,  34,  41, // "localTime")
+  46, 105, 110, 110, 101, 114,  72,  84,  77,  76,  32,  61, // .innerHTML =
+  32, 100,  97, 121,  79, 102,  87, 101, 101, 107,  91, 106, //  dayOfWeek[j
+ 115, 111, 110,  95, 114, 101, 115, 112, 111, 110, 115, 101, // son_response
+  46,  99, 117, 114, 114, 101, 110, 116,  95, 100,  97, 121, // .current_day
+  32,  45,  32,  49,  93,  32,  43,  32,  34,  32,  34,  32, //  - 1] + " " 
+  43,  32, 102, 111, 114, 109,  97, 116,  84, 105, 109, 101, // + formatTime
+  40, 106, 115, 111, 110,  95, 114, 101, 115, 112, 111, 110, // (json_respon
+ 115, 101,  46,  99, 117, 114, 114, 101, 110, 116,  95, 116, // se.current_t
+ 105, 109, 101,  41,  59,  13,  10,  32,  32,  32,  32,  32, // ime);..     
+  32,  32,  32, 100, 111,  99, 117, 109, 101, 110, 116,  46, //    document.
+ 103, 101, 116,  69, 108, 101, 109, 101, 110, 116,  66, 121, // getElementBy
+  73, 100,  40,  34,  98, 111, 111, 115, 116,  84, 105, 109, // Id("boostTim
+ 101, 114,  34,  41,  46, 105, 110, 110, 101, 114,  72,  84, // er").innerHT
+  77,  76,  32,  61,  32, 102, 111, 114, 109,  97, 116,  67, // ML = formatC
+ 111, 117, 110, 116, 100, 111, 119, 110,  40, 106, 115, 111, // ountdown(jso
+ 110,  95, 114, 101, 115, 112, 111, 110, 115, 101,  46,  98, // n_response.b
+ 111, 111, 115, 116,  95, 116, 105, 109, 101, 114,  95,  99, // oost_timer_c
+ 111, 117, 110, 116, 100, 111, 119, 110,  41,  59,  13,  10, // ountdown);..
   32,  32,  32,  32,  32,  32,  32,  32, 100, 111,  99, 117, //         docu
  109, 101, 110, 116,  46, 103, 101, 116,  69, 108, 101, 109, // ment.getElem
- 101, 110, 116,  66, 121,  73, 100,  40,  34, 105, 115,  72, // entById("isH
- 101,  97, 116, 105, 110, 103,  34,  41,  46, 105, 110, 110, // eating").inn
- 101, 114,  72,  84,  77,  76,  32,  61,  32,  40, 106, 115, // erHTML = (js
- 111, 110,  95, 114, 101, 115, 112, 111, 110, 115, 101,  46, // on_response.
- 105, 115,  95, 104, 101,  97, 116, 105, 110, 103,  32,  63, // is_heating ?
-  32,  34,  79,  78,  34,  32,  58,  32,  34,  79,  70,  70, //  "ON" : "OFF
-  34,  41,  59,  13,  10,  32,  32,  32,  32,  32,  32,  32, // ");..       
+ 101, 110, 116,  66, 121,  73, 100,  40,  34, 104, 101,  97, // entById("hea
+ 116, 105, 110, 103,  83, 116,  97, 116, 101,  34,  41,  46, // tingState").
+ 105, 110, 110, 101, 114,  72,  84,  77,  76,  32,  61,  32, // innerHTML = 
+  40, 106, 115, 111, 110,  95, 114, 101, 115, 112, 111, 110, // (json_respon
+ 115, 101,  46, 104, 101,  97, 116, 105, 110, 103,  95, 115, // se.heating_s
+ 116,  97, 116, 101,  32,  63,  32,  34,  69,  78,  65,  66, // tate ? "ENAB
+  76,  69,  68,  34,  32,  58,  32,  34,  68,  73,  83,  65, // LED" : "DISA
+  66,  76,  69,  68,  34,  41,  59,  13,  10,  32,  32,  32, // BLED");..   
+  32,  32,  32,  32,  32, 100, 111,  99, 117, 109, 101, 110, //      documen
+ 116,  46, 103, 101, 116,  69, 108, 101, 109, 101, 110, 116, // t.getElement
+  66, 121,  73, 100,  40,  34, 105, 115,  72, 101,  97, 116, // ById("isHeat
+ 105, 110, 103,  34,  41,  46, 105, 110, 110, 101, 114,  72, // ing").innerH
+  84,  77,  76,  32,  61,  32,  40, 106, 115, 111, 110,  95, // TML = (json_
+ 114, 101, 115, 112, 111, 110, 115, 101,  46, 105, 115,  95, // response.is_
+ 104, 101,  97, 116, 105, 110, 103,  32,  63,  32,  34,  79, // heating ? "O
+  78,  34,  32,  58,  32,  34,  79,  70,  70,  34,  41,  59, // N" : "OFF");
+  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, 100, 111, // ..        do
+  99, 117, 109, 101, 110, 116,  46, 103, 101, 116,  69, 108, // cument.getEl
+ 101, 109, 101, 110, 116,  66, 121,  73, 100,  40,  34, 101, // ementById("e
+ 110, 101, 114, 103, 121,  84, 111, 100,  97, 121,  34,  41, // nergyToday")
+  46, 105, 110, 110, 101, 114,  72,  84,  77,  76,  32,  61, // .innerHTML =
+  32,  40, 106, 115, 111, 110,  95, 114, 101, 115, 112, 111, //  (json_respo
+ 110, 115, 101,  46, 101, 110, 101, 114, 103, 121,  95, 116, // nse.energy_t
+ 111, 100,  97, 121,  95, 119, 104,  32,  47,  32,  49,  48, // oday_wh / 10
+  48,  48,  41,  46, 116, 111,  70, 105, 120, 101, 100,  40, // 00).toFixed(
+  50,  41,  59,  13,  10,  32,  32,  32,  32,  32,  32,  32, // 2);..       
   32, 105, 102,  32,  40,  33, 105, 115,  67, 104,  97, 110, //  if (!isChan
  103, 105, 110, 103,  41,  32, 123,  13,  10,  32,  32,  32, // ging) {..   
   32,  32,  32,  32,  32,  32,  32,  32,  32,  99, 111, 110, //          con
@@ -718,233 +739,328 @@ static const unsigned char v1[] = {
  116, 101,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // te..        
  125,  13,  10,  13,  10,  32,  32,  32,  32,  32,  32,  32, // }....       
   32,  47,  47,  32,  65, 112, 112, 108, 121,  32, 116, 104, //  // Apply th
- 101,  32,  99, 104,  97, 110, 103, 101, 115,  13,  10,  32, // e changes.. 
-  32,  32,  32,  32,  32,  32,  32,  99, 111, 110, 115, 116, //        const
-  32, 106, 115, 111, 110,  68,  97, 116,  97,  32,  61,  32, //  jsonData = 
+ 101,  32,  99, 104,  97, 110, 103, 101, 115,  32,  97, 115, // e changes as
+  32, 111, 110, 101,  32, 115, 101, 116,  95,  99, 111, 110, //  one set_con
+ 102, 105, 103,  44,  32, 119, 105, 116, 104,  32, 116, 104, // fig, with th
+ 101,  32, 111, 116, 104, 101, 114,  32, 116, 105, 109, 101, // e other time
+ 114, 115,  32,  97, 115,  32, 116, 104, 101, 121,  32, 119, // rs as they w
+ 101, 114, 101,  32, 105, 110,  32, 116, 104, 101,  32, 108, // ere in the l
+  97, 115, 116,  32, 115, 116,  97, 116, 117, 115,  13,  10, // ast status..
+  32,  32,  32,  32,  32,  32,  32,  32, 105, 102,  32,  40, //         if (
+ 108,  97, 115, 116,  84, 105, 109, 101, 114, 115,  46, 108, // lastTimers.l
+ 101, 110, 103, 116, 104,  32,  33,  61,  32,  54,  41,  32, // ength != 6) 
  123,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32, // {..         
-  32,  32,  32,  34,  97,  99, 116, 105, 111, 110,  34,  58, //    "action":
-  32,  34, 115, 101, 116,  95, 116, 105, 109, 101, 114,  34, //  "set_timer"
-  44,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ,..         
-  32,  32,  32,  34, 116, 105, 109, 101, 114,  95, 110, 117, //    "timer_nu
- 109,  98, 101, 114,  34,  58,  32, 116, 105, 109, 101, 114, // mber": timer
-  44,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ,..         
-  32,  32,  32,  34, 110, 101, 119,  95, 100,  97, 121, 115, //    "new_days
-  34,  58,  32, 110, 101, 119,  68,  97, 121, 115,  44,  13, // ": newDays,.
-  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // .           
-  32,  34, 110, 101, 119,  95, 111, 110,  95, 116, 105, 109, //  "new_on_tim
- 101,  34,  58,  32,  43, 100, 111,  99, 117, 109, 101, 110, // e": +documen
+  32,  32,  32,  97, 108, 101, 114, 116,  40,  34,  69, 114, //    alert("Er
+ 114, 111, 114,  32, 115, 101, 116, 116, 105, 110, 103,  32, // ror setting 
+ 116, 105, 109, 101, 114,  58,  32, 116, 104, 101,  32, 116, // timer: the t
+ 105, 109, 101, 114, 115,  32, 104,  97, 118, 101,  32, 110, // imers have n
+ 111, 116,  32,  98, 101, 101, 110,  32, 108, 111,  97, 100, // ot been load
+ 101, 100,  32, 121, 101, 116,  34,  41,  59,  13,  10,  32, // ed yet");.. 
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, 114, //            r
+ 101, 116, 117, 114, 110,  59,  13,  10,  32,  32,  32,  32, // eturn;..    
+  32,  32,  32,  32, 125,  13,  10,  32,  32,  32,  32,  32, //     }..     
+  32,  32,  32,  99, 111, 110, 115, 116,  32, 116, 105, 109, //    const tim
+ 101, 114,  65, 114, 114,  32,  61,  32, 108,  97, 115, 116, // erArr = last
+  84, 105, 109, 101, 114, 115,  46, 109,  97, 112,  40, 102, // Timers.map(f
+ 117, 110,  99, 116, 105, 111, 110,  40, 116,  41,  32, 123, // unction(t) {
+  32, 114, 101, 116, 117, 114, 110,  32, 116,  46, 115, 108, //  return t.sl
+ 105,  99, 101,  40,  41,  59,  32, 125,  41,  59,  13,  10, // ice(); });..
+  32,  32,  32,  32,  32,  32,  32,  32, 116, 105, 109, 101, //         time
+ 114,  65, 114, 114,  91, 116, 105, 109, 101, 114,  32,  45, // rArr[timer -
+  32,  49,  93,  32,  61,  32,  91, 110, 101, 119,  68,  97, //  1] = [newDa
+ 121, 115,  44,  32,  43, 100, 111,  99, 117, 109, 101, 110, // ys, +documen
  116,  46, 103, 101, 116,  69, 108, 101, 109, 101, 110, 116, // t.getElement
   66, 121,  73, 100,  40,  34, 116,  34,  32,  43,  32, 116, // ById("t" + t
  105, 109, 101, 114,  32,  43,  32,  34,  79, 110,  73, 110, // imer + "OnIn
  112, 117, 116,  34,  41,  46, 118,  97, 108, 117, 101,  44, // put").value,
-  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
-  32,  32,  34, 110, 101, 119,  95, 111, 102, 102,  95, 116, //   "new_off_t
- 105, 109, 101,  34,  58,  32,  43, 100, 111,  99, 117, 109, // ime": +docum
- 101, 110, 116,  46, 103, 101, 116,  69, 108, 101, 109, 101, // ent.getEleme
- 110, 116,  66, 121,  73, 100,  40,  34, 116,  34,  32,  43, // ntById("t" +
-  32, 116, 105, 109, 101, 114,  32,  43,  32,  34,  79, 102, //  timer + "Of
- 102,  73, 110, 112, 117, 116,  34,  41,  46, 118,  97, 108, // fInput").val
- 117, 101,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // ue..        
- 125,  59,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // };..        
-  47,  47,  32,  80, 111, 115, 116,  32,  98,  97,  99, 107, // // Post back
-  32, 116, 111,  32, 116, 104, 101,  32, 112, 121, 116, 104, //  to the pyth
- 111, 110,  32, 115, 101, 114, 118, 105,  99, 101,  13,  10, // on service..
-  32,  32,  32,  32,  32,  32,  32,  32,  99, 111, 110, 115, //         cons
- 116,  32, 120, 104, 116, 116, 112,  32,  61,  32, 110, 101, // t xhttp = ne
- 119,  32,  88,  77,  76,  72, 116, 116, 112,  82, 101, 113, // w XMLHttpReq
- 117, 101, 115, 116,  40,  41,  59,  13,  10,  32,  32,  32, // uest();..   
-  32,  32,  32,  32,  32, 120, 104, 116, 116, 112,  46, 111, //      xhttp.o
- 110, 108, 111,  97, 100,  32,  61,  32, 102, 117, 110,  99, // nload = func
- 116, 105, 111, 110,  40,  41,  32, 123,  13,  10,  32,  32, // tion() {..  
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, 118,  97, //           va
- 114,  32, 106, 115, 111, 110,  95, 114, 101, 115, 112, 111, // r json_respo
- 110, 115, 101,  32,  61,  32,  74,  83,  79,  78,  46, 112, // nse = JSON.p
-  97, 114, 115, 101,  40, 116, 104, 105, 115,  46, 114, 101, // arse(this.re
- 115, 112, 111, 110, 115, 101,  84, 101, 120, 116,  41,  59, // sponseText);
-  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
-  32,  32,  99, 111, 110, 115, 111, 108, 101,  46, 108, 111, //   console.lo
- 103,  40, 106, 115, 111, 110,  95, 114, 101, 115, 112, 111, // g(json_respo
- 110, 115, 101,  41,  59,  13,  10,  13,  10,  32,  32,  32, // nse);....   
-  32,  32,  32,  32,  32,  32,  32,  32,  32, 105, 102,  32, //          if 
-  40, 106, 115, 111, 110,  95, 114, 101, 115, 112, 111, 110, // (json_respon
- 115, 101,  46, 115, 116,  97, 116, 117, 115,  32,  33,  61, // se.status !=
-  32,  34,  79,  75,  34,  41,  32, 123,  13,  10,  32,  32, //  "OK") {..  
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  32,  97, 108, 101, 114, 116,  40,  34,  69, 114, 114, //   alert("Err
- 111, 114,  32, 115, 101, 116, 116, 105, 110, 103,  32, 116, // or setting t
- 105, 109, 101, 114,  58,  32,  34,  32,  43,  32, 106, 115, // imer: " + js
- 111, 110,  95, 114, 101, 115, 112, 111, 110, 115, 101,  46, // on_response.
- 109, 101, 115, 115,  97, 103, 101,  41,  59,  13,  10,  32, // message);.. 
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, 125, //            }
-  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, 125,  13, // ..        }.
-  10,  32,  32,  32,  32,  32,  32,  32,  32, 120, 104, 116, // .        xht
- 116, 112,  46, 111, 112, 101, 110,  40,  34,  80,  79,  83, // tp.open("POS
-  84,  34,  44,  32,  34,  47,  97, 112, 105,  34,  44,  32, // T", "/api", 
- 116, 114, 117, 101,  41,  59,  13,  10,  32,  32,  32,  32, // true);..    
-  32,  32,  32,  32, 120, 104, 116, 116, 112,  46, 115, 101, //     xhttp.se
- 116,  82, 101, 113, 117, 101, 115, 116,  72, 101,  97, 100, // tRequestHead
- 101, 114,  40,  34,  67, 111, 110, 116, 101, 110, 116,  45, // er("Content-
-  84, 121, 112, 101,  34,  44,  32,  34,  97, 112, 112, 108, // Type", "appl
- 105,  99,  97, 116, 105, 111, 110,  47, 106, 115, 111, 110, // ication/json
-  59,  99, 104,  97, 114, 115, 101, 116,  61,  85,  84,  70, // ;charset=UTF
-  45,  56,  34,  41,  59,  13,  10,  32,  32,  32,  32,  32, // -8");..     
-  32,  32,  32, 120, 104, 116, 116, 112,  46, 115, 101, 110, //    xhttp.sen
- 100,  40,  74,  83,  79,  78,  46, 115, 116, 114, 105, 110, // d(JSON.strin
- 103, 105, 102, 121,  40, 106, 115, 111, 110,  68,  97, 116, // gify(jsonDat
-  97,  41,  41,  59,  13,  10,  13,  10,  32,  32,  32,  32, // a));....    
-  32,  32,  32,  32,  47,  47,  32,  68, 105, 115,  97,  98, //     // Disab
- 108, 101,  32,  99, 111, 110, 116, 114, 111, 108, 115,  13, // le controls.
-  10,  32,  32,  32,  32,  32,  32,  32,  32, 116, 111, 103, // .        tog
- 103, 108, 101,  67, 111, 110, 116, 114, 111, 108, 115,  68, // gleControlsD
- 105, 115,  97,  98, 108, 101, 100,  40, 116, 105, 109, 101, // isabled(time
- 114,  44,  32, 116, 114, 117, 101,  41,  59,  13,  10,  32, // r, true);.. 
-  32,  32,  32,  32,  32,  32,  32,  47,  47,  32,  67, 104, //        // Ch
-  97, 110, 103, 101,  32, 116, 111,  32, 101, 100, 105, 116, // ange to edit
-  32, 105,  99, 111, 110,  13,  10,  32,  32,  32,  32,  32, //  icon..     
+  32,  43, 100, 111,  99, 117, 109, 101, 110, 116,  46, 103, //  +document.g
+ 101, 116,  69, 108, 101, 109, 101, 110, 116,  66, 121,  73, // etElementByI
+ 100,  40,  34, 116,  34,  32,  43,  32, 116, 105, 109, 101, // d("t" + time
+ 114,  32,  43,  32,  34,  79, 102, 102,  73, 110, 112, 117, // r + "OffInpu
+ 116,  34,  41,  46, 118,  97, 108, 117, 101,  93,  59,  13, // t").value];.
+  10,  32,  32,  32,  32,  32,  32,  32,  32, 115, 101, 116, // .        set
+  67, 111, 110, 102, 105, 103,  40, 123,  32,  34, 116, 105, // Config({ "ti
+ 109, 101, 114, 115,  34,  58,  32, 116, 105, 109, 101, 114, // mers": timer
+  65, 114, 114,  32, 125,  41,  59,  13,  10,  13,  10,  32, // Arr });.... 
+  32,  32,  32,  32,  32,  32,  32,  47,  47,  32,  68, 105, //        // Di
+ 115,  97,  98, 108, 101,  32,  99, 111, 110, 116, 114, 111, // sable contro
+ 108, 115,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // ls..        
+ 116, 111, 103, 103, 108, 101,  67, 111, 110, 116, 114, 111, // toggleContro
+ 108, 115,  68, 105, 115,  97,  98, 108, 101, 100,  40, 116, // lsDisabled(t
+ 105, 109, 101, 114,  44,  32, 116, 114, 117, 101,  41,  59, // imer, true);
+  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  47,  47, // ..        //
+  32,  67, 104,  97, 110, 103, 101,  32, 116, 111,  32, 101, //  Change to e
+ 100, 105, 116,  32, 105,  99, 111, 110,  13,  10,  32,  32, // dit icon..  
+  32,  32,  32,  32,  32,  32, 100, 111,  99, 117, 109, 101, //       docume
+ 110, 116,  46, 103, 101, 116,  69, 108, 101, 109, 101, 110, // nt.getElemen
+ 116,  66, 121,  73, 100,  40,  34,  98, 116, 110,  84,  34, // tById("btnT"
+  32,  43,  32, 116, 105, 109, 101, 114,  41,  46, 105, 110, //  + timer).in
+ 110, 101, 114,  72,  84,  77,  76,  32,  61,  32,  34,  38, // nerHTML = "&
+  35, 120,  49,  70,  52,  68,  68,  59,  34,  59,  13,  10, // #x1F4DD;";..
+  32,  32,  32,  32,  32,  32,  32,  32,  47,  47,  32,  72, //         // H
+ 105, 100, 101,  32,  99,  97, 110,  99, 101, 108,  32,  98, // ide cancel b
+ 117, 116, 116, 111, 110,  13,  10,  32,  32,  32,  32,  32, // utton..     
   32,  32,  32, 100, 111,  99, 117, 109, 101, 110, 116,  46, //    document.
  103, 101, 116,  69, 108, 101, 109, 101, 110, 116,  66, 121, // getElementBy
-  73, 100,  40,  34,  98, 116, 110,  84,  34,  32,  43,  32, // Id("btnT" + 
- 116, 105, 109, 101, 114,  41,  46, 105, 110, 110, 101, 114, // timer).inner
-  72,  84,  77,  76,  32,  61,  32,  34,  38,  35, 120,  49, // HTML = "&#x1
-  70,  52,  68,  68,  59,  34,  59,  13,  10,  32,  32,  32, // F4DD;";..   
-  32,  32,  32,  32,  32,  47,  47,  32,  72, 105, 100, 101, //      // Hide
-  32,  99,  97, 110,  99, 101, 108,  32,  98, 117, 116, 116, //  cancel butt
- 111, 110,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // on..        
- 100, 111,  99, 117, 109, 101, 110, 116,  46, 103, 101, 116, // document.get
-  69, 108, 101, 109, 101, 110, 116,  66, 121,  73, 100,  40, // ElementById(
-  34,  98, 116, 110,  67,  34,  32,  43,  32, 116, 105, 109, // "btnC" + tim
- 101, 114,  41,  46, 115, 116, 121, 108, 101,  46, 100, 105, // er).style.di
- 115, 112, 108,  97, 121,  61,  34, 110, 111, 110, 101,  34, // splay="none"
-  59,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  47, // ;..        /
-  47,  32,  68, 101, 108,  97, 121,  32, 114, 101, 115, 117, // / Delay resu
- 109, 105, 110, 103,  32, 116, 104, 101,  32,  83,  83,  69, // ming the SSE
-  32,  98, 121,  32, 111, 118, 101, 114,  32,  97,  32, 115, //  by over a s
- 101,  99, 111, 110, 100,  44,  32,  97, 108, 108, 111, 119, // econd, allow
- 105, 110, 103,  32, 116, 105, 109, 101,  32, 102, 111, 114, // ing time for
-  32, 116, 104, 101,  32,  80, 105,  99, 111,  32, 116, 111, //  the Pico to
-  32, 114, 101,  99, 101, 105, 118, 101,  32,  97, 110, 100, //  receive and
-  32, 114, 101, 115, 112, 111, 110, 115, 101,  32, 119, 105, //  response wi
- 116, 104,  32, 116, 104, 101,  32, 110, 101, 119,  32, 115, // th the new s
- 116,  97, 116, 101,  13,  10,  32,  32,  32,  32,  32,  32, // tate..      
-  32,  32, 115, 101, 116,  84, 105, 109, 101, 111, 117, 116, //   setTimeout
-  40, 101, 110, 100,  67, 104,  97, 110, 103, 101,  40,  41, // (endChange()
-  44,  32,  49,  50,  48,  48,  41,  59,  13,  10,  32,  32, // , 1200);..  
-  32,  32, 125,  13,  10, 125,  13,  10,  13,  10, 102, 117, //   }..}....fu
- 110,  99, 116, 105, 111, 110,  32,  99,  97, 110,  99, 101, // nction cance
- 108,  84, 105, 109, 101, 114,  40, 116, 105, 109, 101, 114, // lTimer(timer
-  41,  32, 123,  13,  10,  32,  32,  32,  32,  47,  47,  32, // ) {..    // 
-  68, 105, 115,  97,  98, 108, 101,  32,  99, 111, 110, 116, // Disable cont
- 114, 111, 108, 115,  13,  10,  32,  32,  32,  32, 116, 111, // rols..    to
- 103, 103, 108, 101,  67, 111, 110, 116, 114, 111, 108, 115, // ggleControls
-  68, 105, 115,  97,  98, 108, 101, 100,  40, 116, 105, 109, // Disabled(tim
- 101, 114,  44,  32, 116, 114, 117, 101,  41,  59,  13,  10, // er, true);..
-  32,  32,  32,  32,  47,  47,  32,  67, 104,  97, 110, 103, //     // Chang
- 101,  32, 116, 111,  32, 101, 100, 105, 116,  32, 105,  99, // e to edit ic
- 111, 110,  13,  10,  32,  32,  32,  32, 100, 111,  99, 117, // on..    docu
- 109, 101, 110, 116,  46, 103, 101, 116,  69, 108, 101, 109, // ment.getElem
- 101, 110, 116,  66, 121,  73, 100,  40,  34,  98, 116, 110, // entById("btn
-  84,  34,  32,  43,  32, 116, 105, 109, 101, 114,  41,  46, // T" + timer).
- 105, 110, 110, 101, 114,  72,  84,  77,  76,  32,  61,  32, // innerHTML = 
-  34,  38,  35, 120,  49,  70,  52,  68,  68,  59,  34,  59, // "&#x1F4DD;";
-  13,  10,  32,  32,  32,  32,  47,  47,  32,  72, 105, 100, // ..    // Hid
- 101,  32,  99,  97, 110,  99, 101, 108,  32,  98, 117, 116, // e cancel but
- 116, 111, 110,  13,  10,  32,  32,  32,  32, 100, 111,  99, // ton..    doc
- 117, 109, 101, 110, 116,  46, 103, 101, 116,  69, 108, 101, // ument.getEle
- 109, 101, 110, 116,  66, 121,  73, 100,  40,  34,  98, 116, // mentById("bt
- 110,  67,  34,  32,  43,  32, 116, 105, 109, 101, 114,  41, // nC" + timer)
-  46, 115, 116, 121, 108, 101,  46, 100, 105, 115, 112, 108, // .style.displ
-  97, 121,  61,  34, 110, 111, 110, 101,  34,  59,  13,  10, // ay="none";..
-  32,  32,  32,  32, 101, 110, 100,  67, 104,  97, 110, 103, //     endChang
- 101,  40,  41,  59,  13,  10, 125,  13,  10,  13,  10, 102, // e();..}....f
- 117, 110,  99, 116, 105, 111, 110,  32, 116, 111, 103, 103, // unction togg
+  73, 100,  40,  34,  98, 116, 110,  67,  34,  32,  43,  32, // Id("btnC" + 
+ 116, 105, 109, 101, 114,  41,  46, 115, 116, 121, 108, 101, // timer).style
+  46, 100, 105, 115, 112, 108,  97, 121,  61,  34, 110, 111, // .display="no
+ 110, 101,  34,  59,  13,  10,  32,  32,  32,  32,  32,  32, // ne";..      
+  32,  32,  47,  47,  32,  68, 101, 108,  97, 121,  32, 114, //   // Delay r
+ 101, 115, 117, 109, 105, 110, 103,  32, 116, 104, 101,  32, // esuming the 
+  83,  83,  69,  32,  98, 121,  32, 111, 118, 101, 114,  32, // SSE by over 
+  97,  32, 115, 101,  99, 111, 110, 100,  44,  32,  97, 108, // a second, al
+ 108, 111, 119, 105, 110, 103,  32, 116, 105, 109, 101,  32, // lowing time 
+ 102, 111, 114,  32, 116, 104, 101,  32,  80, 105,  99, 111, // for the Pico
+  32, 116, 111,  32, 114, 101,  99, 101, 105, 118, 101,  32, //  to receive 
+  97, 110, 100,  32, 114, 101, 115, 112, 111, 110, 115, 101, // and response
+  32, 119, 105, 116, 104,  32, 116, 104, 101,  32, 110, 101, //  with the ne
+ 119,  32, 115, 116,  97, 116, 101,  13,  10,  32,  32,  32, // w state..   
+  32,  32,  32,  32,  32, 115, 101, 116,  84, 105, 109, 101, //      setTime
+ 111, 117, 116,  40, 101, 110, 100,  67, 104,  97, 110, 103, // out(endChang
+ 101,  40,  41,  44,  32,  49,  50,  48,  48,  41,  59,  13, // e(), 1200);.
+  10,  32,  32,  32,  32, 125,  13,  10, 125,  13,  10,  13, // .    }..}...
+  10,  47,  47,  32,  67, 111, 112, 121,  32, 111, 110, 101, // .// Copy one
+  32, 116, 105, 109, 101, 114,  39, 115,  32, 100,  97, 121, //  timer's day
+ 115,  32,  97, 110, 100,  32, 111, 110,  47, 111, 102, 102, // s and on/off
+  32, 116, 105, 109, 101, 115,  32, 116, 111,  32, 101, 118, //  times to ev
+ 101, 114, 121,  32, 116, 105, 109, 101, 114,  44,  32,  97, // ery timer, a
+ 112, 112, 108, 105, 101, 100,  32, 105, 110,  32,  97,  32, // pplied in a 
+ 115, 105, 110, 103, 108, 101,  32, 114, 101, 113, 117, 101, // single reque
+ 115, 116,  13,  10, 102, 117, 110,  99, 116, 105, 111, 110, // st..function
+  32,  99, 111, 112, 121,  84, 105, 109, 101, 114,  84, 111, //  copyTimerTo
+  65, 108, 108,  40, 116, 105, 109, 101, 114,  41,  32, 123, // All(timer) {
+  13,  10,  32,  32,  32,  32, 105, 102,  32,  40,  33,  99, // ..    if (!c
+ 111, 110, 102, 105, 114, 109,  40,  34,  67, 111, 112, 121, // onfirm("Copy
+  32, 116, 105, 109, 101, 114,  32,  34,  32,  43,  32, 116, //  timer " + t
+ 105, 109, 101, 114,  32,  43,  32,  34,  32, 116, 111,  32, // imer + " to 
+  97, 108, 108,  32, 116, 105, 109, 101, 114, 115,  63,  34, // all timers?"
+  41,  41,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // ))..        
+ 114, 101, 116, 117, 114, 110,  59,  13,  10,  32,  32,  32, // return;..   
+  32, 118,  97, 114,  32, 110, 101, 119,  68,  97, 121, 115, //  var newDays
+  32,  61,  32,  48,  59,  13,  10,  32,  32,  32,  32, 118, //  = 0;..    v
+  97, 114,  32, 100,  97, 121, 115,  84, 101, 115, 116,  32, // ar daysTest 
+  61,  32,  49,  59,  13,  10,  32,  32,  32,  32,  47,  47, // = 1;..    //
+  32,  76, 111, 111, 112,  32, 102, 114, 111, 109,  32,  49, //  Loop from 1
+  32, 116, 111,  32,  55,  32,  45,  32,  49,  32,  61,  32, //  to 7 - 1 = 
+  77, 111, 110, 100,  97, 121,  13,  10,  32,  32,  32,  32, // Monday..    
+ 102, 111, 114,  32,  40, 118,  97, 114,  32, 105,  32,  61, // for (var i =
+  32,  49,  59,  32, 105,  32,  60,  32,  56,  59,  32, 105, //  1; i < 8; i
+  43,  43,  41,  32, 123,  13,  10,  32,  32,  32,  32,  32, // ++) {..     
+  32,  32,  32,  47,  47,  32,  73, 102,  32, 116, 104, 101, //    // If the
+  32, 100,  97, 121,  32, 105, 115,  32,  99, 104, 101,  99, //  day is chec
+ 107, 101, 100,  44,  32,  97, 100, 100,  32, 111, 110,  32, // ked, add on 
+ 116, 104, 101,  32, 116, 101, 115, 116,  32,  98, 121, 116, // the test byt
+ 101,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, 105, // e..        i
+ 102,  32,  40, 100, 111,  99, 117, 109, 101, 110, 116,  46, // f (document.
+ 103, 101, 116,  69, 108, 101, 109, 101, 110, 116,  66, 121, // getElementBy
+  73, 100,  40,  34, 116,  34,  32,  43,  32, 116, 105, 109, // Id("t" + tim
+ 101, 114,  32,  43,  32,  34,  68,  97, 121,  34,  32,  43, // er + "Day" +
+  32, 105,  41,  46,  99, 104, 101,  99, 107, 101, 100,  41, //  i).checked)
+  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
+  32,  32, 110, 101, 119,  68,  97, 121, 115,  32,  43,  61, //   newDays +=
+  32, 100,  97, 121, 115,  84, 101, 115, 116,  59,  13,  10, //  daysTest;..
+  32,  32,  32,  32,  32,  32,  32,  32, 100,  97, 121, 115, //         days
+  84, 101, 115, 116,  32,  60,  60,  61,  32,  49,  59,  32, // Test <<= 1; 
+  47,  47,  32,  83, 104, 105, 102, 116,  32,  98, 105, 116, // // Shift bit
+  32, 108, 101, 102, 116,  32, 105, 110,  32, 116, 104, 101, //  left in the
+  32, 116, 101, 115, 116,  32,  98, 121, 116, 101,  13,  10, //  test byte..
+  32,  32,  32,  32, 125,  13,  10,  32,  32,  32,  32,  99, //     }..    c
+ 111, 110, 115, 116,  32, 116, 105, 109, 101, 114,  65, 114, // onst timerAr
+ 114,  32,  61,  32,  91,  93,  59,  13,  10,  32,  32,  32, // r = [];..   
+  32, 102, 111, 114,  32,  40, 118,  97, 114,  32, 105,  32, //  for (var i 
+  61,  32,  48,  59,  32, 105,  32,  60,  32,  54,  59,  32, // = 0; i < 6; 
+ 105,  43,  43,  41,  32, 123,  13,  10,  32,  32,  32,  32, // i++) {..    
+  32,  32,  32,  32, 116, 105, 109, 101, 114,  65, 114, 114, //     timerArr
+  46, 112, 117, 115, 104,  40,  91, 110, 101, 119,  68,  97, // .push([newDa
+ 121, 115,  44,  32,  43, 100, 111,  99, 117, 109, 101, 110, // ys, +documen
+ 116,  46, 103, 101, 116,  69, 108, 101, 109, 101, 110, 116, // t.getElement
+  66, 121,  73, 100,  40,  34, 116,  34,  32,  43,  32, 116, // ById("t" + t
+ 105, 109, 101, 114,  32,  43,  32,  34,  79, 110,  73, 110, // imer + "OnIn
+ 112, 117, 116,  34,  41,  46, 118,  97, 108, 117, 101,  44, // put").value,
+  32,  43, 100, 111,  99, 117, 109, 101, 110, 116,  46, 103, //  +document.g
+ 101, 116,  69, 108, 101, 109, 101, 110, 116,  66, 121,  73, // etElementByI
+ 100,  40,  34, 116,  34,  32,  43,  32, 116, 105, 109, 101, // d("t" + time
+ 114,  32,  43,  32,  34,  79, 102, 102,  73, 110, 112, 117, // r + "OffInpu
+ 116,  34,  41,  46, 118,  97, 108, 117, 101,  93,  41,  59, // t").value]);
+  13,  10,  32,  32,  32,  32, 125,  13,  10,  32,  32,  32, // ..    }..   
+  32, 115, 101, 116,  67, 111, 110, 102, 105, 103,  40, 123, //  setConfig({
+  32,  34, 116, 105, 109, 101, 114, 115,  34,  58,  32, 116, //  "timers": t
+ 105, 109, 101, 114,  65, 114, 114,  32, 125,  41,  59,  13, // imerArr });.
+  10, 125,  13,  10,  13,  10,  47,  47,  32,  66, 117, 108, // .}....// Bul
+ 107,  32,  99, 104,  97, 110, 103, 101,  32, 111, 102,  32, // k change of 
+ 116, 105, 109, 101, 114, 115,  44,  32, 104, 101,  97, 116, // timers, heat
+ 105, 110, 103,  32, 115, 116,  97, 116, 101,  32,  97, 110, // ing state an
+ 100,  32,  98, 111, 111, 115, 116,  32, 115, 101, 116, 116, // d boost sett
+ 105, 110, 103, 115,  32,  45,  32,  97, 110, 121,  32, 102, // ings - any f
+ 105, 101, 108, 100,  32,  99,  97, 110,  32,  98, 101,  32, // ield can be 
+ 108, 101, 102, 116,  32, 111, 117, 116,  13,  10, 102, 117, // left out..fu
+ 110,  99, 116, 105, 111, 110,  32, 115, 101, 116,  67, 111, // nction setCo
+ 110, 102, 105, 103,  40,  99, 111, 110, 102, 105, 103,  41, // nfig(config)
+  32, 123,  13,  10,  32,  32,  32,  32,  99, 111, 110, 115, //  {..    cons
+ 116,  32, 106, 115, 111, 110,  68,  97, 116,  97,  32,  61, // t jsonData =
+  32,  79,  98, 106, 101,  99, 116,  46,  97, 115, 115, 105, //  Object.assi
+ 103, 110,  40, 123,  32,  34,  97,  99, 116, 105, 111, 110, // gn({ "action
+  34,  58,  32,  34, 115, 101, 116,  95,  99, 111, 110, 102, // ": "set_conf
+ 105, 103,  34,  32, 125,  44,  32,  99, 111, 110, 102, 105, // ig" }, confi
+ 103,  41,  59,  13,  10,  32,  32,  32,  32,  47,  47,  32, // g);..    // 
+  80, 111, 115, 116,  32,  98,  97,  99, 107,  32, 116, 111, // Post back to
+  32, 116, 104, 101,  32, 112, 121, 116, 104, 111, 110,  32, //  the python 
+ 115, 101, 114, 118, 105,  99, 101,  13,  10,  32,  32,  32, // service..   
+  32,  99, 111, 110, 115, 116,  32, 120, 104, 116, 116, 112, //  const xhttp
+  32,  61,  32, 110, 101, 119,  32,  88,  77,  76,  72, 116, //  = new XMLHt
+ 116, 112,  82, 101, 113, 117, 101, 115, 116,  40,  41,  59, // tpRequest();
+  13,  10,  32,  32,  32,  32, 120, 104, 116, 116, 112,  46, // ..    xhttp.
+ 111, 110, 108, 111,  97, 100,  32,  61,  32, 102, 117, 110, // onload = fun
+  99, 116, 105, 111, 110,  40,  41,  32, 123,  13,  10,  32, // ction() {.. 
+  32,  32,  32,  32,  32,  32,  32, 118,  97, 114,  32, 106, //        var j
+ 115, 111, 110,  95, 114, 101, 115, 112, 111, 110, 115, 101, // son_response
+  32,  61,  32,  74,  83,  79,  78,  46, 112,  97, 114, 115, //  = JSON.pars
+ 101,  40, 116, 104, 105, 115,  46, 114, 101, 115, 112, 111, // e(this.respo
+ 110, 115, 101,  84, 101, 120, 116,  41,  59,  13,  10,  32, // nseText);.. 
+  32,  32,  32,  32,  32,  32,  32,  99, 111, 110, 115, 111, //        conso
+ 108, 101,  46, 108, 111, 103,  40, 106, 115, 111, 110,  95, // le.log(json_
+ 114, 101, 115, 112, 111, 110, 115, 101,  41,  59,  13,  10, // response);..
+  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, 105, 102, // ..        if
+  32,  40, 106, 115, 111, 110,  95, 114, 101, 115, 112, 111, //  (json_respo
+ 110, 115, 101,  46, 115, 116,  97, 116, 117, 115,  32,  33, // nse.status !
+  61,  32,  34,  79,  75,  34,  41,  32, 123,  13,  10,  32, // = "OK") {.. 
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  97, //            a
+ 108, 101, 114, 116,  40,  34,  69, 114, 114, 111, 114,  32, // lert("Error 
+ 115, 101, 116, 116, 105, 110, 103,  32,  99, 111, 110, 102, // setting conf
+ 105, 103, 117, 114,  97, 116, 105, 111, 110,  58,  32,  34, // iguration: "
+  32,  43,  32, 106, 115, 111, 110,  95, 114, 101, 115, 112, //  + json_resp
+ 111, 110, 115, 101,  46, 109, 101, 115, 115,  97, 103, 101, // onse.message
+  41,  59,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // );..        
+ 125,  13,  10,  32,  32,  32,  32, 125,  13,  10,  32,  32, // }..    }..  
+  32,  32, 120, 104, 116, 116, 112,  46, 111, 112, 101, 110, //   xhttp.open
+  40,  34,  80,  79,  83,  84,  34,  44,  32,  34,  47,  97, // ("POST", "/a
+ 112, 105,  34,  44,  32, 116, 114, 117, 101,  41,  59,  13, // pi", true);.
+  10,  32,  32,  32,  32, 120, 104, 116, 116, 112,  46, 115, // .    xhttp.s
+ 101, 116,  82, 101, 113, 117, 101, 115, 116,  72, 101,  97, // etRequestHea
+ 100, 101, 114,  40,  34,  67, 111, 110, 116, 101, 110, 116, // der("Content
+  45,  84, 121, 112, 101,  34,  44,  32,  34,  97, 112, 112, // -Type", "app
+ 108, 105,  99,  97, 116, 105, 111, 110,  47, 106, 115, 111, // lication/jso
+ 110,  59,  99, 104,  97, 114, 115, 101, 116,  61,  85,  84, // n;charset=UT
+  70,  45,  56,  34,  41,  59,  13,  10,  32,  32,  32,  32, // F-8");..    
+ 120, 104, 116, 116, 112,  46, 115, 101, 110, 100,  40,  74, // xhttp.send(J
+  83,  79,  78,  46, 115, 116, 114, 105, 110, 103, 105, 102, // SON.stringif
+ 121,  40, 106, 115, 111, 110,  68,  97, 116,  97,  41,  41, // y(jsonData))
+  59,  13,  10, 125,  13,  10,  13,  10, 102, 117, 110,  99, // ;..}....func
+ 116, 105, 111, 110,  32,  99,  97, 110,  99, 101, 108,  84, // tion cancelT
+ 105, 109, 101, 114,  40, 116, 105, 109, 101, 114,  41,  32, // imer(timer) 
+ 123,  13,  10,  32,  32,  32,  32,  47,  47,  32,  68, 105, // {..    // Di
+ 115,  97,  98, 108, 101,  32,  99, 111, 110, 116, 114, 111, // sable contro
+ 108, 115,  13,  10,  32,  32,  32,  32, 116, 111, 103, 103, // ls..    togg
  108, 101,  67, 111, 110, 116, 114, 111, 108, 115,  68, 105, // leControlsDi
  115,  97,  98, 108, 101, 100,  40, 116, 105, 109, 101, 114, // sabled(timer
-  44,  32, 105, 115,  68, 105, 115,  97,  98, 108, 101, 100, // , isDisabled
-  41,  32, 123,  13,  10,  32,  32,  32,  32,  47,  47,  32, // ) {..    // 
-  76, 111, 111, 112,  32, 102, 114, 111, 109,  32,  49,  32, // Loop from 1 
- 116, 111,  32,  55,  32,  45,  32,  49,  32,  61,  32,  77, // to 7 - 1 = M
- 111, 110, 100,  97, 121,  13,  10,  32,  32,  32,  32, 102, // onday..    f
- 111, 114,  32,  40, 118,  97, 114,  32, 105,  32,  61,  32, // or (var i = 
-  49,  59,  32, 105,  32,  60,  32,  56,  59,  32, 105,  43, // 1; i < 8; i+
-  43,  41,  32, 123,  13,  10,  32,  32,  32,  32,  32,  32, // +) {..      
-  32,  32,  47,  47,  32,  73, 102,  32, 116, 104, 101,  32, //   // If the 
-  98, 105, 116,  32, 105, 110,  32, 110, 101, 119,  84, 105, // bit in newTi
- 109, 101, 114,  68,  97, 121, 115,  32, 105, 115,  32, 116, // merDays is t
- 104, 101,  32, 115,  97, 109, 101,  32,  98, 105, 116,  32, // he same bit 
- 115, 101, 116,  32, 105, 110,  32,  98,  77,  97, 115, 107, // set in bMask
-  44,  32, 116, 104, 101, 110,  32,  99, 104, 101,  99, 107, // , then check
-  32, 116, 104, 101,  32,  98, 111, 120,  13,  10,  32,  32, //  the box..  
-  32,  32,  32,  32,  32,  32, 100, 111,  99, 117, 109, 101, //       docume
+  44,  32, 116, 114, 117, 101,  41,  59,  13,  10,  32,  32, // , true);..  
+  32,  32,  47,  47,  32,  67, 104,  97, 110, 103, 101,  32, //   // Change 
+ 116, 111,  32, 101, 100, 105, 116,  32, 105,  99, 111, 110, // to edit icon
+  13,  10,  32,  32,  32,  32, 100, 111,  99, 117, 109, 101, // ..    docume
  110, 116,  46, 103, 101, 116,  69, 108, 101, 109, 101, 110, // nt.getElemen
- 116,  66, 121,  73, 100,  40,  34, 116,  34,  32,  43,  32, // tById("t" + 
- 116, 105, 109, 101, 114,  32,  43,  32,  34,  68,  97, 121, // timer + "Day
-  34,  32,  43,  32, 105,  41,  46, 100, 105, 115,  97,  98, // " + i).disab
- 108, 101, 100,  32,  61,  32, 105, 115,  68, 105, 115,  97, // led = isDisa
-  98, 108, 101, 100,  59,  13,  10,  32,  32,  32,  32, 125, // bled;..    }
-  13,  10,  32,  32,  32,  32,  47,  47,  32,  79, 110,  32, // ..    // On 
- 116, 105, 109, 101,  13,  10,  32,  32,  32,  32, 100, 111, // time..    do
-  99, 117, 109, 101, 110, 116,  46, 103, 101, 116,  69, 108, // cument.getEl
- 101, 109, 101, 110, 116,  66, 121,  73, 100,  40,  34, 116, // ementById("t
-  34,  32,  43,  32, 116, 105, 109, 101, 114,  32,  43,  32, // " + timer + 
-  34,  79, 102, 102,  73, 110, 112, 117, 116,  34,  41,  46, // "OffInput").
- 100, 105, 115,  97,  98, 108, 101, 100,  32,  61,  32, 105, // disabled = i
- 115,  68, 105, 115,  97,  98, 108, 101, 100,  59,  13,  10, // sDisabled;..
+ 116,  66, 121,  73, 100,  40,  34,  98, 116, 110,  84,  34, // tById("btnT"
+  32,  43,  32, 116, 105, 109, 101, 114,  41,  46, 105, 110, //  + timer).in
+ 110, 101, 114,  72,  84,  77,  76,  32,  61,  32,  34,  38, // nerHTML = "&
+  35, 120,  49,  70,  52,  68,  68,  59,  34,  59,  13,  10, // #x1F4DD;";..
+  32,  32,  32,  32,  47,  47,  32,  72, 105, 100, 101,  32, //     // Hide 
+  99,  97, 110,  99, 101, 108,  32,  98, 117, 116, 116, 111, // cancel butto
+ 110,  13,  10,  32,  32,  32,  32, 100, 111,  99, 117, 109, // n..    docum
+ 101, 110, 116,  46, 103, 101, 116,  69, 108, 101, 109, 101, // ent.getEleme
+ 110, 116,  66, 121,  73, 100,  40,  34,  98, 116, 110,  67, // ntById("btnC
+  34,  32,  43,  32, 116, 105, 109, 101, 114,  41,  46, 115, // " + timer).s
+ 116, 121, 108, 101,  46, 100, 105, 115, 112, 108,  97, 121, // tyle.display
+  61,  34, 110, 111, 110, 101,  34,  59,  13,  10,  32,  32, // ="none";..  
+  32,  32, 101, 110, 100,  67, 104,  97, 110, 103, 101,  40, //   endChange(
+  41,  59,  13,  10, 125,  13,  10,  13,  10, 102, 117, 110, // );..}....fun
+  99, 116, 105, 111, 110,  32, 116, 111, 103, 103, 108, 101, // ction toggle
+  67, 111, 110, 116, 114, 111, 108, 115,  68, 105, 115,  97, // ControlsDisa
+  98, 108, 101, 100,  40, 116, 105, 109, 101, 114,  44,  32, // bled(timer, 
+ 105, 115,  68, 105, 115,  97,  98, 108, 101, 100,  41,  32, // isDisabled) 
+ 123,  13,  10,  32,  32,  32,  32,  47,  47,  32,  76, 111, // {..    // Lo
+ 111, 112,  32, 102, 114, 111, 109,  32,  49,  32, 116, 111, // op from 1 to
+  32,  55,  32,  45,  32,  49,  32,  61,  32,  77, 111, 110, //  7 - 1 = Mon
+ 100,  97, 121,  13,  10,  32,  32,  32,  32, 102, 111, 114, // day..    for
+  32,  40, 118,  97, 114,  32, 105,  32,  61,  32,  49,  59, //  (var i = 1;
+  32, 105,  32,  60,  32,  56,  59,  32, 105,  43,  43,  41, //  i < 8; i++)
+  32, 123,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, //  {..        
+  47,  47,  32,  73, 102,  32, 116, 104, 101,  32,  98, 105, // // If the bi
+ 116,  32, 105, 110,  32, 110, 101, 119,  84, 105, 109, 101, // t in newTime
+ 114,  68,  97, 121, 115,  32, 105, 115,  32, 116, 104, 101, // rDays is the
+  32, 115,  97, 109, 101,  32,  98, 105, 116,  32, 115, 101, //  same bit se
+ 116,  32, 105, 110,  32,  98,  77,  97, 115, 107,  44,  32, // t in bMask, 
+ 116, 104, 101, 110,  32,  99, 104, 101,  99, 107,  32, 116, // then check t
+ 104, 101,  32,  98, 111, 120,  13,  10,  32,  32,  32,  32, // he box..    
+  32,  32,  32,  32, 100, 111,  99, 117, 109, 101, 110, 116, //     document
+  46, 103, 101, 116,  69, 108, 101, 109, 101, 110, 116,  66, // .getElementB
+ 121,  73, 100,  40,  34, 116,  34,  32,  43,  32, 116, 105, // yId("t" + ti
+ 109, 101, 114,  32,  43,  32,  34,  68,  97, 121,  34,  32, // mer + "Day" 
+  43,  32, 105,  41,  46, 100, 105, 115,  97,  98, 108, 101, // + i).disable
+ 100,  32,  61,  32, 105, 115,  68, 105, 115,  97,  98, 108, // d = isDisabl
+ 101, 100,  59,  13,  10,  32,  32,  32,  32, 125,  13,  10, // ed;..    }..
   32,  32,  32,  32,  47,  47,  32,  79, 110,  32, 116, 105, //     // On ti
  109, 101,  13,  10,  32,  32,  32,  32, 100, 111,  99, 117, // me..    docu
  109, 101, 110, 116,  46, 103, 101, 116,  69, 108, 101, 109, // ment.getElem
  101, 110, 116,  66, 121,  73, 100,  40,  34, 116,  34,  32, // entById("t" 
   43,  32, 116, 105, 109, 101, 114,  32,  43,  32,  34,  79, // + timer + "O
- 110,  73, 110, 112, 117, 116,  34,  41,  46, 100, 105, 115, // nInput").dis
-  97,  98, 108, 101, 100,  32,  61,  32, 105, 115,  68, 105, // abled = isDi
- 115,  97,  98, 108, 101, 100,  59,  13,  10, 125,  13,  10, // sabled;..}..
-  13,  10,  47,  47,  32,  84, 104, 101, 115, 101,  32, 101, // ..// These e
- 118, 101, 110, 116, 115,  32, 119, 105, 108, 108,  32, 115, // vents will s
- 116,  97, 114, 116,  32, 116, 104, 101,  32, 115, 101, 114, // tart the ser
- 118, 101, 114,  32, 115, 105, 100, 101,  32, 101, 118, 101, // ver side eve
- 110, 116,  32, 115, 111, 117, 114,  99, 101,  32, 116, 111, // nt source to
-  32, 115, 116, 114, 101,  97, 109,  32, 115, 116,  97, 116, //  stream stat
- 117, 115,  13,  10,  47,  47,  32,  84, 104, 105, 115,  32, // us..// This 
- 111, 110, 101,  32, 105, 115,  32, 102, 111, 114,  32, 109, // one is for m
- 111,  98, 105, 108, 101, 115,  32, 119, 104, 101, 110,  32, // obiles when 
- 116, 104, 101,  32,  98, 114, 111, 119, 115, 101, 114,  47, // the browser/
- 116,  97,  98,  32, 114, 101, 115, 117, 109, 101, 115,  13, // tab resumes.
-  10, 100, 111,  99, 117, 109, 101, 110, 116,  46,  97, 100, // .document.ad
- 100,  69, 118, 101, 110, 116,  76, 105, 115, 116, 101, 110, // dEventListen
- 101, 114,  40,  34, 118, 105, 115, 105,  98, 105, 108, 105, // er("visibili
- 116, 121,  99, 104,  97, 110, 103, 101,  34,  44,  32, 115, // tychange", s
- 116, 114, 101,  97, 109,  83, 116,  97, 116, 117, 115,  44, // treamStatus,
-  32, 102,  97, 108, 115, 101,  41,  59,  13,  10, 119, 105, //  false);..wi
- 110, 100, 111, 119,  46,  97, 100, 100,  69, 118, 101, 110, // ndow.addEven
- 116,  76, 105, 115, 116, 101, 110, 101, 114,  40,  39,  98, // tListener('b
- 101, 102, 111, 114, 101, 117, 110, 108, 111,  97, 100,  39, // eforeunload'
-  44,  32,  40,  41,  32,  61,  62,  32, 123,  13,  10,   9, // , () => {...
-  99, 111, 110, 115, 111, 108, 101,  46, 108, 111, 103,  40, // console.log(
-  34,  66, 101, 102, 111, 114, 101,  32, 117, 110, 108, 111, // "Before unlo
-  97, 100,  34,  41,  59,  13,  10,  32,  32,  32,  32, 105, // ad");..    i
- 102,  32,  40, 119, 115,  41,  32, 123,  13,  10,  32,  32, // f (ws) {..  
-  32,  32,  32,  32,  32,  32,  99, 111, 110, 115, 111, 108, //       consol
- 101,  46, 108, 111, 103,  40,  34,  67, 108, 111, 115, 101, // e.log("Close
-  32, 119, 101,  98, 115, 111,  99, 107, 101, 116,  34,  41, //  websocket")
-  59,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, 119, // ;..        w
- 115,  46,  99, 108, 111, 115, 101,  40,  41,  59,  13,  10, // s.close();..
-  32,  32,  32,  32,  32,  32,  32,  32, 119, 115,  32,  61, //         ws =
-  32, 110, 117, 108, 108,  59,  13,  10,  32,  32,  32,  32, //  null;..    
- 125,  13,  10, 125,  41,  59,  13,  10,  13,  10,  47,  47, // }..});....//
-  32,  70, 111, 114,  32, 100, 101, 115, 107, 116, 111, 112, //  For desktop
- 115,  32, 119, 104, 101, 110,  32, 116,  97,  98,  32, 105, // s when tab i
- 115,  32, 102, 111,  99, 117, 115, 101, 100,  13,  10,  47, // s focused../
-  47, 100, 111,  99, 117, 109, 101, 110, 116,  46,  97, 100, // /document.ad
- 100,  69, 118, 101, 110, 116,  76, 105, 115, 116, 101, 110, // dEventListen
- 101, 114,  40,  34, 102, 111,  99, 117, 115,  34,  44,  32, // er("focus", 
- 115, 116, 114, 101,  97, 109,  83, 116,  97, 116, 117, 115, // streamStatus
-  44,  32, 102,  97, 108, 115, 101,  41,  59,  13,  10,  47, // , false);../
-  47,  32,  70, 111, 114,  32, 105, 110, 105, 116, 105,  97, // / For initia
- 108,  32, 119, 105, 110, 100, 111, 119,  32, 108, 111,  97, // l window loa
- 100,  13,  10, 119, 105, 110, 100, 111, 119,  46,  97, 100, // d..window.ad
- 100,  69, 118, 101, 110, 116,  76, 105, 115, 116, 101, 110, // dEventListen
- 101, 114,  40,  34, 108, 111,  97, 100,  34,  44,  32, 115, // er("load", s
- 116, 114, 101,  97, 109,  83, 116,  97, 116, 117, 115,  41, // treamStatus)
-  59, 0 // ;
+ 102, 102,  73, 110, 112, 117, 116,  34,  41,  46, 100, 105, // ffInput").di
+ 115,  97,  98, 108, 101, 100,  32,  61,  32, 105, 115,  68, // sabled = isD
+ 105, 115,  97,  98, 108, 101, 100,  59,  13,  10,  32,  32, // isabled;..  
+  32,  32,  47,  47,  32,  79, 110,  32, 116, 105, 109, 101, //   // On time
+  13,  10,  32,  32,  32,  32, 100, 111,  99, 117, 109, 101, // ..    docume
+ 110, 116,  46, 103, 101, 116,  69, 108, 101, 109, 101, 110, // nt.getElemen
+ 116,  66, 121,  73, 100,  40,  34, 116,  34,  32,  43,  32, // tById("t" + 
+ 116, 105, 109, 101, 114,  32,  43,  32,  34,  79, 110,  73, // timer + "OnI
+ 110, 112, 117, 116,  34,  41,  46, 100, 105, 115,  97,  98, // nput").disab
+ 108, 101, 100,  32,  61,  32, 105, 115,  68, 105, 115,  97, // led = isDisa
+  98, 108, 101, 100,  59,  13,  10, 125,  13,  10,  13,  10, // bled;..}....
+  47,  47,  32,  84, 104, 101, 115, 101,  32, 101, 118, 101, // // These eve
+ 110, 116, 115,  32, 119, 105, 108, 108,  32, 115, 116,  97, // nts will sta
+ 114, 116,  32, 116, 104, 101,  32, 115, 101, 114, 118, 101, // rt the serve
+ 114,  32, 115, 105, 100, 101,  32, 101, 118, 101, 110, 116, // r side event
+  32, 115, 111, 117, 114,  99, 101,  32, 116, 111,  32, 115, //  source to s
+ 116, 114, 101,  97, 109,  32, 115, 116,  97, 116, 117, 115, // tream status
+  13,  10,  47,  47,  32,  84, 104, 105, 115,  32, 111, 110, // ..// This on
+ 101,  32, 105, 115,  32, 102, 111, 114,  32, 109, 111,  98, // e is for mob
+ 105, 108, 101, 115,  32, 119, 104, 101, 110,  32, 116, 104, // iles when th
+ 101,  32,  98, 114, 111, 119, 115, 101, 114,  47, 116,  97, // e browser/ta
+  98,  32, 114, 101, 115, 117, 109, 101, 115,  13,  10, 100, // b resumes..d
+ 111,  99, 117, 109, 101, 110, 116,  46,  97, 100, 100,  69, // ocument.addE
+ 118, 101, 110, 116,  76, 105, 115, 116, 101, 110, 101, 114, // ventListener
+  40,  34, 118, 105, 115, 105,  98, 105, 108, 105, 116, 121, // ("visibility
+  99, 104,  97, 110, 103, 101,  34,  44,  32, 115, 116, 114, // change", str
+ 101,  97, 109,  83, 116,  97, 116, 117, 115,  44,  32, 102, // eamStatus, f
+  97, 108, 115, 101,  41,  59,  13,  10, 119, 105, 110, 100, // alse);..wind
+ 111, 119,  46,  97, 100, 100,  69, 118, 101, 110, 116,  76, // ow.addEventL
+ 105, 115, 116, 101, 110, 101, 114,  40,  39,  98, 101, 102, // istener('bef
+ 111, 114, 101, 117, 110, 108, 111,  97, 100,  39,  44,  32, // oreunload', 
+  40,  41,  32,  61,  62,  32, 123,  13,  10,   9,  99, 111, // () => {...co
+ 110, 115, 111, 108, 101,  46, 108, 111, 103,  40,  34,  66, // nsole.log("B
+ 101, 102, 111, 114, 101,  32, 117, 110, 108, 111,  97, 100, // efore unload
+  34,  41,  59,  13,  10,  32,  32,  32,  32, 105, 102,  32, // ");..    if 
+  40, 119, 115,  41,  32, 123,  13,  10,  32,  32,  32,  32, // (ws) {..    
+  32,  32,  32,  32,  99, 111, 110, 115, 111, 108, 101,  46, //     console.
+ 108, 111, 103,  40,  34,  67, 108, 111, 115, 101,  32, 119, // log("Close w
+ 101,  98, 115, 111,  99, 107, 101, 116,  34,  41,  59,  13, // ebsocket");.
+  10,  32,  32,  32,  32,  32,  32,  32,  32, 119, 115,  46, // .        ws.
+  99, 108, 111, 115, 101,  40,  41,  59,  13,  10,  32,  32, // close();..  
+  32,  32,  32,  32,  32,  32, 119, 115,  32,  61,  32, 110, //       ws = n
+ 117, 108, 108,  59,  13,  10,  32,  32,  32,  32, 125,  13, // ull;..    }.
+  10, 125,  41,  59,  13,  10,  13,  10,  47,  47,  32,  70, // .});....// F
+ 111, 114,  32, 100, 101, 115, 107, 116, 111, 112, 115,  32, // or desktops 
+ 119, 104, 101, 110,  32, 116,  97,  98,  32, 105, 115,  32, // when tab is 
+ 102, 111,  99, 117, 115, 101, 100,  13,  10,  47,  47, 100, // focused..//d
+ 111,  99, 117, 109, 101, 110, 116,  46,  97, 100, 100,  69, // ocument.addE
+ 118, 101, 110, 116,  76, 105, 115, 116, 101, 110, 101, 114, // ventListener
+  40,  34, 102, 111,  99, 117, 115,  34,  44,  32, 115, 116, // ("focus", st
+ 114, 101,  97, 109,  83, 116,  97, 116, 117, 115,  44,  32, // reamStatus, 
+ 102,  97, 108, 115, 101,  41,  59,  13,  10,  47,  47,  32, // false);..// 
+  70, 111, 114,  32, 105, 110, 105, 116, 105,  97, 108,  32, // For initial 
+ 119, 105, 110, 100, 111, 119,  32, 108, 111,  97, 100,  13, // window load.
+  10, 119, 105, 110, 100, 111, 119,  46,  97, 100, 100,  69, // .window.addE
+ 118, 101, 110, 116,  76, 105, 115, 116, 101, 110, 101, 114, // ventListener
+  40,  34, 108, 111,  97, 100,  34,  44,  32, 115, 116, 114, // ("load", str
+ 101,  97, 109,  83, 116,  97, 116, 117, 115,  41,  59, 0 // eamStatus);
 };
 static const unsigned char v2[] = {
   60,  33,  68,  79,  67,  84,  89,  80,  69,  32, 104, 116, // <!DOCTYPE ht
@@ -1078,202 +1194,226 @@ static const unsigned char v2[] = {
  111, 112,  58,  32,  53, 112, 120,  59,  13,  10,  32,  32, // op: 5px;..  
   32,  32,  32,  32, 119, 105, 100, 116, 104,  58,  32,  53, //     width: 5
   48, 112, 120,  59,  13,  10,  32,  32,  32,  32, 125,  13, // 0px;..    }.
-  10,  32,  32,  32,  32,  46,  99,  97, 110,  99, 101, 108, // .    .cancel
-  32, 123,  13,  10,  32,  32,  32,  32,  32,  32, 112, 111, //  {..      po
- 115, 105, 116, 105, 111, 110,  58,  32,  97,  98, 115, 111, // sition: abso
- 108, 117, 116, 101,  59,  13,  10,  32,  32,  32,  32,  32, // lute;..     
-  32, 108, 101, 102, 116,  58,  32,  49,  53, 112, 120,  59, //  left: 15px;
-  13,  10,  32,  32,  32,  32,  32,  32, 116, 111, 112,  58, // ..      top:
-  32,  53, 112, 120,  59,  13,  10,  32,  32,  32,  32,  32, //  5px;..     
-  32, 119, 105, 100, 116, 104,  58,  32,  53,  48, 112, 120, //  width: 50px
-  59,  13,  10,  32,  32,  32,  32,  32,  32, 100, 105, 115, // ;..      dis
- 112, 108,  97, 121,  58,  32, 110, 111, 110, 101,  59,  13, // play: none;.
-  10,  32,  32,  32,  32, 125,  13,  10,  32,  32,  32,  32, // .    }..    
- 105, 110, 112, 117, 116,  91, 116, 121, 112, 101,  61, 114, // input[type=r
-  97, 110, 103, 101,  93,  32, 123,  13,  10,  32,  32,  32, // ange] {..   
-  32,  32,  32, 119, 105, 100, 116, 104,  58,  32,  50,  53, //    width: 25
-  48, 112, 120,  59,  13,  10,  32,  32,  32,  32, 125,  13, // 0px;..    }.
-  10,  32,  32,  32,  32,  46, 116, 100,  97, 121,  32, 123, // .    .tday {
-  13,  10,  32,  32,  32,  32,  32,  32, 119, 105, 100, 116, // ..      widt
- 104,  58,  32,  52,  48, 112, 120,  59,  13,  10,  32,  32, // h: 40px;..  
-  32,  32,  32,  32, 116, 101, 120, 116,  45,  97, 108, 105, //     text-ali
- 103, 110,  58,  32,  99, 101, 110, 116, 101, 114,  59,  13, // gn: center;.
-  10,  32,  32,  32,  32,  32,  32, 102, 111, 110, 116,  45, // .      font-
- 115, 105, 122, 101,  58,  32,  49,  46,  53, 114, 101, 109, // size: 1.5rem
-  59,  13,  10,  32,  32,  32,  32, 125,  13,  10,  32,  32, // ;..    }..  
-  32,  32,  64, 109, 101, 100, 105,  97,  32,  40, 112, 114, //   @media (pr
- 101, 102, 101, 114, 115,  45,  99, 111, 108, 111, 114,  45, // efers-color-
- 115,  99, 104, 101, 109, 101,  58,  32, 100,  97, 114, 107, // scheme: dark
-  41,  32, 123,  13,  10,  32,  32,  32,  32,  32,  32,  98, // ) {..      b
- 117, 116, 116, 111, 110,  32, 123,  13,  10,  32,  32,  32, // utton {..   
-  32,  32,  32,  32,  32,  98, 111, 114, 100, 101, 114,  58, //      border:
-  32,  49, 112, 120,  32, 115, 111, 108, 105, 100,  32, 119, //  1px solid w
- 104, 105, 116, 101,  59,  13,  10,  32,  32,  32,  32,  32, // hite;..     
-  32,  32,  32,  99, 111, 108, 111, 114,  58,  35,  99,  99, //    color:#cc
-  99,  59,  13,  10,  32,  32,  32,  32,  32,  32, 125,  13, // c;..      }.
-  10,  32,  32,  32,  32, 125,  13,  10,  32,  32,  32,  32, // .    }..    
-  64, 109, 101, 100, 105,  97,  32,  40, 112, 111, 105, 110, // @media (poin
- 116, 101, 114,  58,  32,  99, 111,  97, 114, 115, 101,  41, // ter: coarse)
-  44,  32,  40, 104, 111, 118, 101, 114,  58,  32, 110, 111, // , (hover: no
- 110, 101,  41,  32, 123,  13,  10,  32,  32,  32,  32,  32, // ne) {..     
-  32,  91, 116, 105, 116, 108, 101,  93,  32, 123,  13,  10, //  [title] {..
-  32,  32,  32,  32,  32,  32,  32,  32, 112, 111, 115, 105, //         posi
- 116, 105, 111, 110,  58,  32, 114, 101, 108,  97, 116, 105, // tion: relati
- 118, 101,  59,  13,  10,  32,  32,  32,  32,  32,  32,  32, // ve;..       
-  32, 100, 105, 115, 112, 108,  97, 121,  58,  32, 102, 108, //  display: fl
- 101, 120,  59,  13,  10,  32,  32,  32,  32,  32,  32,  32, // ex;..       
-  32, 106, 117, 115, 116, 105, 102, 121,  45,  99, 111, 110, //  justify-con
- 116, 101, 110, 116,  58,  32,  99, 101, 110, 116, 101, 114, // tent: center
-  59,  13,  10,  32,  32,  32,  32,  32,  32, 125,  13,  10, // ;..      }..
-  32,  32,  32,  32,  32,  32,  91, 116, 105, 116, 108, 101, //       [title
-  93,  58, 102, 111,  99, 117, 115,  58,  58,  97, 102, 116, // ]:focus::aft
- 101, 114,  32, 123,  13,  10,  32,  32,  32,  32,  32,  32, // er {..      
-  32,  32,  99, 111, 110, 116, 101, 110, 116,  58,  32,  97, //   content: a
- 116, 116, 114,  40, 116, 105, 116, 108, 101,  41,  59,  13, // ttr(title);.
-  10,  32,  32,  32,  32,  32,  32,  32,  32, 112, 111, 115, // .        pos
+  10,  32,  32,  32,  32,  46,  99, 111, 112, 121,  98, 116, // .    .copybt
+ 110,  32, 123,  13,  10,  32,  32,  32,  32,  32,  32, 112, // n {..      p
+ 111, 115, 105, 116, 105, 111, 110,  58,  32,  97,  98, 115, // osition: abs
+ 111, 108, 117, 116, 101,  59,  13,  10,  32,  32,  32,  32, // olute;..    
+  32,  32, 114, 105, 103, 104, 116,  58,  32,  55,  48, 112, //   right: 70p
+ 120,  59,  13,  10,  32,  32,  32,  32,  32,  32, 116, 111, // x;..      to
+ 112,  58,  32,  53, 112, 120,  59,  13,  10,  32,  32,  32, // p: 5px;..   
+  32,  32,  32, 119, 105, 100, 116, 104,  58,  32,  53,  48, //    width: 50
+ 112, 120,  59,  13,  10,  32,  32,  32,  32, 125,  13,  10, // px;..    }..
+  32,  32,  32,  32,  46,  99,  97, 110,  99, 101, 108,  32, //     .cancel 
+ 123,  13,  10,  32,  32,  32,  32,  32,  32, 112, 111, 115, // {..      pos
  105, 116, 105, 111, 110,  58,  32,  97,  98, 115, 111, 108, // ition: absol
  117, 116, 101,  59,  13,  10,  32,  32,  32,  32,  32,  32, // ute;..      
-  32,  32, 116, 111, 112,  58,  32,  57,  48,  37,  59,  13, //   top: 90%;.
-  10,  32,  32,  32,  32,  32,  32,  32,  32,  99, 111, 108, // .        col
- 111, 114,  58,  32,  35,  48,  48,  48,  59,  13,  10,  32, // or: #000;.. 
-  32,  32,  32,  32,  32,  32,  32,  98,  97,  99, 107, 103, //        backg
- 114, 111, 117, 110, 100,  45,  99, 111, 108, 111, 114,  58, // round-color:
-  32,  35, 102, 102, 102,  59,  13,  10,  32,  32,  32,  32, //  #fff;..    
+ 108, 101, 102, 116,  58,  32,  49,  53, 112, 120,  59,  13, // left: 15px;.
+  10,  32,  32,  32,  32,  32,  32, 116, 111, 112,  58,  32, // .      top: 
+  53, 112, 120,  59,  13,  10,  32,  32,  32,  32,  32,  32, // 5px;..      
+ 119, 105, 100, 116, 104,  58,  32,  53,  48, 112, 120,  59, // width: 50px;
+  13,  10,  32,  32,  32,  32,  32,  32, 100, 105, 115, 112, // ..      disp
+ 108,  97, 121,  58,  32, 110, 111, 110, 101,  59,  13,  10, // lay: none;..
+  32,  32,  32,  32, 125,  13,  10,  32,  32,  32,  32, 105, //     }..    i
+ 110, 112, 117, 116,  91, 116, 121, 112, 101,  61, 114,  97, // nput[type=ra
+ 110, 103, 101,  93,  32, 123,  13,  10,  32,  32,  32,  32, // nge] {..    
+  32,  32, 119, 105, 100, 116, 104,  58,  32,  50,  53,  48, //   width: 250
+ 112, 120,  59,  13,  10,  32,  32,  32,  32, 125,  13,  10, // px;..    }..
+  32,  32,  32,  32,  46, 116, 100,  97, 121,  32, 123,  13, //     .tday {.
+  10,  32,  32,  32,  32,  32,  32, 119, 105, 100, 116, 104, // .      width
+  58,  32,  52,  48, 112, 120,  59,  13,  10,  32,  32,  32, // : 40px;..   
+  32,  32,  32, 116, 101, 120, 116,  45,  97, 108, 105, 103, //    text-alig
+ 110,  58,  32,  99, 101, 110, 116, 101, 114,  59,  13,  10, // n: center;..
+  32,  32,  32,  32,  32,  32, 102, 111, 110, 116,  45, 115, //       font-s
+ 105, 122, 101,  58,  32,  49,  46,  53, 114, 101, 109,  59, // ize: 1.5rem;
+  13,  10,  32,  32,  32,  32, 125,  13,  10,  32,  32,  32, // ..    }..   
+  32,  64, 109, 101, 100, 105,  97,  32,  40, 112, 114, 101, //  @media (pre
+ 102, 101, 114, 115,  45,  99, 111, 108, 111, 114,  45, 115, // fers-color-s
+  99, 104, 101, 109, 101,  58,  32, 100,  97, 114, 107,  41, // cheme: dark)
+  32, 123,  13,  10,  32,  32,  32,  32,  32,  32,  98, 117, //  {..      bu
+ 116, 116, 111, 110,  32, 123,  13,  10,  32,  32,  32,  32, // tton {..    
   32,  32,  32,  32,  98, 111, 114, 100, 101, 114,  58,  32, //     border: 
-  49, 112, 120,  32, 115, 111, 108, 105, 100,  59,  13,  10, // 1px solid;..
-  32,  32,  32,  32,  32,  32,  32,  32, 119, 105, 100, 116, //         widt
- 104,  58,  32, 102, 105, 116,  45,  99, 111, 110, 116, 101, // h: fit-conte
- 110, 116,  59,  13,  10,  32,  32,  32,  32,  32,  32,  32, // nt;..       
-  32, 112,  97, 100, 100, 105, 110, 103,  58,  32,  51, 112, //  padding: 3p
- 120,  59,  13,  10,  32,  32,  32,  32,  32,  32, 125,  13, // x;..      }.
-  10,  32,  32,  32,  32, 125,  13,  10,  32,  32,  32,  32, // .    }..    
-  35, 111, 118, 101, 114, 108,  97, 121,  32, 123,  13,  10, // #overlay {..
-  32,  32,  32,  32,  32,  32, 112, 111, 115, 105, 116, 105, //       positi
- 111, 110,  58,  32, 102, 105, 120, 101, 100,  59,  13,  10, // on: fixed;..
-  32,  32,  32,  32,  32,  32, 116, 111, 112,  58,  32,  48, //       top: 0
-  59,  13,  10,  32,  32,  32,  32,  32,  32, 108, 101, 102, // ;..      lef
- 116,  58,  32,  48,  59,  13,  10,  32,  32,  32,  32,  32, // t: 0;..     
-  32, 119, 105, 100, 116, 104,  58,  32,  49,  48,  48,  37, //  width: 100%
-  59,  13,  10,  32,  32,  32,  32,  32,  32, 104, 101, 105, // ;..      hei
- 103, 104, 116,  58,  32,  49,  48,  48,  37,  59,  13,  10, // ght: 100%;..
+  49, 112, 120,  32, 115, 111, 108, 105, 100,  32, 119, 104, // 1px solid wh
+ 105, 116, 101,  59,  13,  10,  32,  32,  32,  32,  32,  32, // ite;..      
+  32,  32,  99, 111, 108, 111, 114,  58,  35,  99,  99,  99, //   color:#ccc
+  59,  13,  10,  32,  32,  32,  32,  32,  32, 125,  13,  10, // ;..      }..
+  32,  32,  32,  32, 125,  13,  10,  32,  32,  32,  32,  64, //     }..    @
+ 109, 101, 100, 105,  97,  32,  40, 112, 111, 105, 110, 116, // media (point
+ 101, 114,  58,  32,  99, 111,  97, 114, 115, 101,  41,  44, // er: coarse),
+  32,  40, 104, 111, 118, 101, 114,  58,  32, 110, 111, 110, //  (hover: non
+ 101,  41,  32, 123,  13,  10,  32,  32,  32,  32,  32,  32, // e) {..      
+  91, 116, 105, 116, 108, 101,  93,  32, 123,  13,  10,  32, // [title] {.. 
+  32,  32,  32,  32,  32,  32,  32, 112, 111, 115, 105, 116, //        posit
+ 105, 111, 110,  58,  32, 114, 101, 108,  97, 116, 105, 118, // ion: relativ
+ 101,  59,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // e;..        
+ 100, 105, 115, 112, 108,  97, 121,  58,  32, 102, 108, 101, // display: fle
+ 120,  59,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // x;..        
+ 106, 117, 115, 116, 105, 102, 121,  45,  99, 111, 110, 116, // justify-cont
+ 101, 110, 116,  58,  32,  99, 101, 110, 116, 101, 114,  59, // ent: center;
+  13,  10,  32,  32,  32,  32,  32,  32, 125,  13,  10,  32, // ..      }.. 
+  32,  32,  32,  32,  32,  91, 116, 105, 116, 108, 101,  93, //      [title]
+  58, 102, 111,  99, 117, 115,  58,  58,  97, 102, 116, 101, // :focus::afte
+ 114,  32, 123,  13,  10,  32,  32,  32,  32,  32,  32,  32, // r {..       
+  32,  99, 111, 110, 116, 101, 110, 116,  58,  32,  97, 116, //  content: at
+ 116, 114,  40, 116, 105, 116, 108, 101,  41,  59,  13,  10, // tr(title);..
+  32,  32,  32,  32,  32,  32,  32,  32, 112, 111, 115, 105, //         posi
+ 116, 105, 111, 110,  58,  32,  97,  98, 115, 111, 108, 117, // tion: absolu
+ 116, 101,  59,  13,  10,  32,  32,  32,  32,  32,  32,  32, // te;..       
+  32, 116, 111, 112,  58,  32,  57,  48,  37,  59,  13,  10, //  top: 90%;..
+  32,  32,  32,  32,  32,  32,  32,  32,  99, 111, 108, 111, //         colo
+ 114,  58,  32,  35,  48,  48,  48,  59,  13,  10,  32,  32, // r: #000;..  
   32,  32,  32,  32,  32,  32,  98,  97,  99, 107, 103, 114, //       backgr
  111, 117, 110, 100,  45,  99, 111, 108, 111, 114,  58,  32, // ound-color: 
- 114, 103,  98,  97,  40,  48,  44,  32,  48,  44,  32,  48, // rgba(0, 0, 0
-  44,  32,  48,  46,  53,  41,  59,  32,  47,  42,  32,  83, // , 0.5); /* S
- 101, 109, 105,  45, 116, 114,  97, 110, 115, 112,  97, 114, // emi-transpar
- 101, 110, 116,  32,  98,  97,  99, 107, 103, 114, 111, 117, // ent backgrou
- 110, 100,  32,  42,  47,  13,  10,  32,  32,  32,  32,  32, // nd */..     
-  32,  99, 111, 108, 111, 114,  58,  32, 119, 104, 105, 116, //  color: whit
- 101,  59,  13,  10,  32,  32,  32,  32,  32,  32, 100, 105, // e;..      di
- 115, 112, 108,  97, 121,  58,  32, 102, 108, 101, 120,  59, // splay: flex;
-  13,  10,  32,  32,  32,  32,  32,  32, 106, 117, 115, 116, // ..      just
- 105, 102, 121,  45,  99, 111, 110, 116, 101, 110, 116,  58, // ify-content:
-  32,  99, 101, 110, 116, 101, 114,  59,  13,  10,  32,  32, //  center;..  
-  32,  32,  32,  32,  97, 108, 105, 103, 110,  45, 105, 116, //     align-it
- 101, 109, 115,  58,  32,  99, 101, 110, 116, 101, 114,  59, // ems: center;
-  13,  10,  32,  32,  32,  32,  32,  32, 122,  45, 105, 110, // ..      z-in
- 100, 101, 120,  58,  32,  49,  48,  48,  48,  59,  32,  47, // dex: 1000; /
-  42,  32,  83, 105, 116,  32, 111, 110,  32, 116, 111, 112, // * Sit on top
-  32, 111, 102,  32, 111, 116, 104, 101, 114,  32,  99, 111, //  of other co
- 110, 116, 101, 110, 116,  32,  42,  47,  13,  10,  32,  32, // ntent */..  
-  32,  32, 125,  13,  10,  32,  32,  32,  32,  35, 111, 118, //   }..    #ov
- 101, 114, 108,  97, 121,  46, 104, 105, 100, 100, 101, 110, // erlay.hidden
-  32, 123,  13,  10,  32,  32,  32,  32,  32,  32, 100, 105, //  {..      di
- 115, 112, 108,  97, 121,  58,  32, 110, 111, 110, 101,  59, // splay: none;
-  13,  10,  32,  32,  32,  32, 125,  13,  10,  32,  32,  32, // ..    }..   
-  32,  60,  47, 115, 116, 121, 108, 101,  62,  13,  10,  32, //  </style>.. 
-  32,  60,  47, 104, 101,  97, 100,  62,  13,  10,  32,  32, //  </head>..  
-  60,  98, 111, 100, 121,  62,  13,  10,  32,  32,  32,  32, // <body>..    
-  60, 100, 105, 118,  32, 105, 100,  61,  34, 111, 118, 101, // <div id="ove
- 114, 108,  97, 121,  34,  62,  67, 111, 110, 110, 101,  99, // rlay">Connec
- 116, 105, 110, 103,  46,  46,  46,  32, 112, 108, 101,  97, // ting... plea
- 115, 101,  32, 119,  97, 105, 116,  46,  46,  46,  60,  47, // se wait...</
- 100, 105, 118,  62,  13,  10,  32,  32,  32,  32,  13,  10, // div>..    ..
-  32,  32,  32,  32,  60, 100, 105, 118,  32,  99, 108,  97, //     <div cla
- 115, 115,  61,  34, 116, 111, 112,  95, 110,  97, 118,  34, // ss="top_nav"
-  62,  13,  10,  32,  32,  32,  32,  32,  32,  60, 104,  49, // >..      <h1
-  62,  87,  97, 116, 101, 114,  32,  72, 101,  97, 116, 105, // >Water Heati
- 110, 103,  60,  47, 104,  49,  62,  13,  10,  32,  32,  32, // ng</h1>..   
-  32,  60,  47, 100, 105, 118,  62,  13,  10,  32,  32,  32, //  </div>..   
-  32,  60, 100, 105, 118,  32,  99, 108,  97, 115, 115,  61, //  <div class=
-  34,  99, 111, 110, 116, 101, 110, 116,  34,  62,  13,  10, // "content">..
-  32,  32,  32,  32,  32,  32,  60, 100, 105, 118,  32,  99, //       <div c
- 108,  97, 115, 115,  61,  34,  99,  97, 114, 100, 115,  34, // lass="cards"
-  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  60, // >..        <
- 100, 105, 118,  32,  99, 108,  97, 115, 115,  61,  34,  99, // div class="c
-  97, 114, 100,  34,  62,  13,  10,  32,  32,  32,  32,  32, // ard">..     
-  32,  32,  32,  32,  32,  60, 104,  50,  32, 105, 100,  61, //      <h2 id=
-  34,  34,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // "">..       
-  32,  32,  32,  32,  32,  66, 111, 111, 115, 116,  13,  10, //      Boost..
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, //           </
- 104,  50,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // h2>..       
-  32,  32,  32,  60, 112,  62,  13,  10,  32,  32,  32,  32, //    <p>..    
-  32,  32,  32,  32,  32,  32,  32,  32,  60, 115, 112,  97, //         <spa
- 110,  32, 105, 100,  61,  34,  98, 111, 111, 115, 116,  84, // n id="boostT
- 105, 109, 101, 114,  34,  62,  45,  60,  47, 115, 112,  97, // imer">-</spa
- 110,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // n>..        
-  32,  32,  32,  32,  60,  98, 114,  62,  13,  10,  32,  32, //     <br>..  
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  98, //           <b
- 117, 116, 116, 111, 110,  32, 105, 100,  61,  34,  98, 116, // utton id="bt
- 110,  84, 114, 105, 103, 103, 101, 114,  34,  32,  99, 108, // nTrigger" cl
-  97, 115, 115,  61,  34,  34,  32, 111, 110,  99, 108, 105, // ass="" oncli
-  99, 107,  61,  34, 116, 114, 105, 103, 103, 101, 114,  66, // ck="triggerB
- 111, 111, 115, 116,  40,  41,  34,  62,  66, 111, 111, 115, // oost()">Boos
- 116,  60,  47,  98, 117, 116, 116, 111, 110,  62,  13,  10, // t</button>..
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, //           </
- 112,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // p>..        
+  35, 102, 102, 102,  59,  13,  10,  32,  32,  32,  32,  32, // #fff;..     
+  32,  32,  32,  98, 111, 114, 100, 101, 114,  58,  32,  49, //    border: 1
+ 112, 120,  32, 115, 111, 108, 105, 100,  59,  13,  10,  32, // px solid;.. 
+  32,  32,  32,  32,  32,  32,  32, 119, 105, 100, 116, 104, //        width
+  58,  32, 102, 105, 116,  45,  99, 111, 110, 116, 101, 110, // : fit-conten
+ 116,  59,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // t;..        
+ 112,  97, 100, 100, 105, 110, 103,  58,  32,  51, 112, 120, // padding: 3px
+  59,  13,  10,  32,  32,  32,  32,  32,  32, 125,  13,  10, // ;..      }..
+  32,  32,  32,  32, 125,  13,  10,  32,  32,  32,  32,  35, //     }..    #
+ 111, 118, 101, 114, 108,  97, 121,  32, 123,  13,  10,  32, // overlay {.. 
+  32,  32,  32,  32,  32, 112, 111, 115, 105, 116, 105, 111, //      positio
+ 110,  58,  32, 102, 105, 120, 101, 100,  59,  13,  10,  32, // n: fixed;.. 
+  32,  32,  32,  32,  32, 116, 111, 112,  58,  32,  48,  59, //      top: 0;
+  13,  10,  32,  32,  32,  32,  32,  32, 108, 101, 102, 116, // ..      left
+  58,  32,  48,  59,  13,  10,  32,  32,  32,  32,  32,  32, // : 0;..      
+ 119, 105, 100, 116, 104,  58,  32,  49,  48,  48,  37,  59, // width: 100%;
+  13,  10,  32,  32,  32,  32,  32,  32, 104, 101, 105, 103, // ..      heig
+ 104, 116,  58,  32,  49,  48,  48,  37,  59,  13,  10,  32, // ht: 100%;.. 
+  32,  32,  32,  32,  32,  98,  97,  99, 107, 103, 114, 111, //      backgro
+ 117, 110, 100,  45,  99, 111, 108, 111, 114,  58,  32, 114, // und-color: r
+ 103,  98,  97,  40,  48,  44,  32,  48,  44,  32,  48,  44, // gba(0, 0, 0,
+  32,  48,  46,  53,  41,  59,  32,  47,  42,  32,  83, 101, //  0.5); /* Se
+ 109, 105,  45, 116, 114,  97, 110, 115, 112,  97, 114, 101, // mi-transpare
+ 110, 116,  32,  98,  97,  99, 107, 103, 114, 111, 117, 110, // nt backgroun
+ 100,  32,  42,  47,  13,  10,  32,  32,  32,  32,  32,  32, // d */..      
+  99, 111, 108, 111, 114,  58,  32, 119, 104, 105, 116, 101, // color: white
+  59,  13,  10,  32,  32,  32,  32,  32,  32, 100, 105, 115, // ;..      dis
+ 112, 108,  97, 121,  58,  32, 102, 108, 101, 120,  59,  13, // play: flex;.
+  10,  32,  32,  32,  32,  32,  32, 106, 117, 115, 116, 105, // .      justi
+ 102, 121,  45,  99, 111, 110, 116, 101, 110, 116,  58,  32, // fy-content: 
+  99, 101, 110, 116, 101, 114,  59,  13,  10,  32,  32,  32, // center;..   
+  32,  32,  32,  97, 108, 105, 103, 110,  45, 105, 116, 101, //    align-ite
+ 109, 115,  58,  32,  99, 101, 110, 116, 101, 114,  59,  13, // ms: center;.
+  10,  32,  32,  32,  32,  32,  32, 122,  45, 105, 110, 100, // .      z-ind
+ 101, 120,  58,  32,  49,  48,  48,  48,  59,  32,  47,  42, // ex: 1000; /*
+  32,  83, 105, 116,  32, 111, 110,  32, 116, 111, 112,  32, //  Sit on top 
+ 111, 102,  32, 111, 116, 104, 101, 114,  32,  99, 111, 110, // of other con
+ 116, 101, 110, 116,  32,  42,  47,  13,  10,  32,  32,  32, // tent */..   
+  32, 125,  13,  10,  32,  32,  32,  32,  35, 111, 118, 101, //  }..    #ove
+ 114, 108,  97, 121,  46, 104, 105, 100, 100, 101, 110,  32, // rlay.hidden 
+ 123,  13,  10,  32,  32,  32,  32,  32,  32, 100, 105, 115, // {..      dis
+ 112, 108,  97, 121,  58,  32, 110, 111, 110, 101,  59,  13, // play: none;.
+  10,  32,  32,  32,  32, 125,  13,  10,  32,  32,  32,  32, // .    }..    
+  60,  47, 115, 116, 121, 108, 101,  62,  13,  10,  32,  32, // </style>..  
+  60,  47, 104, 101,  97, 100,  62,  13,  10,  32,  32,  60, // </head>..  <
+  98, 111, 100, 121,  62,  13,  10,  32,  32,  32,  32,  60, // body>..    <
+ 100, 105, 118,  32, 105, 100,  61,  34, 111, 118, 101, 114, // div id="over
+ 108,  97, 121,  34,  62,  67, 111, 110, 110, 101,  99, 116, // lay">Connect
+ 105, 110, 103,  46,  46,  46,  32, 112, 108, 101,  97, 115, // ing... pleas
+ 101,  32, 119,  97, 105, 116,  46,  46,  46,  60,  47, 100, // e wait...</d
+ 105, 118,  62,  13,  10,  32,  32,  32,  32,  13,  10,  32, // iv>..    .. 
+  32,  32,  32,  60, 100, 105, 118,  32,  99, 108,  97, 115, //    <div clas
+ 115,  61,  34, 116, 111, 112,  95, 110,  97, 118,  34,  62, // s="top_nav">
+  13,  10,  32,  32,  32,  32,  32,  32,  60, 104,  49,  62, // ..      <h1>
+  87,  97, 116, 101, 114,  32,  72, 101,  97, 116, 105, 110, // Water Heatin
+ 103,  60,  47, 104,  49,  62,  13,  10,  32,  32,  32,  32, // g</h1>..    
   60,  47, 100, 105, 118,  62,  13,  10,  32,  32,  32,  32, // </div>..    
-  32,  32,  32,  32,  60, 100, 105, 118,  32,  99, 108,  97, //     <div cla
- 115, 115,  61,  34,  99,  97, 114, 100,  34,  62,  13,  10, // ss="card">..
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 104, //           <h
-  50,  32, 105, 100,  61,  34,  34,  62,  13,  10,  32,  32, // 2 id="">..  
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  83, 116, //           St
-  97, 116, 117, 115,  13,  10,  32,  32,  32,  32,  32,  32, // atus..      
-  32,  32,  32,  32,  60,  47, 104,  50,  62,  13,  10,  32, //     </h2>.. 
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 112,  62, //          <p>
-  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
-  32,  32,  60, 115, 112,  97, 110,  32, 105, 100,  61,  34, //   <span id="
- 108, 111,  99,  97, 108,  84, 105, 109, 101,  34,  62,  49, // localTime">1
-  50,  58,  48,  48,  32,  65,  77,  60,  47, 115, 112,  97, // 2:00 AM</spa
- 110,  62,  60,  98, 114,  62,  13,  10,  32,  32,  32,  32, // n><br>..    
-  32,  32,  32,  32,  32,  32,  32,  32,  60, 115, 112,  97, //         <spa
- 110,  32, 105, 100,  61,  34, 104, 101,  97, 116, 105, 110, // n id="heatin
- 103,  83, 116,  97, 116, 101,  34,  62,  69,  78,  65,  66, // gState">ENAB
-  76,  69,  68,  60,  47, 115, 112,  97, 110,  62,  32,  45, // LED</span> -
-  32,  60, 115, 112,  97, 110,  32, 105, 100,  61,  34, 105, //  <span id="i
- 115,  72, 101,  97, 116, 105, 110, 103,  34,  62,  79,  70, // sHeating">OF
-  70,  60,  47, 115, 112,  97, 110,  62,  13,  10,  32,  32, // F</span>..  
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  98, //           <b
- 114,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // r>..        
-  32,  32,  32,  32,  60,  98, 117, 116, 116, 111, 110,  32, //     <button 
- 105, 100,  61,  34,  98, 116, 110,  84, 114, 105, 103, 103, // id="btnTrigg
- 101, 114,  34,  32,  99, 108,  97, 115, 115,  61,  34,  34, // er" class=""
-  32, 111, 110,  99, 108, 105,  99, 107,  61,  34, 116, 114, //  onclick="tr
- 105, 103, 103, 101, 114,  72, 101,  97, 116, 105, 110, 103, // iggerHeating
-  40,  41,  34,  62,  69, 110,  97,  98, 108, 101,  32,  47, // ()">Enable /
-  32,  68, 105, 115,  97,  98, 108, 101,  60,  47,  98, 117, //  Disable</bu
- 116, 116, 111, 110,  62,  13,  10,  32,  32,  32,  32,  32, // tton>..     
-  32,  32,  32,  32,  32,  60,  47, 112,  62,  13,  10,  32, //      </p>.. 
-  32,  32,  32,  32,  32,  32,  32,  60,  47, 100, 105, 118, //        </div
+  60, 100, 105, 118,  32,  99, 108,  97, 115, 115,  61,  34, // <div class="
+  99, 111, 110, 116, 101, 110, 116,  34,  62,  13,  10,  32, // content">.. 
+  32,  32,  32,  32,  32,  60, 100, 105, 118,  32,  99, 108, //      <div cl
+  97, 115, 115,  61,  34,  99,  97, 114, 100, 115,  34,  62, // ass="cards">
+  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  60, 100, // ..        <d
+ 105, 118,  32,  99, 108,  97, 115, 115,  61,  34,  99,  97, // iv class="ca
+ 114, 100,  34,  62,  13,  10,  32,  32,  32,  32,  32,  32, // rd">..      
+  32,  32,  32,  32,  60, 104,  50,  32, 105, 100,  61,  34, //     <h2 id="
+  34,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // ">..        
+  32,  32,  32,  32,  66, 111, 111, 115, 116,  13,  10,  32, //     Boost.. 
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, 104, //          </h
+  50,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // 2>..        
+  32,  32,  60, 112,  62,  13,  10,  32,  32,  32,  32,  32, //   <p>..     
+  32,  32,  32,  32,  32,  32,  32,  60, 115, 112,  97, 110, //        <span
+  32, 105, 100,  61,  34,  98, 111, 111, 115, 116,  84, 105, //  id="boostTi
+ 109, 101, 114,  34,  62,  45,  60,  47, 115, 112,  97, 110, // mer">-</span
+  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32, // >..         
+  32,  32,  32,  60,  98, 114,  62,  13,  10,  32,  32,  32, //    <br>..   
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  98, 117, //          <bu
+ 116, 116, 111, 110,  32, 105, 100,  61,  34,  98, 116, 110, // tton id="btn
+  84, 114, 105, 103, 103, 101, 114,  34,  32,  99, 108,  97, // Trigger" cla
+ 115, 115,  61,  34,  34,  32, 111, 110,  99, 108, 105,  99, // ss="" onclic
+ 107,  61,  34, 116, 114, 105, 103, 103, 101, 114,  66, 111, // k="triggerBo
+ 111, 115, 116,  40,  41,  34,  62,  66, 111, 111, 115, 116, // ost()">Boost
+  60,  47,  98, 117, 116, 116, 111, 110,  62,  13,  10,  32, // </button>.. 
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, 112, //          </p
   62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  60, // >..        <
- 100, 105, 118,  32,  99, 108,  97, 115, 115,  61,  34,  99, // div class="c
-  97, 114, 100,  34,  62,  13,  10,  32,  32,  32,  32,  32, // ard">..     
-  32,  32,  32,  32,  32,  60, 104,  50,  62,  13,  10,  32, //      <h2>.. 
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  84, //            T
- 105, 109, 101, 114,  32,  49,  32,  60,  98, 117, 116, 116, // imer 1 <butt
- 111, 110,  32, 105, 100,  61,  34,  98, 116, 110,  84,  49, // on id="btnT1
-  34,  32,  99, 108,  97, 115, 115,  61,  34, 115, 109,  97, // " class="sma
- 108, 108,  98, 116, 110,  34,  32, 111, 110,  99, 108, 105, // llbtn" oncli
-  99, 107,  61,  34, 101, 100, 105, 116,  84, 105, 109, 101, // ck="editTime
- 114,  40,  49,  41,  34,  62,  38,  35, 120,  49,  70,  52, // r(1)">&#x1F4
-  68,  68,  59,  60,  47,  98, 117, 116, 116, 111, 110,  62, // DD;</button>
+  47, 100, 105, 118,  62,  13,  10,  32,  32,  32,  32,  32, // /div>..     
+  32,  32,  32,  60, 100, 105, 118,  32,  99, 108,  97, 115, //    <div clas
+ 115,  61,  34,  99,  97, 114, 100,  34,  62,  13,  10,  32, // s="card">.. 
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 104,  50, //          <h2
+  32, 105, 100,  61,  34,  34,  62,  13,  10,  32,  32,  32, //  id="">..   
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  83, 116,  97, //          Sta
+ 116, 117, 115,  13,  10,  32,  32,  32,  32,  32,  32,  32, // tus..       
+  32,  32,  32,  60,  47, 104,  50,  62,  13,  10,  32,  32, //    </h2>..  
+  32,  32,  32,  32,  32,  32,  32,  32,  60, 112,  62,  13, //         <p>.
+  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // .           
+  32,  60, 115, 112,  97, 110,  32, 105, 100,  61,  34, 108, //  <span id="l
+ 111,  99,  97, 108,  84, 105, 109, 101,  34,  62,  49,  50, // ocalTime">12
+  58,  48,  48,  32,  65,  77,  60,  47, 115, 112,  97, 110, // :00 AM</span
+  62,  60,  98, 114,  62,  13,  10,  32,  32,  32,  32,  32, // ><br>..     
+  32,  32,  32,  32,  32,  32,  32,  60, 115, 112,  97, 110, //        <span
+  32, 105, 100,  61,  34, 104, 101,  97, 116, 105, 110, 103, //  id="heating
+  83, 116,  97, 116, 101,  34,  62,  69,  78,  65,  66,  76, // State">ENABL
+  69,  68,  60,  47, 115, 112,  97, 110,  62,  32,  45,  32, // ED</span> - 
+  60, 115, 112,  97, 110,  32, 105, 100,  61,  34, 105, 115, // <span id="is
+  72, 101,  97, 116, 105, 110, 103,  34,  62,  79,  70,  70, // Heating">OFF
+  60,  47, 115, 112,  97, 110,  62,  60,  98, 114,  62,  13, // </span><br>.
+  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // .           
+  32,  60, 115, 112,  97, 110,  32, 105, 100,  61,  34, 101, //  <span id="e
+ 110, 101, 114, 103, 121,  84, 111, 100,  97, 121,  34,  62, // nergyToday">
+  45,  60,  47, 115, 112,  97, 110,  62,  32, 107,  87, 104, // -</span> kWh
+  32, 116, 111, 100,  97, 121,  13,  10,  32,  32,  32,  32, //  today..    
+  32,  32,  32,  32,  32,  32,  32,  32,  60,  98, 114,  62, //         <br>
   13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
   32,  32,  60,  98, 117, 116, 116, 111, 110,  32, 105, 100, //   <button id
-  61,  34,  98, 116, 110,  67,  49,  34,  32,  99, 108,  97, // ="btnC1" cla
- 115, 115,  61,  34,  99,  97, 110,  99, 101, 108,  34,  32, // ss="cancel" 
- 111, 110,  99, 108, 105,  99, 107,  61,  34,  99,  97, 110, // onclick="can
-  99, 101, 108,  84, 105, 109, 101, 114,  40,  49,  41,  34, // celTimer(1)"
-  62,  38,  35, 120,  50,  55,  70,  50,  59,  60,  47,  98, // >&#x27F2;</b
+  61,  34,  98, 116, 110,  84, 114, 105, 103, 103, 101, 114, // ="btnTrigger
+  34,  32,  99, 108,  97, 115, 115,  61,  34,  34,  32, 111, // " class="" o
+ 110,  99, 108, 105,  99, 107,  61,  34, 116, 114, 105, 103, // nclick="trig
+ 103, 101, 114,  72, 101,  97, 116, 105, 110, 103,  40,  41, // gerHeating()
+  34,  62,  69, 110,  97,  98, 108, 101,  32,  47,  32,  68, // ">Enable / D
+ 105, 115,  97,  98, 108, 101,  60,  47,  98, 117, 116, 116, // isable</butt
+ 111, 110,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // on>..       
+  32,  32,  32,  60,  47, 112,  62,  13,  10,  32,  32,  32, //    </p>..   
+  32,  32,  32,  32,  32,  60,  47, 100, 105, 118,  62,  13, //      </div>.
+  10,  32,  32,  32,  32,  32,  32,  32,  32,  60, 100, 105, // .        <di
+ 118,  32,  99, 108,  97, 115, 115,  61,  34,  99,  97, 114, // v class="car
+ 100,  34,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // d">..       
+  32,  32,  32,  60, 104,  50,  62,  13,  10,  32,  32,  32, //    <h2>..   
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  84, 105, 109, //          Tim
+ 101, 114,  32,  49,  32,  60,  98, 117, 116, 116, 111, 110, // er 1 <button
+  32, 105, 100,  61,  34,  98, 116, 110,  84,  49,  34,  32, //  id="btnT1" 
+  99, 108,  97, 115, 115,  61,  34, 115, 109,  97, 108, 108, // class="small
+  98, 116, 110,  34,  32, 111, 110,  99, 108, 105,  99, 107, // btn" onclick
+  61,  34, 101, 100, 105, 116,  84, 105, 109, 101, 114,  40, // ="editTimer(
+  49,  41,  34,  62,  38,  35, 120,  49,  70,  52,  68,  68, // 1)">&#x1F4DD
+  59,  60,  47,  98, 117, 116, 116, 111, 110,  62,  13,  10, // ;</button>..
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
+  60,  98, 117, 116, 116, 111, 110,  32, 105, 100,  61,  34, // <button id="
+  98, 116, 110,  67,  49,  34,  32,  99, 108,  97, 115, 115, // btnC1" class
+  61,  34,  99,  97, 110,  99, 101, 108,  34,  32, 111, 110, // ="cancel" on
+  99, 108, 105,  99, 107,  61,  34,  99,  97, 110,  99, 101, // click="cance
+ 108,  84, 105, 109, 101, 114,  40,  49,  41,  34,  62,  38, // lTimer(1)">&
+  35, 120,  50,  55,  70,  50,  59,  60,  47,  98, 117, 116, // #x27F2;</but
+ 116, 111, 110,  62,  13,  10,  32,  32,  32,  32,  32,  32, // ton>..      
+  32,  32,  32,  32,  32,  32,  60,  98, 117, 116, 116, 111, //       <butto
+ 110,  32, 105, 100,  61,  34,  98, 116, 110,  65,  49,  34, // n id="btnA1"
+  32,  99, 108,  97, 115, 115,  61,  34,  99, 111, 112, 121, //  class="copy
+  98, 116, 110,  34,  32, 111, 110,  99, 108, 105,  99, 107, // btn" onclick
+  61,  34,  99, 111, 112, 121,  84, 105, 109, 101, 114,  84, // ="copyTimerT
+ 111,  65, 108, 108,  40,  49,  41,  34,  32, 116, 105, 116, // oAll(1)" tit
+ 108, 101,  61,  34,  67, 111, 112, 121,  32, 116, 111,  32, // le="Copy to 
+  97, 108, 108,  32, 116, 105, 109, 101, 114, 115,  34,  62, // all timers">
+  38,  35, 120,  49,  70,  52,  67,  66,  59,  60,  47,  98, // &#x1F4CB;</b
  117, 116, 116, 111, 110,  62,  13,  10,  32,  32,  32,  32, // utton>..    
   32,  32,  32,  32,  32,  32,  60,  47, 104,  50,  62,  13, //       </h2>.
   10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, // .          <
@@ -1433,177 +1573,210 @@ static const unsigned char v2[] = {
  101, 108,  84, 105, 109, 101, 114,  40,  50,  41,  34,  62, // elTimer(2)">
   38,  35, 120,  50,  55,  70,  50,  59,  60,  47,  98, 117, // &#x27F2;</bu
  116, 116, 111, 110,  62,  13,  10,  32,  32,  32,  32,  32, // tton>..     
-  32,  32,  32,  32,  32,  60,  47, 104,  50,  62,  13,  10, //      </h2>..
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 112, //           <p
-  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32, // >..         
-  32,  32,  32,  60, 116,  97,  98, 108, 101,  62,  13,  10, //    <table>..
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  32,  60, 116, 114,  62,  13,  10,  32,  32,  32,  32, //   <tr>..    
+  32,  32,  32,  32,  32,  32,  32,  60,  98, 117, 116, 116, //        <butt
+ 111, 110,  32, 105, 100,  61,  34,  98, 116, 110,  65,  50, // on id="btnA2
+  34,  32,  99, 108,  97, 115, 115,  61,  34,  99, 111, 112, // " class="cop
+ 121,  98, 116, 110,  34,  32, 111, 110,  99, 108, 105,  99, // ybtn" onclic
+ 107,  61,  34,  99, 111, 112, 121,  84, 105, 109, 101, 114, // k="copyTimer
+  84, 111,  65, 108, 108,  40,  50,  41,  34,  32, 116, 105, // ToAll(2)" ti
+ 116, 108, 101,  61,  34,  67, 111, 112, 121,  32, 116, 111, // tle="Copy to
+  32,  97, 108, 108,  32, 116, 105, 109, 101, 114, 115,  34, //  all timers"
+  62,  38,  35, 120,  49,  70,  52,  67,  66,  59,  60,  47, // >&#x1F4CB;</
+  98, 117, 116, 116, 111, 110,  62,  13,  10,  32,  32,  32, // button>..   
+  32,  32,  32,  32,  32,  32,  32,  60,  47, 104,  50,  62, //        </h2>
+  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
+  60, 112,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // <p>..       
+  32,  32,  32,  32,  32,  60, 116,  97,  98, 108, 101,  62, //      <table>
+  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
+  32,  32,  32,  32,  60, 116, 114,  62,  13,  10,  32,  32, //     <tr>..  
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  60, 116, 100,  32,  99, 108,  97, 115, 115,  61,  34, 116, // <td class="t
- 100,  97, 121,  34,  62,  13,  10,  32,  32,  32,  32,  32, // day">..     
+  32,  32,  60, 116, 100,  32,  99, 108,  97, 115, 115,  61, //   <td class=
+  34, 116, 100,  97, 121,  34,  62,  13,  10,  32,  32,  32, // "tday">..   
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  60, 108,  97,  98, 101, 108,  62,  77,  60,  98, 114, //  <label>M<br
-  62,  60, 105, 110, 112, 117, 116,  32, 105, 100,  61,  34, // ><input id="
- 116,  50,  68,  97, 121,  49,  34,  32, 116, 121, 112, 101, // t2Day1" type
-  61,  34,  99, 104, 101,  99, 107,  98, 111, 120,  34,  32, // ="checkbox" 
- 118,  97, 108, 117, 101,  61,  34,  48,  34,  32, 100, 105, // value="0" di
- 115,  97,  98, 108, 101, 100,  62,  60,  47, 108,  97,  98, // sabled></lab
- 101, 108,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // el>..       
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, 116, //          </t
- 100,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // d>..        
-  32,  32,  32,  32,  32,  32,  32,  32,  60, 116, 100,  32, //         <td 
-  99, 108,  97, 115, 115,  61,  34, 116, 100,  97, 121,  34, // class="tday"
+  32,  32,  32,  60, 108,  97,  98, 101, 108,  62,  77,  60, //    <label>M<
+  98, 114,  62,  60, 105, 110, 112, 117, 116,  32, 105, 100, // br><input id
+  61,  34, 116,  50,  68,  97, 121,  49,  34,  32, 116, 121, // ="t2Day1" ty
+ 112, 101,  61,  34,  99, 104, 101,  99, 107,  98, 111, 120, // pe="checkbox
+  34,  32, 118,  97, 108, 117, 101,  61,  34,  48,  34,  32, // " value="0" 
+ 100, 105, 115,  97,  98, 108, 101, 100,  62,  60,  47, 108, // disabled></l
+  97,  98, 101, 108,  62,  13,  10,  32,  32,  32,  32,  32, // abel>..     
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, //            <
+  47, 116, 100,  62,  13,  10,  32,  32,  32,  32,  32,  32, // /td>..      
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 116, //           <t
+ 100,  32,  99, 108,  97, 115, 115,  61,  34, 116, 100,  97, // d class="tda
+ 121,  34,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // y">..       
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, //            <
+ 108,  97,  98, 101, 108,  62,  84,  60,  98, 114,  62,  60, // label>T<br><
+ 105, 110, 112, 117, 116,  32, 105, 100,  61,  34, 116,  50, // input id="t2
+  68,  97, 121,  50,  34,  32, 116, 121, 112, 101,  61,  34, // Day2" type="
+  99, 104, 101,  99, 107,  98, 111, 120,  34,  32, 118,  97, // checkbox" va
+ 108, 117, 101,  61,  34,  48,  34,  32, 100, 105, 115,  97, // lue="0" disa
+  98, 108, 101, 100,  62,  60,  47, 108,  97,  98, 101, 108, // bled></label
   62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32, // >..         
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 108,  97, //          <la
-  98, 101, 108,  62,  84,  60,  98, 114,  62,  60, 105, 110, // bel>T<br><in
- 112, 117, 116,  32, 105, 100,  61,  34, 116,  50,  68,  97, // put id="t2Da
- 121,  50,  34,  32, 116, 121, 112, 101,  61,  34,  99, 104, // y2" type="ch
- 101,  99, 107,  98, 111, 120,  34,  32, 118,  97, 108, 117, // eckbox" valu
- 101,  61,  34,  48,  34,  32, 100, 105, 115,  97,  98, 108, // e="0" disabl
- 101, 100,  62,  60,  47, 108,  97,  98, 101, 108,  62,  13, // ed></label>.
+  32,  32,  32,  32,  32,  32,  32,  60,  47, 116, 100,  62, //        </td>
+  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
+  32,  32,  32,  32,  32,  32,  60, 116, 100,  32,  99, 108, //       <td cl
+  97, 115, 115,  61,  34, 116, 100,  97, 121,  34,  62,  13, // ass="tday">.
   10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // .           
-  32,  32,  32,  32,  32,  60,  47, 116, 100,  62,  13,  10, //      </td>..
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  32,  32,  32,  60, 116, 100,  32,  99, 108,  97, 115, //     <td clas
- 115,  61,  34, 116, 100,  97, 121,  34,  62,  13,  10,  32, // s="tday">.. 
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  32,  32,  32,  32,  60, 108,  97,  98, 101, 108,  62, //      <label>
-  87,  60,  98, 114,  62,  60, 105, 110, 112, 117, 116,  32, // W<br><input 
- 105, 100,  61,  34, 116,  50,  68,  97, 121,  51,  34,  32, // id="t2Day3" 
- 116, 121, 112, 101,  61,  34,  99, 104, 101,  99, 107,  98, // type="checkb
- 111, 120,  34,  32, 118,  97, 108, 117, 101,  61,  34,  48, // ox" value="0
-  34,  32, 100, 105, 115,  97,  98, 108, 101, 100,  62,  60, // " disabled><
-  47, 108,  97,  98, 101, 108,  62,  13,  10,  32,  32,  32, // /label>..   
+  32,  32,  32,  32,  32,  32,  32,  60, 108,  97,  98, 101, //        <labe
+ 108,  62,  87,  60,  98, 114,  62,  60, 105, 110, 112, 117, // l>W<br><inpu
+ 116,  32, 105, 100,  61,  34, 116,  50,  68,  97, 121,  51, // t id="t2Day3
+  34,  32, 116, 121, 112, 101,  61,  34,  99, 104, 101,  99, // " type="chec
+ 107,  98, 111, 120,  34,  32, 118,  97, 108, 117, 101,  61, // kbox" value=
+  34,  48,  34,  32, 100, 105, 115,  97,  98, 108, 101, 100, // "0" disabled
+  62,  60,  47, 108,  97,  98, 101, 108,  62,  13,  10,  32, // ></label>.. 
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  60,  47, 116, 100,  62,  13,  10,  32,  32,  32,  32, //  </td>..    
+  32,  32,  32,  60,  47, 116, 100,  62,  13,  10,  32,  32, //    </td>..  
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  60, 116, 100,  32,  99, 108,  97, 115, 115,  61,  34, 116, // <td class="t
- 100,  97, 121,  34,  62,  13,  10,  32,  32,  32,  32,  32, // day">..     
+  32,  32,  60, 116, 100,  32,  99, 108,  97, 115, 115,  61, //   <td class=
+  34, 116, 100,  97, 121,  34,  62,  13,  10,  32,  32,  32, // "tday">..   
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  60, 108,  97,  98, 101, 108,  62,  84,  60,  98, 114, //  <label>T<br
-  62,  60, 105, 110, 112, 117, 116,  32, 105, 100,  61,  34, // ><input id="
- 116,  50,  68,  97, 121,  52,  34,  32, 116, 121, 112, 101, // t2Day4" type
-  61,  34,  99, 104, 101,  99, 107,  98, 111, 120,  34,  32, // ="checkbox" 
- 118,  97, 108, 117, 101,  61,  34,  48,  34,  32, 100, 105, // value="0" di
- 115,  97,  98, 108, 101, 100,  62,  60,  47, 108,  97,  98, // sabled></lab
- 101, 108,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // el>..       
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, 116, //          </t
- 100,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // d>..        
-  32,  32,  32,  32,  32,  32,  32,  32,  60, 116, 100,  32, //         <td 
-  99, 108,  97, 115, 115,  61,  34, 116, 100,  97, 121,  34, // class="tday"
+  32,  32,  32,  60, 108,  97,  98, 101, 108,  62,  84,  60, //    <label>T<
+  98, 114,  62,  60, 105, 110, 112, 117, 116,  32, 105, 100, // br><input id
+  61,  34, 116,  50,  68,  97, 121,  52,  34,  32, 116, 121, // ="t2Day4" ty
+ 112, 101,  61,  34,  99, 104, 101,  99, 107,  98, 111, 120, // pe="checkbox
+  34,  32, 118,  97, 108, 117, 101,  61,  34,  48,  34,  32, // " value="0" 
+ 100, 105, 115,  97,  98, 108, 101, 100,  62,  60,  47, 108, // disabled></l
+  97,  98, 101, 108,  62,  13,  10,  32,  32,  32,  32,  32, // abel>..     
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, //            <
+  47, 116, 100,  62,  13,  10,  32,  32,  32,  32,  32,  32, // /td>..      
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 116, //           <t
+ 100,  32,  99, 108,  97, 115, 115,  61,  34, 116, 100,  97, // d class="tda
+ 121,  34,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // y">..       
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, //            <
+ 108,  97,  98, 101, 108,  62,  70,  60,  98, 114,  62,  60, // label>F<br><
+ 105, 110, 112, 117, 116,  32, 105, 100,  61,  34, 116,  50, // input id="t2
+  68,  97, 121,  53,  34,  32, 116, 121, 112, 101,  61,  34, // Day5" type="
+  99, 104, 101,  99, 107,  98, 111, 120,  34,  32, 118,  97, // checkbox" va
+ 108, 117, 101,  61,  34,  48,  34,  32, 100, 105, 115,  97, // lue="0" disa
+  98, 108, 101, 100,  62,  60,  47, 108,  97,  98, 101, 108, // bled></label
   62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32, // >..         
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 108,  97, //          <la
-  98, 101, 108,  62,  70,  60,  98, 114,  62,  60, 105, 110, // bel>F<br><in
- 112, 117, 116,  32, 105, 100,  61,  34, 116,  50,  68,  97, // put id="t2Da
- 121,  53,  34,  32, 116, 121, 112, 101,  61,  34,  99, 104, // y5" type="ch
- 101,  99, 107,  98, 111, 120,  34,  32, 118,  97, 108, 117, // eckbox" valu
- 101,  61,  34,  48,  34,  32, 100, 105, 115,  97,  98, 108, // e="0" disabl
- 101, 100,  62,  60,  47, 108,  97,  98, 101, 108,  62,  13, // ed></label>.
+  32,  32,  32,  32,  32,  32,  32,  60,  47, 116, 100,  62, //        </td>
+  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
+  32,  32,  32,  32,  32,  32,  60, 116, 100,  32,  99, 108, //       <td cl
+  97, 115, 115,  61,  34, 116, 100,  97, 121,  34,  62,  13, // ass="tday">.
   10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // .           
-  32,  32,  32,  32,  32,  60,  47, 116, 100,  62,  13,  10, //      </td>..
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  32,  32,  32,  60, 116, 100,  32,  99, 108,  97, 115, //     <td clas
- 115,  61,  34, 116, 100,  97, 121,  34,  62,  13,  10,  32, // s="tday">.. 
+  32,  32,  32,  32,  32,  32,  32,  60, 108,  97,  98, 101, //        <labe
+ 108,  62,  83,  60,  98, 114,  62,  60, 105, 110, 112, 117, // l>S<br><inpu
+ 116,  32, 105, 100,  61,  34, 116,  50,  68,  97, 121,  54, // t id="t2Day6
+  34,  32, 116, 121, 112, 101,  61,  34,  99, 104, 101,  99, // " type="chec
+ 107,  98, 111, 120,  34,  32, 118,  97, 108, 117, 101,  61, // kbox" value=
+  34,  48,  34,  32, 100, 105, 115,  97,  98, 108, 101, 100, // "0" disabled
+  62,  60,  47, 108,  97,  98, 101, 108,  62,  13,  10,  32, // ></label>.. 
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  32,  32,  32,  32,  60, 108,  97,  98, 101, 108,  62, //      <label>
-  83,  60,  98, 114,  62,  60, 105, 110, 112, 117, 116,  32, // S<br><input 
- 105, 100,  61,  34, 116,  50,  68,  97, 121,  54,  34,  32, // id="t2Day6" 
- 116, 121, 112, 101,  61,  34,  99, 104, 101,  99, 107,  98, // type="checkb
- 111, 120,  34,  32, 118,  97, 108, 117, 101,  61,  34,  48, // ox" value="0
-  34,  32, 100, 105, 115,  97,  98, 108, 101, 100,  62,  60, // " disabled><
-  47, 108,  97,  98, 101, 108,  62,  13,  10,  32,  32,  32, // /label>..   
+  32,  32,  32,  60,  47, 116, 100,  62,  13,  10,  32,  32, //    </td>..  
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  60,  47, 116, 100,  62,  13,  10,  32,  32,  32,  32, //  </td>..    
+  32,  32,  60, 116, 100,  32,  99, 108,  97, 115, 115,  61, //   <td class=
+  34, 116, 100,  97, 121,  34,  62,  13,  10,  32,  32,  32, // "tday">..   
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  60, 116, 100,  32,  99, 108,  97, 115, 115,  61,  34, 116, // <td class="t
- 100,  97, 121,  34,  62,  13,  10,  32,  32,  32,  32,  32, // day">..     
+  32,  32,  32,  60, 108,  97,  98, 101, 108,  62,  83,  60, //    <label>S<
+  98, 114,  62,  60, 105, 110, 112, 117, 116,  32, 105, 100, // br><input id
+  61,  34, 116,  50,  68,  97, 121,  55,  34,  32, 116, 121, // ="t2Day7" ty
+ 112, 101,  61,  34,  99, 104, 101,  99, 107,  98, 111, 120, // pe="checkbox
+  34,  32, 118,  97, 108, 117, 101,  61,  34,  48,  34,  32, // " value="0" 
+ 100, 105, 115,  97,  98, 108, 101, 100,  62,  60,  47, 108, // disabled></l
+  97,  98, 101, 108,  62,  13,  10,  32,  32,  32,  32,  32, // abel>..     
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, //            <
+  47, 116, 100,  62,  13,  10,  32,  32,  32,  32,  32,  32, // /td>..      
+  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, 116, 114, //         </tr
+  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32, // >..         
+  32,  32,  32,  60,  47, 116,  97,  98, 108, 101,  62,  13, //    </table>.
+  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, // .          <
+  47, 112,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // /p>..       
+  32,  32,  32,  60, 112,  62,  13,  10,  32,  32,  32,  32, //    <p>..    
+  32,  32,  32,  32,  32,  32,  32,  32,  79,  78,  58,  32, //         ON: 
+  60, 115, 112,  97, 110,  32, 105, 100,  61,  34, 116,  50, // <span id="t2
+  79, 110,  34,  62,  49,  50,  58,  48,  48,  32,  65,  77, // On">12:00 AM
+  60,  47, 115, 112,  97, 110,  62,  13,  10,  32,  32,  32, // </span>..   
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  98, 114, //          <br
+  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32, // >..         
+  32,  32,  32,  60, 105, 110, 112, 117, 116,  32, 105, 100, //    <input id
+  61,  34, 116,  50,  79, 110,  73, 110, 112, 117, 116,  34, // ="t2OnInput"
+  32, 111, 110, 105, 110, 112, 117, 116,  61,  34, 109, 111, //  oninput="mo
+ 118, 101,  84, 105, 109, 101,  40,  50,  44,  32,  39,  79, // veTime(2, 'O
+ 110,  39,  41,  34,  32, 116, 121, 112, 101,  61,  34, 114, // n')" type="r
+  97, 110, 103, 101,  34,  32, 109, 105, 110,  61,  34,  48, // ange" min="0
+  34,  32, 109,  97, 120,  61,  34,  49,  52,  49,  48,  34, // " max="1410"
+  32, 115, 116, 101, 112,  61,  34,  49,  53,  34,  32, 118, //  step="15" v
+  97, 108, 117, 101,  61,  34,  48,  34,  32, 100, 105, 115, // alue="0" dis
+  97,  98, 108, 101, 100,  62,  13,  10,  32,  32,  32,  32, // abled>..    
+  32,  32,  32,  32,  32,  32,  60,  47, 112,  62,  13,  10, //       </p>..
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 112, //           <p
+  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32, // >..         
+  32,  32,  32,  79,  70,  70,  58,  32,  60, 115, 112,  97, //    OFF: <spa
+ 110,  32, 105, 100,  61,  34, 116,  50,  79, 102, 102,  34, // n id="t2Off"
+  62,  49,  50,  58,  48,  48,  32,  65,  77,  60,  47, 115, // >12:00 AM</s
+ 112,  97, 110,  62,  13,  10,  32,  32,  32,  32,  32,  32, // pan>..      
+  32,  32,  32,  32,  32,  32,  60,  98, 114,  62,  13,  10, //       <br>..
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  60, 108,  97,  98, 101, 108,  62,  83,  60,  98, 114, //  <label>S<br
-  62,  60, 105, 110, 112, 117, 116,  32, 105, 100,  61,  34, // ><input id="
- 116,  50,  68,  97, 121,  55,  34,  32, 116, 121, 112, 101, // t2Day7" type
-  61,  34,  99, 104, 101,  99, 107,  98, 111, 120,  34,  32, // ="checkbox" 
- 118,  97, 108, 117, 101,  61,  34,  48,  34,  32, 100, 105, // value="0" di
- 115,  97,  98, 108, 101, 100,  62,  60,  47, 108,  97,  98, // sabled></lab
- 101, 108,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // el>..       
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, 116, //          </t
- 100,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // d>..        
-  32,  32,  32,  32,  32,  32,  60,  47, 116, 114,  62,  13, //       </tr>.
-  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // .           
-  32,  60,  47, 116,  97,  98, 108, 101,  62,  13,  10,  32, //  </table>.. 
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, 112, //          </p
+  60, 105, 110, 112, 117, 116,  32, 105, 100,  61,  34, 116, // <input id="t
+  50,  79, 102, 102,  73, 110, 112, 117, 116,  34,  32, 111, // 2OffInput" o
+ 110, 105, 110, 112, 117, 116,  61,  34, 109, 111, 118, 101, // ninput="move
+  84, 105, 109, 101,  40,  50,  44,  32,  39,  79, 102, 102, // Time(2, 'Off
+  39,  41,  34,  32, 116, 121, 112, 101,  61,  34, 114,  97, // ')" type="ra
+ 110, 103, 101,  34,  32, 109, 105, 110,  61,  34,  48,  34, // nge" min="0"
+  32, 109,  97, 120,  61,  34,  49,  52,  49,  48,  34,  32, //  max="1410" 
+ 115, 116, 101, 112,  61,  34,  49,  53,  34,  32, 118,  97, // step="15" va
+ 108, 117, 101,  61,  34,  48,  34,  32, 100, 105, 115,  97, // lue="0" disa
+  98, 108, 101, 100,  62,  13,  10,  32,  32,  32,  32,  32, // bled>..     
+  32,  32,  32,  32,  32,  60,  47, 112,  62,  13,  10,  32, //      </p>.. 
+  32,  32,  32,  32,  32,  32,  32,  60,  47, 100, 105, 118, //        </div
+  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  60, // >..        <
+ 100, 105, 118,  32,  99, 108,  97, 115, 115,  61,  34,  99, // div class="c
+  97, 114, 100,  34,  62,  13,  10,  32,  32,  32,  32,  32, // ard">..     
+  32,  32,  32,  32,  32,  60, 104,  50,  62,  13,  10,  32, //      <h2>.. 
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  84, //            T
+ 105, 109, 101, 114,  32,  51,  32,  60,  98, 117, 116, 116, // imer 3 <butt
+ 111, 110,  32, 105, 100,  61,  34,  98, 116, 110,  84,  51, // on id="btnT3
+  34,  32,  99, 108,  97, 115, 115,  61,  34, 115, 109,  97, // " class="sma
+ 108, 108,  98, 116, 110,  34,  32, 111, 110,  99, 108, 105, // llbtn" oncli
+  99, 107,  61,  34, 101, 100, 105, 116,  84, 105, 109, 101, // ck="editTime
+ 114,  40,  51,  41,  34,  62,  38,  35, 120,  49,  70,  52, // r(3)">&#x1F4
+  68,  68,  59,  60,  47,  98, 117, 116, 116, 111, 110,  62, // DD;</button>
+  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
+  32,  32,  60,  98, 117, 116, 116, 111, 110,  32, 105, 100, //   <button id
+  61,  34,  98, 116, 110,  67,  51,  34,  32,  99, 108,  97, // ="btnC3" cla
+ 115, 115,  61,  34,  99,  97, 110,  99, 101, 108,  34,  32, // ss="cancel" 
+ 111, 110,  99, 108, 105,  99, 107,  61,  34,  99,  97, 110, // onclick="can
+  99, 101, 108,  84, 105, 109, 101, 114,  40,  51,  41,  34, // celTimer(3)"
+  62,  38,  35, 120,  50,  55,  70,  50,  59,  60,  47,  98, // >&#x27F2;</b
+ 117, 116, 116, 111, 110,  62,  13,  10,  32,  32,  32,  32, // utton>..    
+  32,  32,  32,  32,  32,  32,  32,  32,  60,  98, 117, 116, //         <but
+ 116, 111, 110,  32, 105, 100,  61,  34,  98, 116, 110,  65, // ton id="btnA
+  51,  34,  32,  99, 108,  97, 115, 115,  61,  34,  99, 111, // 3" class="co
+ 112, 121,  98, 116, 110,  34,  32, 111, 110,  99, 108, 105, // pybtn" oncli
+  99, 107,  61,  34,  99, 111, 112, 121,  84, 105, 109, 101, // ck="copyTime
+ 114,  84, 111,  65, 108, 108,  40,  51,  41,  34,  32, 116, // rToAll(3)" t
+ 105, 116, 108, 101,  61,  34,  67, 111, 112, 121,  32, 116, // itle="Copy t
+ 111,  32,  97, 108, 108,  32, 116, 105, 109, 101, 114, 115, // o all timers
+  34,  62,  38,  35, 120,  49,  70,  52,  67,  66,  59,  60, // ">&#x1F4CB;<
+  47,  98, 117, 116, 116, 111, 110,  62,  13,  10,  32,  32, // /button>..  
+  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, 104,  50, //         </h2
   62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32, // >..         
   32,  60, 112,  62,  13,  10,  32,  32,  32,  32,  32,  32, //  <p>..      
-  32,  32,  32,  32,  32,  32,  79,  78,  58,  32,  60, 115, //       ON: <s
- 112,  97, 110,  32, 105, 100,  61,  34, 116,  50,  79, 110, // pan id="t2On
-  34,  62,  49,  50,  58,  48,  48,  32,  65,  77,  60,  47, // ">12:00 AM</
- 115, 112,  97, 110,  62,  13,  10,  32,  32,  32,  32,  32, // span>..     
-  32,  32,  32,  32,  32,  32,  32,  60,  98, 114,  62,  13, //        <br>.
-  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // .           
-  32,  60, 105, 110, 112, 117, 116,  32, 105, 100,  61,  34, //  <input id="
- 116,  50,  79, 110,  73, 110, 112, 117, 116,  34,  32, 111, // t2OnInput" o
- 110, 105, 110, 112, 117, 116,  61,  34, 109, 111, 118, 101, // ninput="move
-  84, 105, 109, 101,  40,  50,  44,  32,  39,  79, 110,  39, // Time(2, 'On'
-  41,  34,  32, 116, 121, 112, 101,  61,  34, 114,  97, 110, // )" type="ran
- 103, 101,  34,  32, 109, 105, 110,  61,  34,  48,  34,  32, // ge" min="0" 
- 109,  97, 120,  61,  34,  49,  52,  49,  48,  34,  32, 115, // max="1410" s
- 116, 101, 112,  61,  34,  49,  53,  34,  32, 118,  97, 108, // tep="15" val
- 117, 101,  61,  34,  48,  34,  32, 100, 105, 115,  97,  98, // ue="0" disab
- 108, 101, 100,  62,  13,  10,  32,  32,  32,  32,  32,  32, // led>..      
-  32,  32,  32,  32,  60,  47, 112,  62,  13,  10,  32,  32, //     </p>..  
-  32,  32,  32,  32,  32,  32,  32,  32,  60, 112,  62,  13, //         <p>.
-  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // .           
-  32,  79,  70,  70,  58,  32,  60, 115, 112,  97, 110,  32, //  OFF: <span 
- 105, 100,  61,  34, 116,  50,  79, 102, 102,  34,  62,  49, // id="t2Off">1
-  50,  58,  48,  48,  32,  65,  77,  60,  47, 115, 112,  97, // 2:00 AM</spa
- 110,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // n>..        
-  32,  32,  32,  32,  60,  98, 114,  62,  13,  10,  32,  32, //     <br>..  
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 105, //           <i
- 110, 112, 117, 116,  32, 105, 100,  61,  34, 116,  50,  79, // nput id="t2O
- 102, 102,  73, 110, 112, 117, 116,  34,  32, 111, 110, 105, // ffInput" oni
- 110, 112, 117, 116,  61,  34, 109, 111, 118, 101,  84, 105, // nput="moveTi
- 109, 101,  40,  50,  44,  32,  39,  79, 102, 102,  39,  41, // me(2, 'Off')
-  34,  32, 116, 121, 112, 101,  61,  34, 114,  97, 110, 103, // " type="rang
- 101,  34,  32, 109, 105, 110,  61,  34,  48,  34,  32, 109, // e" min="0" m
-  97, 120,  61,  34,  49,  52,  49,  48,  34,  32, 115, 116, // ax="1410" st
- 101, 112,  61,  34,  49,  53,  34,  32, 118,  97, 108, 117, // ep="15" valu
- 101,  61,  34,  48,  34,  32, 100, 105, 115,  97,  98, 108, // e="0" disabl
- 101, 100,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // ed>..       
-  32,  32,  32,  60,  47, 112,  62,  13,  10,  32,  32,  32, //    </p>..   
-  32,  32,  32,  32,  32,  60,  47, 100, 105, 118,  62,  13, //      </div>.
-  10,  32,  32,  32,  32,  32,  32,  32,  32,  60, 100, 105, // .        <di
- 118,  32,  99, 108,  97, 115, 115,  61,  34,  99,  97, 114, // v class="car
- 100,  34,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // d">..       
-  32,  32,  32,  60, 104,  50,  62,  13,  10,  32,  32,  32, //    <h2>..   
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  84, 105, 109, //          Tim
- 101, 114,  32,  51,  32,  60,  98, 117, 116, 116, 111, 110, // er 3 <button
-  32, 105, 100,  61,  34,  98, 116, 110,  84,  51,  34,  32, //  id="btnT3" 
-  99, 108,  97, 115, 115,  61,  34, 115, 109,  97, 108, 108, // class="small
-  98, 116, 110,  34,  32, 111, 110,  99, 108, 105,  99, 107, // btn" onclick
-  61,  34, 101, 100, 105, 116,  84, 105, 109, 101, 114,  40, // ="editTimer(
-  51,  41,  34,  62,  38,  35, 120,  49,  70,  52,  68,  68, // 3)">&#x1F4DD
-  59,  60,  47,  98, 117, 116, 116, 111, 110,  62,  13,  10, // ;</button>..
+  32,  32,  32,  32,  32,  32,  60, 116,  97,  98, 108, 101, //       <table
+  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32, // >..         
+  32,  32,  32,  32,  32,  60, 116, 114,  62,  13,  10,  32, //      <tr>.. 
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  60,  98, 117, 116, 116, 111, 110,  32, 105, 100,  61,  34, // <button id="
-  98, 116, 110,  67,  51,  34,  32,  99, 108,  97, 115, 115, // btnC3" class
-  61,  34,  99,  97, 110,  99, 101, 108,  34,  32, 111, 110, // ="cancel" on
-  99, 108, 105,  99, 107,  61,  34,  99,  97, 110,  99, 101, // click="cance
- 108,  84, 105, 109, 101, 114,  40,  51,  41,  34,  62,  38, // lTimer(3)">&
-  35, 120,  50,  55,  70,  50,  59,  60,  47,  98, 117, 116, // #x27F2;</but
- 116, 111, 110,  62,  13,  10,  32,  32,  32,  32,  32,  32, // ton>..      
-  32,  32,  32,  32,  60,  47, 104,  50,  62,  13,  10,  32, //     </h2>.. 
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 112,  62, //          <p>
-  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
-  32,  32,  60, 116,  97,  98, 108, 101,  62,  13,  10,  32, //   <table>.. 
+  32,  32,  32,  60, 116, 100,  32,  99, 108,  97, 115, 115, //    <td class
+  61,  34, 116, 100,  97, 121,  34,  62,  13,  10,  32,  32, // ="tday">..  
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
+  32,  32,  32,  32,  60, 108,  97,  98, 101, 108,  62,  77, //     <label>M
+  60,  98, 114,  62,  60, 105, 110, 112, 117, 116,  32, 105, // <br><input i
+ 100,  61,  34, 116,  51,  68,  97, 121,  49,  34,  32, 116, // d="t3Day1" t
+ 121, 112, 101,  61,  34,  99, 104, 101,  99, 107,  98, 111, // ype="checkbo
+ 120,  34,  32, 118,  97, 108, 117, 101,  61,  34,  48,  34, // x" value="0"
+  32, 100, 105, 115,  97,  98, 108, 101, 100,  62,  60,  47, //  disabled></
+ 108,  97,  98, 101, 108,  62,  13,  10,  32,  32,  32,  32, // label>..    
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  60, 116, 114,  62,  13,  10,  32,  32,  32,  32,  32, //  <tr>..     
+  60,  47, 116, 100,  62,  13,  10,  32,  32,  32,  32,  32, // </td>..     
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, //            <
  116, 100,  32,  99, 108,  97, 115, 115,  61,  34, 116, 100, // td class="td
   97, 121,  34,  62,  13,  10,  32,  32,  32,  32,  32,  32, // ay">..      
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  60, 108,  97,  98, 101, 108,  62,  77,  60,  98, 114,  62, // <label>M<br>
+  60, 108,  97,  98, 101, 108,  62,  84,  60,  98, 114,  62, // <label>T<br>
   60, 105, 110, 112, 117, 116,  32, 105, 100,  61,  34, 116, // <input id="t
-  51,  68,  97, 121,  49,  34,  32, 116, 121, 112, 101,  61, // 3Day1" type=
+  51,  68,  97, 121,  50,  34,  32, 116, 121, 112, 101,  61, // 3Day2" type=
   34,  99, 104, 101,  99, 107,  98, 111, 120,  34,  32, 118, // "checkbox" v
   97, 108, 117, 101,  61,  34,  48,  34,  32, 100, 105, 115, // alue="0" dis
   97,  98, 108, 101, 100,  62,  60,  47, 108,  97,  98, 101, // abled></labe
@@ -1614,9 +1787,9 @@ static const unsigned char v2[] = {
  108,  97, 115, 115,  61,  34, 116, 100,  97, 121,  34,  62, // lass="tday">
   13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
   32,  32,  32,  32,  32,  32,  32,  32,  60, 108,  97,  98, //         <lab
- 101, 108,  62,  84,  60,  98, 114,  62,  60, 105, 110, 112, // el>T<br><inp
+ 101, 108,  62,  87,  60,  98, 114,  62,  60, 105, 110, 112, // el>W<br><inp
  117, 116,  32, 105, 100,  61,  34, 116,  51,  68,  97, 121, // ut id="t3Day
-  50,  34,  32, 116, 121, 112, 101,  61,  34,  99, 104, 101, // 2" type="che
+  51,  34,  32, 116, 121, 112, 101,  61,  34,  99, 104, 101, // 3" type="che
   99, 107,  98, 111, 120,  34,  32, 118,  97, 108, 117, 101, // ckbox" value
   61,  34,  48,  34,  32, 100, 105, 115,  97,  98, 108, 101, // ="0" disable
  100,  62,  60,  47, 108,  97,  98, 101, 108,  62,  13,  10, // d></label>..
@@ -1626,9 +1799,9 @@ static const unsigned char v2[] = {
   32,  32,  32,  60, 116, 100,  32,  99, 108,  97, 115, 115, //    <td class
   61,  34, 116, 100,  97, 121,  34,  62,  13,  10,  32,  32, // ="tday">..  
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  32,  32,  32,  60, 108,  97,  98, 101, 108,  62,  87, //     <label>W
+  32,  32,  32,  32,  60, 108,  97,  98, 101, 108,  62,  84, //     <label>T
   60,  98, 114,  62,  60, 105, 110, 112, 117, 116,  32, 105, // <br><input i
- 100,  61,  34, 116,  51,  68,  97, 121,  51,  34,  32, 116, // d="t3Day3" t
+ 100,  61,  34, 116,  51,  68,  97, 121,  52,  34,  32, 116, // d="t3Day4" t
  121, 112, 101,  61,  34,  99, 104, 101,  99, 107,  98, 111, // ype="checkbo
  120,  34,  32, 118,  97, 108, 117, 101,  61,  34,  48,  34, // x" value="0"
   32, 100, 105, 115,  97,  98, 108, 101, 100,  62,  60,  47, //  disabled></
@@ -1639,9 +1812,9 @@ static const unsigned char v2[] = {
  116, 100,  32,  99, 108,  97, 115, 115,  61,  34, 116, 100, // td class="td
   97, 121,  34,  62,  13,  10,  32,  32,  32,  32,  32,  32, // ay">..      
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  60, 108,  97,  98, 101, 108,  62,  84,  60,  98, 114,  62, // <label>T<br>
+  60, 108,  97,  98, 101, 108,  62,  70,  60,  98, 114,  62, // <label>F<br>
   60, 105, 110, 112, 117, 116,  32, 105, 100,  61,  34, 116, // <input id="t
-  51,  68,  97, 121,  52,  34,  32, 116, 121, 112, 101,  61, // 3Day4" type=
+  51,  68,  97, 121,  53,  34,  32, 116, 121, 112, 101,  61, // 3Day5" type=
   34,  99, 104, 101,  99, 107,  98, 111, 120,  34,  32, 118, // "checkbox" v
   97, 108, 117, 101,  61,  34,  48,  34,  32, 100, 105, 115, // alue="0" dis
   97,  98, 108, 101, 100,  62,  60,  47, 108,  97,  98, 101, // abled></labe
@@ -1652,9 +1825,9 @@ static const unsigned char v2[] = {
  108,  97, 115, 115,  61,  34, 116, 100,  97, 121,  34,  62, // lass="tday">
   13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
   32,  32,  32,  32,  32,  32,  32,  32,  60, 108,  97,  98, //         <lab
- 101, 108,  62,  70,  60,  98, 114,  62,  60, 105, 110, 112, // el>F<br><inp
+ 101, 108,  62,  83,  60,  98, 114,  62,  60, 105, 110, 112, // el>S<br><inp
  117, 116,  32, 105, 100,  61,  34, 116,  51,  68,  97, 121, // ut id="t3Day
-  53,  34,  32, 116, 121, 112, 101,  61,  34,  99, 104, 101, // 5" type="che
+  54,  34,  32, 116, 121, 112, 101,  61,  34,  99, 104, 101, // 6" type="che
   99, 107,  98, 111, 120,  34,  32, 118,  97, 108, 117, 101, // ckbox" value
   61,  34,  48,  34,  32, 100, 105, 115,  97,  98, 108, 101, // ="0" disable
  100,  62,  60,  47, 108,  97,  98, 101, 108,  62,  13,  10, // d></label>..
@@ -1666,272 +1839,267 @@ static const unsigned char v2[] = {
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
   32,  32,  32,  32,  60, 108,  97,  98, 101, 108,  62,  83, //     <label>S
   60,  98, 114,  62,  60, 105, 110, 112, 117, 116,  32, 105, // <br><input i
- 100,  61,  34, 116,  51,  68,  97, 121,  54,  34,  32, 116, // d="t3Day6" t
+ 100,  61,  34, 116,  51,  68,  97, 121,  55,  34,  32, 116, // d="t3Day7" t
  121, 112, 101,  61,  34,  99, 104, 101,  99, 107,  98, 111, // ype="checkbo
  120,  34,  32, 118,  97, 108, 117, 101,  61,  34,  48,  34, // x" value="0"
   32, 100, 105, 115,  97,  98, 108, 101, 100,  62,  60,  47, //  disabled></
  108,  97,  98, 101, 108,  62,  13,  10,  32,  32,  32,  32, // label>..    
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
   60,  47, 116, 100,  62,  13,  10,  32,  32,  32,  32,  32, // </td>..     
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, //            <
- 116, 100,  32,  99, 108,  97, 115, 115,  61,  34, 116, 100, // td class="td
-  97, 121,  34,  62,  13,  10,  32,  32,  32,  32,  32,  32, // ay">..      
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  60, 108,  97,  98, 101, 108,  62,  83,  60,  98, 114,  62, // <label>S<br>
-  60, 105, 110, 112, 117, 116,  32, 105, 100,  61,  34, 116, // <input id="t
-  51,  68,  97, 121,  55,  34,  32, 116, 121, 112, 101,  61, // 3Day7" type=
-  34,  99, 104, 101,  99, 107,  98, 111, 120,  34,  32, 118, // "checkbox" v
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, 116, //          </t
+ 114,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // r>..        
+  32,  32,  32,  32,  60,  47, 116,  97,  98, 108, 101,  62, //     </table>
+  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
+  60,  47, 112,  62,  13,  10,  32,  32,  32,  32,  32,  32, // </p>..      
+  32,  32,  32,  32,  60, 112,  62,  13,  10,  32,  32,  32, //     <p>..   
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  79,  78,  58, //          ON:
+  32,  60, 115, 112,  97, 110,  32, 105, 100,  61,  34, 116, //  <span id="t
+  51,  79, 110,  34,  62,  49,  50,  58,  48,  48,  32,  65, // 3On">12:00 A
+  77,  60,  47, 115, 112,  97, 110,  62,  13,  10,  32,  32, // M</span>..  
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  98, //           <b
+ 114,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // r>..        
+  32,  32,  32,  32,  60, 105, 110, 112, 117, 116,  32, 105, //     <input i
+ 100,  61,  34, 116,  51,  79, 110,  73, 110, 112, 117, 116, // d="t3OnInput
+  34,  32, 111, 110, 105, 110, 112, 117, 116,  61,  34, 109, // " oninput="m
+ 111, 118, 101,  84, 105, 109, 101,  40,  51,  44,  32,  39, // oveTime(3, '
+  79, 110,  39,  41,  34,  32, 116, 121, 112, 101,  61,  34, // On')" type="
+ 114,  97, 110, 103, 101,  34,  32, 109, 105, 110,  61,  34, // range" min="
+  48,  34,  32, 109,  97, 120,  61,  34,  49,  52,  49,  48, // 0" max="1410
+  34,  32, 115, 116, 101, 112,  61,  34,  49,  53,  34,  32, // " step="15" 
+ 118,  97, 108, 117, 101,  61,  34,  48,  34,  32, 100, 105, // value="0" di
+ 115,  97,  98, 108, 101, 100,  62,  13,  10,  32,  32,  32, // sabled>..   
+  32,  32,  32,  32,  32,  32,  32,  60,  47, 112,  62,  13, //        </p>.
+  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, // .          <
+ 112,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // p>..        
+  32,  32,  32,  32,  79,  70,  70,  58,  32,  60, 115, 112, //     OFF: <sp
+  97, 110,  32, 105, 100,  61,  34, 116,  51,  79, 102, 102, // an id="t3Off
+  34,  62,  49,  50,  58,  48,  48,  32,  65,  77,  60,  47, // ">12:00 AM</
+ 115, 112,  97, 110,  62,  13,  10,  32,  32,  32,  32,  32, // span>..     
+  32,  32,  32,  32,  32,  32,  32,  60,  98, 114,  62,  13, //        <br>.
+  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // .           
+  32,  60, 105, 110, 112, 117, 116,  32, 105, 100,  61,  34, //  <input id="
+ 116,  51,  79, 102, 102,  73, 110, 112, 117, 116,  34,  32, // t3OffInput" 
+ 111, 110, 105, 110, 112, 117, 116,  61,  34, 109, 111, 118, // oninput="mov
+ 101,  84, 105, 109, 101,  40,  51,  44,  32,  39,  79, 102, // eTime(3, 'Of
+ 102,  39,  41,  34,  32, 116, 121, 112, 101,  61,  34, 114, // f')" type="r
+  97, 110, 103, 101,  34,  32, 109, 105, 110,  61,  34,  48, // ange" min="0
+  34,  32, 109,  97, 120,  61,  34,  49,  52,  49,  48,  34, // " max="1410"
+  32, 115, 116, 101, 112,  61,  34,  49,  53,  34,  32, 118, //  step="15" v
   97, 108, 117, 101,  61,  34,  48,  34,  32, 100, 105, 115, // alue="0" dis
-  97,  98, 108, 101, 100,  62,  60,  47, 108,  97,  98, 101, // abled></labe
- 108,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // l>..        
-  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, 116, 100, //         </td
+  97,  98, 108, 101, 100,  62,  13,  10,  32,  32,  32,  32, // abled>..    
+  32,  32,  32,  32,  32,  32,  60,  47, 112,  62,  13,  10, //       </p>..
+  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, 100, 105, //         </di
+ 118,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // v>..        
+  60, 100, 105, 118,  32,  99, 108,  97, 115, 115,  61,  34, // <div class="
+  99,  97, 114, 100,  34,  62,  13,  10,  32,  32,  32,  32, // card">..    
+  32,  32,  32,  32,  32,  32,  60, 104,  50,  62,  13,  10, //       <h2>..
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
+  84, 105, 109, 101, 114,  32,  52,  32,  60,  98, 117, 116, // Timer 4 <but
+ 116, 111, 110,  32, 105, 100,  61,  34,  98, 116, 110,  84, // ton id="btnT
+  52,  34,  32,  99, 108,  97, 115, 115,  61,  34, 115, 109, // 4" class="sm
+  97, 108, 108,  98, 116, 110,  34,  32, 111, 110,  99, 108, // allbtn" oncl
+ 105,  99, 107,  61,  34, 101, 100, 105, 116,  84, 105, 109, // ick="editTim
+ 101, 114,  40,  52,  41,  34,  62,  38,  35, 120,  49,  70, // er(4)">&#x1F
+  52,  68,  68,  59,  60,  47,  98, 117, 116, 116, 111, 110, // 4DD;</button
   62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32, // >..         
-  32,  32,  32,  32,  32,  60,  47, 116, 114,  62,  13,  10, //      </tr>..
+  32,  32,  32,  60,  98, 117, 116, 116, 111, 110,  32, 105, //    <button i
+ 100,  61,  34,  98, 116, 110,  67,  52,  34,  32,  99, 108, // d="btnC4" cl
+  97, 115, 115,  61,  34,  99,  97, 110,  99, 101, 108,  34, // ass="cancel"
+  32, 111, 110,  99, 108, 105,  99, 107,  61,  34,  99,  97, //  onclick="ca
+ 110,  99, 101, 108,  84, 105, 109, 101, 114,  40,  52,  41, // ncelTimer(4)
+  34,  62,  38,  35, 120,  50,  55,  70,  50,  59,  60,  47, // ">&#x27F2;</
+  98, 117, 116, 116, 111, 110,  62,  13,  10,  32,  32,  32, // button>..   
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  98, 117, //          <bu
+ 116, 116, 111, 110,  32, 105, 100,  61,  34,  98, 116, 110, // tton id="btn
+  65,  52,  34,  32,  99, 108,  97, 115, 115,  61,  34,  99, // A4" class="c
+ 111, 112, 121,  98, 116, 110,  34,  32, 111, 110,  99, 108, // opybtn" oncl
+ 105,  99, 107,  61,  34,  99, 111, 112, 121,  84, 105, 109, // ick="copyTim
+ 101, 114,  84, 111,  65, 108, 108,  40,  52,  41,  34,  32, // erToAll(4)" 
+ 116, 105, 116, 108, 101,  61,  34,  67, 111, 112, 121,  32, // title="Copy 
+ 116, 111,  32,  97, 108, 108,  32, 116, 105, 109, 101, 114, // to all timer
+ 115,  34,  62,  38,  35, 120,  49,  70,  52,  67,  66,  59, // s">&#x1F4CB;
+  60,  47,  98, 117, 116, 116, 111, 110,  62,  13,  10,  32, // </button>.. 
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, 104, //          </h
+  50,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // 2>..        
+  32,  32,  60, 112,  62,  13,  10,  32,  32,  32,  32,  32, //   <p>..     
+  32,  32,  32,  32,  32,  32,  32,  60, 116,  97,  98, 108, //        <tabl
+ 101,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // e>..        
+  32,  32,  32,  32,  32,  32,  60, 116, 114,  62,  13,  10, //       <tr>..
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  60,  47, 116,  97,  98, 108, 101,  62,  13,  10,  32,  32, // </table>..  
-  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, 112,  62, //         </p>
-  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
-  60, 112,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // <p>..       
-  32,  32,  32,  32,  32,  79,  78,  58,  32,  60, 115, 112, //      ON: <sp
-  97, 110,  32, 105, 100,  61,  34, 116,  51,  79, 110,  34, // an id="t3On"
-  62,  49,  50,  58,  48,  48,  32,  65,  77,  60,  47, 115, // >12:00 AM</s
- 112,  97, 110,  62,  13,  10,  32,  32,  32,  32,  32,  32, // pan>..      
-  32,  32,  32,  32,  32,  32,  60,  98, 114,  62,  13,  10, //       <br>..
+  32,  32,  32,  32,  60, 116, 100,  32,  99, 108,  97, 115, //     <td clas
+ 115,  61,  34, 116, 100,  97, 121,  34,  62,  13,  10,  32, // s="tday">.. 
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  60, 105, 110, 112, 117, 116,  32, 105, 100,  61,  34, 116, // <input id="t
-  51,  79, 110,  73, 110, 112, 117, 116,  34,  32, 111, 110, // 3OnInput" on
- 105, 110, 112, 117, 116,  61,  34, 109, 111, 118, 101,  84, // input="moveT
- 105, 109, 101,  40,  51,  44,  32,  39,  79, 110,  39,  41, // ime(3, 'On')
-  34,  32, 116, 121, 112, 101,  61,  34, 114,  97, 110, 103, // " type="rang
- 101,  34,  32, 109, 105, 110,  61,  34,  48,  34,  32, 109, // e" min="0" m
-  97, 120,  61,  34,  49,  52,  49,  48,  34,  32, 115, 116, // ax="1410" st
- 101, 112,  61,  34,  49,  53,  34,  32, 118,  97, 108, 117, // ep="15" valu
- 101,  61,  34,  48,  34,  32, 100, 105, 115,  97,  98, 108, // e="0" disabl
- 101, 100,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // ed>..       
-  32,  32,  32,  60,  47, 112,  62,  13,  10,  32,  32,  32, //    </p>..   
-  32,  32,  32,  32,  32,  32,  32,  60, 112,  62,  13,  10, //        <p>..
+  32,  32,  32,  32,  32,  60, 108,  97,  98, 101, 108,  62, //      <label>
+  77,  60,  98, 114,  62,  60, 105, 110, 112, 117, 116,  32, // M<br><input 
+ 105, 100,  61,  34, 116,  52,  68,  97, 121,  49,  34,  32, // id="t4Day1" 
+ 116, 121, 112, 101,  61,  34,  99, 104, 101,  99, 107,  98, // type="checkb
+ 111, 120,  34,  32, 118,  97, 108, 117, 101,  61,  34,  48, // ox" value="0
+  34,  32, 100, 105, 115,  97,  98, 108, 101, 100,  62,  60, // " disabled><
+  47, 108,  97,  98, 101, 108,  62,  13,  10,  32,  32,  32, // /label>..   
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  79,  70,  70,  58,  32,  60, 115, 112,  97, 110,  32, 105, // OFF: <span i
- 100,  61,  34, 116,  51,  79, 102, 102,  34,  62,  49,  50, // d="t3Off">12
-  58,  48,  48,  32,  65,  77,  60,  47, 115, 112,  97, 110, // :00 AM</span
-  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32, // >..         
-  32,  32,  32,  60,  98, 114,  62,  13,  10,  32,  32,  32, //    <br>..   
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 105, 110, //          <in
- 112, 117, 116,  32, 105, 100,  61,  34, 116,  51,  79, 102, // put id="t3Of
- 102,  73, 110, 112, 117, 116,  34,  32, 111, 110, 105, 110, // fInput" onin
- 112, 117, 116,  61,  34, 109, 111, 118, 101,  84, 105, 109, // put="moveTim
- 101,  40,  51,  44,  32,  39,  79, 102, 102,  39,  41,  34, // e(3, 'Off')"
-  32, 116, 121, 112, 101,  61,  34, 114,  97, 110, 103, 101, //  type="range
-  34,  32, 109, 105, 110,  61,  34,  48,  34,  32, 109,  97, // " min="0" ma
- 120,  61,  34,  49,  52,  49,  48,  34,  32, 115, 116, 101, // x="1410" ste
- 112,  61,  34,  49,  53,  34,  32, 118,  97, 108, 117, 101, // p="15" value
-  61,  34,  48,  34,  32, 100, 105, 115,  97,  98, 108, 101, // ="0" disable
- 100,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // d>..        
-  32,  32,  60,  47, 112,  62,  13,  10,  32,  32,  32,  32, //   </p>..    
-  32,  32,  32,  32,  60,  47, 100, 105, 118,  62,  13,  10, //     </div>..
-  32,  32,  32,  32,  32,  32,  32,  32,  60, 100, 105, 118, //         <div
-  32,  99, 108,  97, 115, 115,  61,  34,  99,  97, 114, 100, //  class="card
-  34,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // ">..        
-  32,  32,  60, 104,  50,  62,  13,  10,  32,  32,  32,  32, //   <h2>..    
-  32,  32,  32,  32,  32,  32,  32,  32,  84, 105, 109, 101, //         Time
- 114,  32,  52,  32,  60,  98, 117, 116, 116, 111, 110,  32, // r 4 <button 
- 105, 100,  61,  34,  98, 116, 110,  84,  52,  34,  32,  99, // id="btnT4" c
- 108,  97, 115, 115,  61,  34, 115, 109,  97, 108, 108,  98, // lass="smallb
- 116, 110,  34,  32, 111, 110,  99, 108, 105,  99, 107,  61, // tn" onclick=
-  34, 101, 100, 105, 116,  84, 105, 109, 101, 114,  40,  52, // "editTimer(4
-  41,  34,  62,  38,  35, 120,  49,  70,  52,  68,  68,  59, // )">&#x1F4DD;
-  60,  47,  98, 117, 116, 116, 111, 110,  62,  13,  10,  32, // </button>.. 
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, //            <
-  98, 117, 116, 116, 111, 110,  32, 105, 100,  61,  34,  98, // button id="b
- 116, 110,  67,  52,  34,  32,  99, 108,  97, 115, 115,  61, // tnC4" class=
-  34,  99,  97, 110,  99, 101, 108,  34,  32, 111, 110,  99, // "cancel" onc
- 108, 105,  99, 107,  61,  34,  99,  97, 110,  99, 101, 108, // lick="cancel
-  84, 105, 109, 101, 114,  40,  52,  41,  34,  62,  38,  35, // Timer(4)">&#
- 120,  50,  55,  70,  50,  59,  60,  47,  98, 117, 116, 116, // x27F2;</butt
- 111, 110,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // on>..       
-  32,  32,  32,  60,  47, 104,  50,  62,  13,  10,  32,  32, //    </h2>..  
-  32,  32,  32,  32,  32,  32,  32,  32,  60, 112,  62,  13, //         <p>.
-  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // .           
-  32,  60, 116,  97,  98, 108, 101,  62,  13,  10,  32,  32, //  <table>..  
+  32,  60,  47, 116, 100,  62,  13,  10,  32,  32,  32,  32, //  </td>..    
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  60, 116, 114,  62,  13,  10,  32,  32,  32,  32,  32,  32, // <tr>..      
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 116, //           <t
- 100,  32,  99, 108,  97, 115, 115,  61,  34, 116, 100,  97, // d class="tda
- 121,  34,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // y">..       
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, //            <
- 108,  97,  98, 101, 108,  62,  77,  60,  98, 114,  62,  60, // label>M<br><
- 105, 110, 112, 117, 116,  32, 105, 100,  61,  34, 116,  52, // input id="t4
-  68,  97, 121,  49,  34,  32, 116, 121, 112, 101,  61,  34, // Day1" type="
-  99, 104, 101,  99, 107,  98, 111, 120,  34,  32, 118,  97, // checkbox" va
- 108, 117, 101,  61,  34,  48,  34,  32, 100, 105, 115,  97, // lue="0" disa
-  98, 108, 101, 100,  62,  60,  47, 108,  97,  98, 101, 108, // bled></label
+  60, 116, 100,  32,  99, 108,  97, 115, 115,  61,  34, 116, // <td class="t
+ 100,  97, 121,  34,  62,  13,  10,  32,  32,  32,  32,  32, // day">..     
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
+  32,  60, 108,  97,  98, 101, 108,  62,  84,  60,  98, 114, //  <label>T<br
+  62,  60, 105, 110, 112, 117, 116,  32, 105, 100,  61,  34, // ><input id="
+ 116,  52,  68,  97, 121,  50,  34,  32, 116, 121, 112, 101, // t4Day2" type
+  61,  34,  99, 104, 101,  99, 107,  98, 111, 120,  34,  32, // ="checkbox" 
+ 118,  97, 108, 117, 101,  61,  34,  48,  34,  32, 100, 105, // value="0" di
+ 115,  97,  98, 108, 101, 100,  62,  60,  47, 108,  97,  98, // sabled></lab
+ 101, 108,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // el>..       
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, 116, //          </t
+ 100,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // d>..        
+  32,  32,  32,  32,  32,  32,  32,  32,  60, 116, 100,  32, //         <td 
+  99, 108,  97, 115, 115,  61,  34, 116, 100,  97, 121,  34, // class="tday"
   62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32, // >..         
-  32,  32,  32,  32,  32,  32,  32,  60,  47, 116, 100,  62, //        </td>
-  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
-  32,  32,  32,  32,  32,  32,  60, 116, 100,  32,  99, 108, //       <td cl
-  97, 115, 115,  61,  34, 116, 100,  97, 121,  34,  62,  13, // ass="tday">.
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 108,  97, //          <la
+  98, 101, 108,  62,  87,  60,  98, 114,  62,  60, 105, 110, // bel>W<br><in
+ 112, 117, 116,  32, 105, 100,  61,  34, 116,  52,  68,  97, // put id="t4Da
+ 121,  51,  34,  32, 116, 121, 112, 101,  61,  34,  99, 104, // y3" type="ch
+ 101,  99, 107,  98, 111, 120,  34,  32, 118,  97, 108, 117, // eckbox" valu
+ 101,  61,  34,  48,  34,  32, 100, 105, 115,  97,  98, 108, // e="0" disabl
+ 101, 100,  62,  60,  47, 108,  97,  98, 101, 108,  62,  13, // ed></label>.
   10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // .           
-  32,  32,  32,  32,  32,  32,  32,  60, 108,  97,  98, 101, //        <labe
- 108,  62,  84,  60,  98, 114,  62,  60, 105, 110, 112, 117, // l>T<br><inpu
- 116,  32, 105, 100,  61,  34, 116,  52,  68,  97, 121,  50, // t id="t4Day2
-  34,  32, 116, 121, 112, 101,  61,  34,  99, 104, 101,  99, // " type="chec
- 107,  98, 111, 120,  34,  32, 118,  97, 108, 117, 101,  61, // kbox" value=
-  34,  48,  34,  32, 100, 105, 115,  97,  98, 108, 101, 100, // "0" disabled
-  62,  60,  47, 108,  97,  98, 101, 108,  62,  13,  10,  32, // ></label>.. 
+  32,  32,  32,  32,  32,  60,  47, 116, 100,  62,  13,  10, //      </td>..
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  32,  32,  60,  47, 116, 100,  62,  13,  10,  32,  32, //    </td>..  
+  32,  32,  32,  32,  60, 116, 100,  32,  99, 108,  97, 115, //     <td clas
+ 115,  61,  34, 116, 100,  97, 121,  34,  62,  13,  10,  32, // s="tday">.. 
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  32,  60, 116, 100,  32,  99, 108,  97, 115, 115,  61, //   <td class=
-  34, 116, 100,  97, 121,  34,  62,  13,  10,  32,  32,  32, // "tday">..   
+  32,  32,  32,  32,  32,  60, 108,  97,  98, 101, 108,  62, //      <label>
+  84,  60,  98, 114,  62,  60, 105, 110, 112, 117, 116,  32, // T<br><input 
+ 105, 100,  61,  34, 116,  52,  68,  97, 121,  52,  34,  32, // id="t4Day4" 
+ 116, 121, 112, 101,  61,  34,  99, 104, 101,  99, 107,  98, // type="checkb
+ 111, 120,  34,  32, 118,  97, 108, 117, 101,  61,  34,  48, // ox" value="0
+  34,  32, 100, 105, 115,  97,  98, 108, 101, 100,  62,  60, // " disabled><
+  47, 108,  97,  98, 101, 108,  62,  13,  10,  32,  32,  32, // /label>..   
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  32,  32,  60, 108,  97,  98, 101, 108,  62,  87,  60, //    <label>W<
-  98, 114,  62,  60, 105, 110, 112, 117, 116,  32, 105, 100, // br><input id
-  61,  34, 116,  52,  68,  97, 121,  51,  34,  32, 116, 121, // ="t4Day3" ty
- 112, 101,  61,  34,  99, 104, 101,  99, 107,  98, 111, 120, // pe="checkbox
-  34,  32, 118,  97, 108, 117, 101,  61,  34,  48,  34,  32, // " value="0" 
- 100, 105, 115,  97,  98, 108, 101, 100,  62,  60,  47, 108, // disabled></l
-  97,  98, 101, 108,  62,  13,  10,  32,  32,  32,  32,  32, // abel>..     
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, //            <
-  47, 116, 100,  62,  13,  10,  32,  32,  32,  32,  32,  32, // /td>..      
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 116, //           <t
- 100,  32,  99, 108,  97, 115, 115,  61,  34, 116, 100,  97, // d class="tda
- 121,  34,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // y">..       
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, //            <
- 108,  97,  98, 101, 108,  62,  84,  60,  98, 114,  62,  60, // label>T<br><
- 105, 110, 112, 117, 116,  32, 105, 100,  61,  34, 116,  52, // input id="t4
-  68,  97, 121,  52,  34,  32, 116, 121, 112, 101,  61,  34, // Day4" type="
-  99, 104, 101,  99, 107,  98, 111, 120,  34,  32, 118,  97, // checkbox" va
- 108, 117, 101,  61,  34,  48,  34,  32, 100, 105, 115,  97, // lue="0" disa
-  98, 108, 101, 100,  62,  60,  47, 108,  97,  98, 101, 108, // bled></label
+  32,  60,  47, 116, 100,  62,  13,  10,  32,  32,  32,  32, //  </td>..    
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
+  60, 116, 100,  32,  99, 108,  97, 115, 115,  61,  34, 116, // <td class="t
+ 100,  97, 121,  34,  62,  13,  10,  32,  32,  32,  32,  32, // day">..     
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
+  32,  60, 108,  97,  98, 101, 108,  62,  70,  60,  98, 114, //  <label>F<br
+  62,  60, 105, 110, 112, 117, 116,  32, 105, 100,  61,  34, // ><input id="
+ 116,  52,  68,  97, 121,  53,  34,  32, 116, 121, 112, 101, // t4Day5" type
+  61,  34,  99, 104, 101,  99, 107,  98, 111, 120,  34,  32, // ="checkbox" 
+ 118,  97, 108, 117, 101,  61,  34,  48,  34,  32, 100, 105, // value="0" di
+ 115,  97,  98, 108, 101, 100,  62,  60,  47, 108,  97,  98, // sabled></lab
+ 101, 108,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // el>..       
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, 116, //          </t
+ 100,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // d>..        
+  32,  32,  32,  32,  32,  32,  32,  32,  60, 116, 100,  32, //         <td 
+  99, 108,  97, 115, 115,  61,  34, 116, 100,  97, 121,  34, // class="tday"
   62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32, // >..         
-  32,  32,  32,  32,  32,  32,  32,  60,  47, 116, 100,  62, //        </td>
-  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
-  32,  32,  32,  32,  32,  32,  60, 116, 100,  32,  99, 108, //       <td cl
-  97, 115, 115,  61,  34, 116, 100,  97, 121,  34,  62,  13, // ass="tday">.
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 108,  97, //          <la
+  98, 101, 108,  62,  83,  60,  98, 114,  62,  60, 105, 110, // bel>S<br><in
+ 112, 117, 116,  32, 105, 100,  61,  34, 116,  52,  68,  97, // put id="t4Da
+ 121,  54,  34,  32, 116, 121, 112, 101,  61,  34,  99, 104, // y6" type="ch
+ 101,  99, 107,  98, 111, 120,  34,  32, 118,  97, 108, 117, // eckbox" valu
+ 101,  61,  34,  48,  34,  32, 100, 105, 115,  97,  98, 108, // e="0" disabl
+ 101, 100,  62,  60,  47, 108,  97,  98, 101, 108,  62,  13, // ed></label>.
   10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // .           
-  32,  32,  32,  32,  32,  32,  32,  60, 108,  97,  98, 101, //        <labe
- 108,  62,  70,  60,  98, 114,  62,  60, 105, 110, 112, 117, // l>F<br><inpu
- 116,  32, 105, 100,  61,  34, 116,  52,  68,  97, 121,  53, // t id="t4Day5
-  34,  32, 116, 121, 112, 101,  61,  34,  99, 104, 101,  99, // " type="chec
- 107,  98, 111, 120,  34,  32, 118,  97, 108, 117, 101,  61, // kbox" value=
-  34,  48,  34,  32, 100, 105, 115,  97,  98, 108, 101, 100, // "0" disabled
-  62,  60,  47, 108,  97,  98, 101, 108,  62,  13,  10,  32, // ></label>.. 
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  32,  32,  60,  47, 116, 100,  62,  13,  10,  32,  32, //    </td>..  
+  32,  32,  32,  32,  32,  60,  47, 116, 100,  62,  13,  10, //      </td>..
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  32,  60, 116, 100,  32,  99, 108,  97, 115, 115,  61, //   <td class=
-  34, 116, 100,  97, 121,  34,  62,  13,  10,  32,  32,  32, // "tday">..   
+  32,  32,  32,  32,  60, 116, 100,  32,  99, 108,  97, 115, //     <td clas
+ 115,  61,  34, 116, 100,  97, 121,  34,  62,  13,  10,  32, // s="tday">.. 
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  32,  32,  60, 108,  97,  98, 101, 108,  62,  83,  60, //    <label>S<
-  98, 114,  62,  60, 105, 110, 112, 117, 116,  32, 105, 100, // br><input id
-  61,  34, 116,  52,  68,  97, 121,  54,  34,  32, 116, 121, // ="t4Day6" ty
- 112, 101,  61,  34,  99, 104, 101,  99, 107,  98, 111, 120, // pe="checkbox
-  34,  32, 118,  97, 108, 117, 101,  61,  34,  48,  34,  32, // " value="0" 
- 100, 105, 115,  97,  98, 108, 101, 100,  62,  60,  47, 108, // disabled></l
-  97,  98, 101, 108,  62,  13,  10,  32,  32,  32,  32,  32, // abel>..     
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, //            <
-  47, 116, 100,  62,  13,  10,  32,  32,  32,  32,  32,  32, // /td>..      
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 116, //           <t
- 100,  32,  99, 108,  97, 115, 115,  61,  34, 116, 100,  97, // d class="tda
- 121,  34,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // y">..       
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, //            <
- 108,  97,  98, 101, 108,  62,  83,  60,  98, 114,  62,  60, // label>S<br><
- 105, 110, 112, 117, 116,  32, 105, 100,  61,  34, 116,  52, // input id="t4
-  68,  97, 121,  55,  34,  32, 116, 121, 112, 101,  61,  34, // Day7" type="
-  99, 104, 101,  99, 107,  98, 111, 120,  34,  32, 118,  97, // checkbox" va
- 108, 117, 101,  61,  34,  48,  34,  32, 100, 105, 115,  97, // lue="0" disa
-  98, 108, 101, 100,  62,  60,  47, 108,  97,  98, 101, 108, // bled></label
-  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32, // >..         
-  32,  32,  32,  32,  32,  32,  32,  60,  47, 116, 100,  62, //        </td>
-  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
-  32,  32,  32,  32,  60,  47, 116, 114,  62,  13,  10,  32, //     </tr>.. 
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, //            <
-  47, 116,  97,  98, 108, 101,  62,  13,  10,  32,  32,  32, // /table>..   
-  32,  32,  32,  32,  32,  32,  32,  60,  47, 112,  62,  13, //        </p>.
-  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, // .          <
- 112,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // p>..        
-  32,  32,  32,  32,  79,  78,  58,  32,  60, 115, 112,  97, //     ON: <spa
- 110,  32, 105, 100,  61,  34, 116,  52,  79, 110,  34,  62, // n id="t4On">
-  49,  50,  58,  48,  48,  32,  65,  77,  60,  47, 115, 112, // 12:00 AM</sp
-  97, 110,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // an>..       
-  32,  32,  32,  32,  32,  60,  98, 114,  62,  13,  10,  32, //      <br>.. 
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, //            <
- 105, 110, 112, 117, 116,  32, 105, 100,  61,  34, 116,  52, // input id="t4
-  79, 110,  73, 110, 112, 117, 116,  34,  32, 111, 110, 105, // OnInput" oni
- 110, 112, 117, 116,  61,  34, 109, 111, 118, 101,  84, 105, // nput="moveTi
- 109, 101,  40,  52,  44,  32,  39,  79, 110,  39,  41,  34, // me(4, 'On')"
-  32, 116, 121, 112, 101,  61,  34, 114,  97, 110, 103, 101, //  type="range
-  34,  32, 109, 105, 110,  61,  34,  48,  34,  32, 109,  97, // " min="0" ma
- 120,  61,  34,  49,  52,  49,  48,  34,  32, 115, 116, 101, // x="1410" ste
- 112,  61,  34,  49,  53,  34,  32, 118,  97, 108, 117, 101, // p="15" value
-  61,  34,  48,  34,  32, 100, 105, 115,  97,  98, 108, 101, // ="0" disable
- 100,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // d>..        
-  32,  32,  60,  47, 112,  62,  13,  10,  32,  32,  32,  32, //   </p>..    
-  32,  32,  32,  32,  32,  32,  60, 112,  62,  13,  10,  32, //       <p>.. 
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  79, //            O
-  70,  70,  58,  32,  60, 115, 112,  97, 110,  32, 105, 100, // FF: <span id
-  61,  34, 116,  52,  79, 102, 102,  34,  62,  49,  50,  58, // ="t4Off">12:
-  48,  48,  32,  65,  77,  60,  47, 115, 112,  97, 110,  62, // 00 AM</span>
-  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
-  32,  32,  60,  98, 114,  62,  13,  10,  32,  32,  32,  32, //   <br>..    
-  32,  32,  32,  32,  32,  32,  32,  32,  60, 105, 110, 112, //         <inp
- 117, 116,  32, 105, 100,  61,  34, 116,  52,  79, 102, 102, // ut id="t4Off
-  73, 110, 112, 117, 116,  34,  32, 111, 110, 105, 110, 112, // Input" oninp
- 117, 116,  61,  34, 109, 111, 118, 101,  84, 105, 109, 101, // ut="moveTime
-  40,  52,  44,  32,  39,  79, 102, 102,  39,  41,  34,  32, // (4, 'Off')" 
- 116, 121, 112, 101,  61,  34, 114,  97, 110, 103, 101,  34, // type="range"
-  32, 109, 105, 110,  61,  34,  48,  34,  32, 109,  97, 120, //  min="0" max
-  61,  34,  49,  52,  49,  48,  34,  32, 115, 116, 101, 112, // ="1410" step
-  61,  34,  49,  53,  34,  32, 118,  97, 108, 117, 101,  61, // ="15" value=
-  34,  48,  34,  32, 100, 105, 115,  97,  98, 108, 101, 100, // "0" disabled
+  32,  32,  32,  32,  32,  60, 108,  97,  98, 101, 108,  62, //      <label>
+  83,  60,  98, 114,  62,  60, 105, 110, 112, 117, 116,  32, // S<br><input 
+ 105, 100,  61,  34, 116,  52,  68,  97, 121,  55,  34,  32, // id="t4Day7" 
+ 116, 121, 112, 101,  61,  34,  99, 104, 101,  99, 107,  98, // type="checkb
+ 111, 120,  34,  32, 118,  97, 108, 117, 101,  61,  34,  48, // ox" value="0
+  34,  32, 100, 105, 115,  97,  98, 108, 101, 100,  62,  60, // " disabled><
+  47, 108,  97,  98, 101, 108,  62,  13,  10,  32,  32,  32, // /label>..   
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
+  32,  60,  47, 116, 100,  62,  13,  10,  32,  32,  32,  32, //  </td>..    
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, //           </
+ 116, 114,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // tr>..       
+  32,  32,  32,  32,  32,  60,  47, 116,  97,  98, 108, 101, //      </table
   62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32, // >..         
   32,  60,  47, 112,  62,  13,  10,  32,  32,  32,  32,  32, //  </p>..     
-  32,  32,  32,  60,  47, 100, 105, 118,  62,  13,  10,  32, //    </div>.. 
-  32,  32,  32,  32,  32,  32,  32,  60, 100, 105, 118,  32, //        <div 
-  99, 108,  97, 115, 115,  61,  34,  99,  97, 114, 100,  34, // class="card"
-  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32, // >..         
-  32,  60, 104,  50,  62,  13,  10,  32,  32,  32,  32,  32, //  <h2>..     
-  32,  32,  32,  32,  32,  32,  32,  84, 105, 109, 101, 114, //        Timer
-  32,  53,  32,  60,  98, 117, 116, 116, 111, 110,  32, 105, //  5 <button i
- 100,  61,  34,  98, 116, 110,  84,  53,  34,  32,  99, 108, // d="btnT5" cl
-  97, 115, 115,  61,  34, 115, 109,  97, 108, 108,  98, 116, // ass="smallbt
- 110,  34,  32, 111, 110,  99, 108, 105,  99, 107,  61,  34, // n" onclick="
- 101, 100, 105, 116,  84, 105, 109, 101, 114,  40,  53,  41, // editTimer(5)
-  34,  62,  38,  35, 120,  49,  70,  52,  68,  68,  59,  60, // ">&#x1F4DD;<
+  32,  32,  32,  32,  32,  60, 112,  62,  13,  10,  32,  32, //      <p>..  
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  79,  78, //           ON
+  58,  32,  60, 115, 112,  97, 110,  32, 105, 100,  61,  34, // : <span id="
+ 116,  52,  79, 110,  34,  62,  49,  50,  58,  48,  48,  32, // t4On">12:00 
+  65,  77,  60,  47, 115, 112,  97, 110,  62,  13,  10,  32, // AM</span>.. 
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, //            <
+  98, 114,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // br>..       
+  32,  32,  32,  32,  32,  60, 105, 110, 112, 117, 116,  32, //      <input 
+ 105, 100,  61,  34, 116,  52,  79, 110,  73, 110, 112, 117, // id="t4OnInpu
+ 116,  34,  32, 111, 110, 105, 110, 112, 117, 116,  61,  34, // t" oninput="
+ 109, 111, 118, 101,  84, 105, 109, 101,  40,  52,  44,  32, // moveTime(4, 
+  39,  79, 110,  39,  41,  34,  32, 116, 121, 112, 101,  61, // 'On')" type=
+  34, 114,  97, 110, 103, 101,  34,  32, 109, 105, 110,  61, // "range" min=
+  34,  48,  34,  32, 109,  97, 120,  61,  34,  49,  52,  49, // "0" max="141
+  48,  34,  32, 115, 116, 101, 112,  61,  34,  49,  53,  34, // 0" step="15"
+  32, 118,  97, 108, 117, 101,  61,  34,  48,  34,  32, 100, //  value="0" d
+ 105, 115,  97,  98, 108, 101, 100,  62,  13,  10,  32,  32, // isabled>..  
+  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, 112,  62, //         </p>
+  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
+  60, 112,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // <p>..       
+  32,  32,  32,  32,  32,  79,  70,  70,  58,  32,  60, 115, //      OFF: <s
+ 112,  97, 110,  32, 105, 100,  61,  34, 116,  52,  79, 102, // pan id="t4Of
+ 102,  34,  62,  49,  50,  58,  48,  48,  32,  65,  77,  60, // f">12:00 AM<
+  47, 115, 112,  97, 110,  62,  13,  10,  32,  32,  32,  32, // /span>..    
+  32,  32,  32,  32,  32,  32,  32,  32,  60,  98, 114,  62, //         <br>
+  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
+  32,  32,  60, 105, 110, 112, 117, 116,  32, 105, 100,  61, //   <input id=
+  34, 116,  52,  79, 102, 102,  73, 110, 112, 117, 116,  34, // "t4OffInput"
+  32, 111, 110, 105, 110, 112, 117, 116,  61,  34, 109, 111, //  oninput="mo
+ 118, 101,  84, 105, 109, 101,  40,  52,  44,  32,  39,  79, // veTime(4, 'O
+ 102, 102,  39,  41,  34,  32, 116, 121, 112, 101,  61,  34, // ff')" type="
+ 114,  97, 110, 103, 101,  34,  32, 109, 105, 110,  61,  34, // range" min="
+  48,  34,  32, 109,  97, 120,  61,  34,  49,  52,  49,  48, // 0" max="1410
+  34,  32, 115, 116, 101, 112,  61,  34,  49,  53,  34,  32, // " step="15" 
+ 118,  97, 108, 117, 101,  61,  34,  48,  34,  32, 100, 105, // value="0" di
+ 115,  97,  98, 108, 101, 100,  62,  13,  10,  32,  32,  32, // sabled>..   
+  32,  32,  32,  32,  32,  32,  32,  60,  47, 112,  62,  13, //        </p>.
+  10,  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, 100, // .        </d
+ 105, 118,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // iv>..       
+  32,  60, 100, 105, 118,  32,  99, 108,  97, 115, 115,  61, //  <div class=
+  34,  99,  97, 114, 100,  34,  62,  13,  10,  32,  32,  32, // "card">..   
+  32,  32,  32,  32,  32,  32,  32,  60, 104,  50,  62,  13, //        <h2>.
+  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // .           
+  32,  84, 105, 109, 101, 114,  32,  53,  32,  60,  98, 117, //  Timer 5 <bu
+ 116, 116, 111, 110,  32, 105, 100,  61,  34,  98, 116, 110, // tton id="btn
+  84,  53,  34,  32,  99, 108,  97, 115, 115,  61,  34, 115, // T5" class="s
+ 109,  97, 108, 108,  98, 116, 110,  34,  32, 111, 110,  99, // mallbtn" onc
+ 108, 105,  99, 107,  61,  34, 101, 100, 105, 116,  84, 105, // lick="editTi
+ 109, 101, 114,  40,  53,  41,  34,  62,  38,  35, 120,  49, // mer(5)">&#x1
+  70,  52,  68,  68,  59,  60,  47,  98, 117, 116, 116, 111, // F4DD;</butto
+ 110,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // n>..        
+  32,  32,  32,  32,  60,  98, 117, 116, 116, 111, 110,  32, //     <button 
+ 105, 100,  61,  34,  98, 116, 110,  67,  53,  34,  32,  99, // id="btnC5" c
+ 108,  97, 115, 115,  61,  34,  99,  97, 110,  99, 101, 108, // lass="cancel
+  34,  32, 111, 110,  99, 108, 105,  99, 107,  61,  34,  99, // " onclick="c
+  97, 110,  99, 101, 108,  84, 105, 109, 101, 114,  40,  53, // ancelTimer(5
+  41,  34,  62,  38,  35, 120,  50,  55,  70,  50,  59,  60, // )">&#x27F2;<
   47,  98, 117, 116, 116, 111, 110,  62,  13,  10,  32,  32, // /button>..  
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  98, //           <b
  117, 116, 116, 111, 110,  32, 105, 100,  61,  34,  98, 116, // utton id="bt
- 110,  67,  53,  34,  32,  99, 108,  97, 115, 115,  61,  34, // nC5" class="
-  99,  97, 110,  99, 101, 108,  34,  32, 111, 110,  99, 108, // cancel" oncl
- 105,  99, 107,  61,  34,  99,  97, 110,  99, 101, 108,  84, // ick="cancelT
- 105, 109, 101, 114,  40,  53,  41,  34,  62,  38,  35, 120, // imer(5)">&#x
-  50,  55,  70,  50,  59,  60,  47,  98, 117, 116, 116, 111, // 27F2;</butto
- 110,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // n>..        
-  32,  32,  60,  47, 104,  50,  62,  13,  10,  32,  32,  32, //   </h2>..   
-  32,  32,  32,  32,  32,  32,  32,  60, 112,  62,  13,  10, //        <p>..
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  60, 116,  97,  98, 108, 101,  62,  13,  10,  32,  32,  32, // <table>..   
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, //            <
- 116, 114,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // tr>..       
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 116, 100, //          <td
-  32,  99, 108,  97, 115, 115,  61,  34, 116, 100,  97, 121, //  class="tday
-  34,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // ">..        
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 108, //           <l
-  97,  98, 101, 108,  62,  77,  60,  98, 114,  62,  60, 105, // abel>M<br><i
- 110, 112, 117, 116,  32, 105, 100,  61,  34, 116,  53,  68, // nput id="t5D
-  97, 121,  49,  34,  32, 116, 121, 112, 101,  61,  34,  99, // ay1" type="c
- 104, 101,  99, 107,  98, 111, 120,  34,  32, 118,  97, 108, // heckbox" val
- 117, 101,  61,  34,  48,  34,  32, 100, 105, 115,  97,  98, // ue="0" disab
- 108, 101, 100,  62,  60,  47, 108,  97,  98, 101, 108,  62, // led></label>
-  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
-  32,  32,  32,  32,  32,  32,  60,  47, 116, 100,  62,  13, //       </td>.
+ 110,  65,  53,  34,  32,  99, 108,  97, 115, 115,  61,  34, // nA5" class="
+  99, 111, 112, 121,  98, 116, 110,  34,  32, 111, 110,  99, // copybtn" onc
+ 108, 105,  99, 107,  61,  34,  99, 111, 112, 121,  84, 105, // lick="copyTi
+ 109, 101, 114,  84, 111,  65, 108, 108,  40,  53,  41,  34, // merToAll(5)"
+  32, 116, 105, 116, 108, 101,  61,  34,  67, 111, 112, 121, //  title="Copy
+  32, 116, 111,  32,  97, 108, 108,  32, 116, 105, 109, 101, //  to all time
+ 114, 115,  34,  62,  38,  35, 120,  49,  70,  52,  67,  66, // rs">&#x1F4CB
+  59,  60,  47,  98, 117, 116, 116, 111, 110,  62,  13,  10, // ;</button>..
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, //           </
+ 104,  50,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // h2>..       
+  32,  32,  32,  60, 112,  62,  13,  10,  32,  32,  32,  32, //    <p>..    
+  32,  32,  32,  32,  32,  32,  32,  32,  60, 116,  97,  98, //         <tab
+ 108, 101,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // le>..       
+  32,  32,  32,  32,  32,  32,  32,  60, 116, 114,  62,  13, //        <tr>.
   10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // .           
   32,  32,  32,  32,  32,  60, 116, 100,  32,  99, 108,  97, //      <td cla
  115, 115,  61,  34, 116, 100,  97, 121,  34,  62,  13,  10, // ss="tday">..
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
   32,  32,  32,  32,  32,  32,  60, 108,  97,  98, 101, 108, //       <label
-  62,  84,  60,  98, 114,  62,  60, 105, 110, 112, 117, 116, // >T<br><input
-  32, 105, 100,  61,  34, 116,  53,  68,  97, 121,  50,  34, //  id="t5Day2"
+  62,  77,  60,  98, 114,  62,  60, 105, 110, 112, 117, 116, // >M<br><input
+  32, 105, 100,  61,  34, 116,  53,  68,  97, 121,  49,  34, //  id="t5Day1"
   32, 116, 121, 112, 101,  61,  34,  99, 104, 101,  99, 107, //  type="check
   98, 111, 120,  34,  32, 118,  97, 108, 117, 101,  61,  34, // box" value="
   48,  34,  32, 100, 105, 115,  97,  98, 108, 101, 100,  62, // 0" disabled>
@@ -1942,9 +2110,9 @@ static const unsigned char v2[] = {
   32,  60, 116, 100,  32,  99, 108,  97, 115, 115,  61,  34, //  <td class="
  116, 100,  97, 121,  34,  62,  13,  10,  32,  32,  32,  32, // tday">..    
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  32,  60, 108,  97,  98, 101, 108,  62,  87,  60,  98, //   <label>W<b
+  32,  32,  60, 108,  97,  98, 101, 108,  62,  84,  60,  98, //   <label>T<b
  114,  62,  60, 105, 110, 112, 117, 116,  32, 105, 100,  61, // r><input id=
-  34, 116,  53,  68,  97, 121,  51,  34,  32, 116, 121, 112, // "t5Day3" typ
+  34, 116,  53,  68,  97, 121,  50,  34,  32, 116, 121, 112, // "t5Day2" typ
  101,  61,  34,  99, 104, 101,  99, 107,  98, 111, 120,  34, // e="checkbox"
   32, 118,  97, 108, 117, 101,  61,  34,  48,  34,  32, 100, //  value="0" d
  105, 115,  97,  98, 108, 101, 100,  62,  60,  47, 108,  97, // isabled></la
@@ -1955,9 +2123,9 @@ static const unsigned char v2[] = {
   32,  99, 108,  97, 115, 115,  61,  34, 116, 100,  97, 121, //  class="tday
   34,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // ">..        
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 108, //           <l
-  97,  98, 101, 108,  62,  84,  60,  98, 114,  62,  60, 105, // abel>T<br><i
+  97,  98, 101, 108,  62,  87,  60,  98, 114,  62,  60, 105, // abel>W<br><i
  110, 112, 117, 116,  32, 105, 100,  61,  34, 116,  53,  68, // nput id="t5D
-  97, 121,  52,  34,  32, 116, 121, 112, 101,  61,  34,  99, // ay4" type="c
+  97, 121,  51,  34,  32, 116, 121, 112, 101,  61,  34,  99, // ay3" type="c
  104, 101,  99, 107,  98, 111, 120,  34,  32, 118,  97, 108, // heckbox" val
  117, 101,  61,  34,  48,  34,  32, 100, 105, 115,  97,  98, // ue="0" disab
  108, 101, 100,  62,  60,  47, 108,  97,  98, 101, 108,  62, // led></label>
@@ -1968,8 +2136,8 @@ static const unsigned char v2[] = {
  115, 115,  61,  34, 116, 100,  97, 121,  34,  62,  13,  10, // ss="tday">..
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
   32,  32,  32,  32,  32,  32,  60, 108,  97,  98, 101, 108, //       <label
-  62,  70,  60,  98, 114,  62,  60, 105, 110, 112, 117, 116, // >F<br><input
-  32, 105, 100,  61,  34, 116,  53,  68,  97, 121,  53,  34, //  id="t5Day5"
+  62,  84,  60,  98, 114,  62,  60, 105, 110, 112, 117, 116, // >T<br><input
+  32, 105, 100,  61,  34, 116,  53,  68,  97, 121,  52,  34, //  id="t5Day4"
   32, 116, 121, 112, 101,  61,  34,  99, 104, 101,  99, 107, //  type="check
   98, 111, 120,  34,  32, 118,  97, 108, 117, 101,  61,  34, // box" value="
   48,  34,  32, 100, 105, 115,  97,  98, 108, 101, 100,  62, // 0" disabled>
@@ -1980,9 +2148,9 @@ static const unsigned char v2[] = {
   32,  60, 116, 100,  32,  99, 108,  97, 115, 115,  61,  34, //  <td class="
  116, 100,  97, 121,  34,  62,  13,  10,  32,  32,  32,  32, // tday">..    
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  32,  60, 108,  97,  98, 101, 108,  62,  83,  60,  98, //   <label>S<b
+  32,  32,  60, 108,  97,  98, 101, 108,  62,  70,  60,  98, //   <label>F<b
  114,  62,  60, 105, 110, 112, 117, 116,  32, 105, 100,  61, // r><input id=
-  34, 116,  53,  68,  97, 121,  54,  34,  32, 116, 121, 112, // "t5Day6" typ
+  34, 116,  53,  68,  97, 121,  53,  34,  32, 116, 121, 112, // "t5Day5" typ
  101,  61,  34,  99, 104, 101,  99, 107,  98, 111, 120,  34, // e="checkbox"
   32, 118,  97, 108, 117, 101,  61,  34,  48,  34,  32, 100, //  value="0" d
  105, 115,  97,  98, 108, 101, 100,  62,  60,  47, 108,  97, // isabled></la
@@ -1995,221 +2163,244 @@ static const unsigned char v2[] = {
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 108, //           <l
   97,  98, 101, 108,  62,  83,  60,  98, 114,  62,  60, 105, // abel>S<br><i
  110, 112, 117, 116,  32, 105, 100,  61,  34, 116,  53,  68, // nput id="t5D
-  97, 121,  55,  34,  32, 116, 121, 112, 101,  61,  34,  99, // ay7" type="c
+  97, 121,  54,  34,  32, 116, 121, 112, 101,  61,  34,  99, // ay6" type="c
  104, 101,  99, 107,  98, 111, 120,  34,  32, 118,  97, 108, // heckbox" val
  117, 101,  61,  34,  48,  34,  32, 100, 105, 115,  97,  98, // ue="0" disab
  108, 101, 100,  62,  60,  47, 108,  97,  98, 101, 108,  62, // led></label>
   13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
   32,  32,  32,  32,  32,  32,  60,  47, 116, 100,  62,  13, //       </td>.
   10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // .           
-  32,  32,  32,  60,  47, 116, 114,  62,  13,  10,  32,  32, //    </tr>..  
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, //           </
- 116,  97,  98, 108, 101,  62,  13,  10,  32,  32,  32,  32, // table>..    
-  32,  32,  32,  32,  32,  32,  60,  47, 112,  62,  13,  10, //       </p>..
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 112, //           <p
+  32,  32,  32,  32,  32,  60, 116, 100,  32,  99, 108,  97, //      <td cla
+ 115, 115,  61,  34, 116, 100,  97, 121,  34,  62,  13,  10, // ss="tday">..
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
+  32,  32,  32,  32,  32,  32,  60, 108,  97,  98, 101, 108, //       <label
+  62,  83,  60,  98, 114,  62,  60, 105, 110, 112, 117, 116, // >S<br><input
+  32, 105, 100,  61,  34, 116,  53,  68,  97, 121,  55,  34, //  id="t5Day7"
+  32, 116, 121, 112, 101,  61,  34,  99, 104, 101,  99, 107, //  type="check
+  98, 111, 120,  34,  32, 118,  97, 108, 117, 101,  61,  34, // box" value="
+  48,  34,  32, 100, 105, 115,  97,  98, 108, 101, 100,  62, // 0" disabled>
+  60,  47, 108,  97,  98, 101, 108,  62,  13,  10,  32,  32, // </label>..  
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
+  32,  32,  60,  47, 116, 100,  62,  13,  10,  32,  32,  32, //   </td>..   
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, //            <
+  47, 116, 114,  62,  13,  10,  32,  32,  32,  32,  32,  32, // /tr>..      
+  32,  32,  32,  32,  32,  32,  60,  47, 116,  97,  98, 108, //       </tabl
+ 101,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // e>..        
+  32,  32,  60,  47, 112,  62,  13,  10,  32,  32,  32,  32, //   </p>..    
+  32,  32,  32,  32,  32,  32,  60, 112,  62,  13,  10,  32, //       <p>.. 
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  79, //            O
+  78,  58,  32,  60, 115, 112,  97, 110,  32, 105, 100,  61, // N: <span id=
+  34, 116,  53,  79, 110,  34,  62,  49,  50,  58,  48,  48, // "t5On">12:00
+  32,  65,  77,  60,  47, 115, 112,  97, 110,  62,  13,  10, //  AM</span>..
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
+  60,  98, 114,  62,  13,  10,  32,  32,  32,  32,  32,  32, // <br>..      
+  32,  32,  32,  32,  32,  32,  60, 105, 110, 112, 117, 116, //       <input
+  32, 105, 100,  61,  34, 116,  53,  79, 110,  73, 110, 112, //  id="t5OnInp
+ 117, 116,  34,  32, 111, 110, 105, 110, 112, 117, 116,  61, // ut" oninput=
+  34, 109, 111, 118, 101,  84, 105, 109, 101,  40,  53,  44, // "moveTime(5,
+  32,  39,  79, 110,  39,  41,  34,  32, 116, 121, 112, 101, //  'On')" type
+  61,  34, 114,  97, 110, 103, 101,  34,  32, 109, 105, 110, // ="range" min
+  61,  34,  48,  34,  32, 109,  97, 120,  61,  34,  49,  52, // ="0" max="14
+  49,  48,  34,  32, 115, 116, 101, 112,  61,  34,  49,  53, // 10" step="15
+  34,  32, 118,  97, 108, 117, 101,  61,  34,  48,  34,  32, // " value="0" 
+ 100, 105, 115,  97,  98, 108, 101, 100,  62,  13,  10,  32, // disabled>.. 
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, 112, //          </p
   62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32, // >..         
-  32,  32,  32,  79,  78,  58,  32,  60, 115, 112,  97, 110, //    ON: <span
-  32, 105, 100,  61,  34, 116,  53,  79, 110,  34,  62,  49, //  id="t5On">1
-  50,  58,  48,  48,  32,  65,  77,  60,  47, 115, 112,  97, // 2:00 AM</spa
- 110,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // n>..        
-  32,  32,  32,  32,  60,  98, 114,  62,  13,  10,  32,  32, //     <br>..  
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 105, //           <i
- 110, 112, 117, 116,  32, 105, 100,  61,  34, 116,  53,  79, // nput id="t5O
- 110,  73, 110, 112, 117, 116,  34,  32, 111, 110, 105, 110, // nInput" onin
- 112, 117, 116,  61,  34, 109, 111, 118, 101,  84, 105, 109, // put="moveTim
- 101,  40,  53,  44,  32,  39,  79, 110,  39,  41,  34,  32, // e(5, 'On')" 
- 116, 121, 112, 101,  61,  34, 114,  97, 110, 103, 101,  34, // type="range"
-  32, 109, 105, 110,  61,  34,  48,  34,  32, 109,  97, 120, //  min="0" max
-  61,  34,  49,  52,  49,  48,  34,  32, 115, 116, 101, 112, // ="1410" step
-  61,  34,  49,  53,  34,  32, 118,  97, 108, 117, 101,  61, // ="15" value=
-  34,  48,  34,  32, 100, 105, 115,  97,  98, 108, 101, 100, // "0" disabled
+  32,  60, 112,  62,  13,  10,  32,  32,  32,  32,  32,  32, //  <p>..      
+  32,  32,  32,  32,  32,  32,  79,  70,  70,  58,  32,  60, //       OFF: <
+ 115, 112,  97, 110,  32, 105, 100,  61,  34, 116,  53,  79, // span id="t5O
+ 102, 102,  34,  62,  49,  50,  58,  48,  48,  32,  65,  77, // ff">12:00 AM
+  60,  47, 115, 112,  97, 110,  62,  13,  10,  32,  32,  32, // </span>..   
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  98, 114, //          <br
   62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32, // >..         
-  32,  60,  47, 112,  62,  13,  10,  32,  32,  32,  32,  32, //  </p>..     
-  32,  32,  32,  32,  32,  60, 112,  62,  13,  10,  32,  32, //      <p>..  
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  79,  70, //           OF
-  70,  58,  32,  60, 115, 112,  97, 110,  32, 105, 100,  61, // F: <span id=
-  34, 116,  53,  79, 102, 102,  34,  62,  49,  50,  58,  48, // "t5Off">12:0
-  48,  32,  65,  77,  60,  47, 115, 112,  97, 110,  62,  13, // 0 AM</span>.
-  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // .           
-  32,  60,  98, 114,  62,  13,  10,  32,  32,  32,  32,  32, //  <br>..     
-  32,  32,  32,  32,  32,  32,  32,  60, 105, 110, 112, 117, //        <inpu
- 116,  32, 105, 100,  61,  34, 116,  53,  79, 102, 102,  73, // t id="t5OffI
- 110, 112, 117, 116,  34,  32, 111, 110, 105, 110, 112, 117, // nput" oninpu
- 116,  61,  34, 109, 111, 118, 101,  84, 105, 109, 101,  40, // t="moveTime(
-  53,  44,  32,  39,  79, 102, 102,  39,  41,  34,  32, 116, // 5, 'Off')" t
- 121, 112, 101,  61,  34, 114,  97, 110, 103, 101,  34,  32, // ype="range" 
- 109, 105, 110,  61,  34,  48,  34,  32, 109,  97, 120,  61, // min="0" max=
-  34,  49,  52,  49,  48,  34,  32, 115, 116, 101, 112,  61, // "1410" step=
-  34,  49,  53,  34,  32, 118,  97, 108, 117, 101,  61,  34, // "15" value="
-  48,  34,  32, 100, 105, 115,  97,  98, 108, 101, 100,  62, // 0" disabled>
-  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
-  60,  47, 112,  62,  13,  10,  32,  32,  32,  32,  32,  32, // </p>..      
-  32,  32,  60,  47, 100, 105, 118,  62,  13,  10,  32,  32, //   </div>..  
-  32,  32,  32,  32,  32,  32,  60, 100, 105, 118,  32,  99, //       <div c
- 108,  97, 115, 115,  61,  34,  99,  97, 114, 100,  34,  62, // lass="card">
+  32,  32,  32,  60, 105, 110, 112, 117, 116,  32, 105, 100, //    <input id
+  61,  34, 116,  53,  79, 102, 102,  73, 110, 112, 117, 116, // ="t5OffInput
+  34,  32, 111, 110, 105, 110, 112, 117, 116,  61,  34, 109, // " oninput="m
+ 111, 118, 101,  84, 105, 109, 101,  40,  53,  44,  32,  39, // oveTime(5, '
+  79, 102, 102,  39,  41,  34,  32, 116, 121, 112, 101,  61, // Off')" type=
+  34, 114,  97, 110, 103, 101,  34,  32, 109, 105, 110,  61, // "range" min=
+  34,  48,  34,  32, 109,  97, 120,  61,  34,  49,  52,  49, // "0" max="141
+  48,  34,  32, 115, 116, 101, 112,  61,  34,  49,  53,  34, // 0" step="15"
+  32, 118,  97, 108, 117, 101,  61,  34,  48,  34,  32, 100, //  value="0" d
+ 105, 115,  97,  98, 108, 101, 100,  62,  13,  10,  32,  32, // isabled>..  
+  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, 112,  62, //         </p>
+  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, // ..        </
+ 100, 105, 118,  62,  13,  10,  32,  32,  32,  32,  32,  32, // div>..      
+  32,  32,  60, 100, 105, 118,  32,  99, 108,  97, 115, 115, //   <div class
+  61,  34,  99,  97, 114, 100,  34,  62,  13,  10,  32,  32, // ="card">..  
+  32,  32,  32,  32,  32,  32,  32,  32,  60, 104,  50,  62, //         <h2>
   13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
-  60, 104,  50,  62,  13,  10,  32,  32,  32,  32,  32,  32, // <h2>..      
-  32,  32,  32,  32,  32,  32,  84, 105, 109, 101, 114,  32, //       Timer 
-  54,  32,  60,  98, 117, 116, 116, 111, 110,  32, 105, 100, // 6 <button id
-  61,  34,  98, 116, 110,  84,  54,  34,  32,  99, 108,  97, // ="btnT6" cla
- 115, 115,  61,  34, 115, 109,  97, 108, 108,  98, 116, 110, // ss="smallbtn
-  34,  32, 111, 110,  99, 108, 105,  99, 107,  61,  34, 101, // " onclick="e
- 100, 105, 116,  84, 105, 109, 101, 114,  40,  54,  41,  34, // ditTimer(6)"
-  62,  38,  35, 120,  49,  70,  52,  68,  68,  59,  60,  47, // >&#x1F4DD;</
-  98, 117, 116, 116, 111, 110,  62,  13,  10,  32,  32,  32, // button>..   
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  98, 117, //          <bu
- 116, 116, 111, 110,  32, 105, 100,  61,  34,  98, 116, 110, // tton id="btn
-  67,  54,  34,  32,  99, 108,  97, 115, 115,  61,  34,  99, // C6" class="c
-  97, 110,  99, 101, 108,  34,  32, 111, 110,  99, 108, 105, // ancel" oncli
-  99, 107,  61,  34,  99,  97, 110,  99, 101, 108,  84, 105, // ck="cancelTi
- 109, 101, 114,  40,  54,  41,  34,  62,  38,  35, 120,  50, // mer(6)">&#x2
-  55,  70,  50,  59,  60,  47,  98, 117, 116, 116, 111, 110, // 7F2;</button
-  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32, // >..         
-  32,  60,  47, 104,  50,  62,  13,  10,  32,  32,  32,  32, //  </h2>..    
-  32,  32,  32,  32,  32,  32,  60, 112,  62,  13,  10,  32, //       <p>.. 
+  32,  32,  84, 105, 109, 101, 114,  32,  54,  32,  60,  98, //   Timer 6 <b
+ 117, 116, 116, 111, 110,  32, 105, 100,  61,  34,  98, 116, // utton id="bt
+ 110,  84,  54,  34,  32,  99, 108,  97, 115, 115,  61,  34, // nT6" class="
+ 115, 109,  97, 108, 108,  98, 116, 110,  34,  32, 111, 110, // smallbtn" on
+  99, 108, 105,  99, 107,  61,  34, 101, 100, 105, 116,  84, // click="editT
+ 105, 109, 101, 114,  40,  54,  41,  34,  62,  38,  35, 120, // imer(6)">&#x
+  49,  70,  52,  68,  68,  59,  60,  47,  98, 117, 116, 116, // 1F4DD;</butt
+ 111, 110,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // on>..       
+  32,  32,  32,  32,  32,  60,  98, 117, 116, 116, 111, 110, //      <button
+  32, 105, 100,  61,  34,  98, 116, 110,  67,  54,  34,  32, //  id="btnC6" 
+  99, 108,  97, 115, 115,  61,  34,  99,  97, 110,  99, 101, // class="cance
+ 108,  34,  32, 111, 110,  99, 108, 105,  99, 107,  61,  34, // l" onclick="
+  99,  97, 110,  99, 101, 108,  84, 105, 109, 101, 114,  40, // cancelTimer(
+  54,  41,  34,  62,  38,  35, 120,  50,  55,  70,  50,  59, // 6)">&#x27F2;
+  60,  47,  98, 117, 116, 116, 111, 110,  62,  13,  10,  32, // </button>.. 
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, //            <
- 116,  97,  98, 108, 101,  62,  13,  10,  32,  32,  32,  32, // table>..    
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 116, //           <t
- 114,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // r>..        
-  32,  32,  32,  32,  32,  32,  32,  32,  60, 116, 100,  32, //         <td 
-  99, 108,  97, 115, 115,  61,  34, 116, 100,  97, 121,  34, // class="tday"
-  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32, // >..         
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 108,  97, //          <la
-  98, 101, 108,  62,  77,  60,  98, 114,  62,  60, 105, 110, // bel>M<br><in
- 112, 117, 116,  32, 105, 100,  61,  34, 116,  54,  68,  97, // put id="t6Da
- 121,  49,  34,  32, 116, 121, 112, 101,  61,  34,  99, 104, // y1" type="ch
- 101,  99, 107,  98, 111, 120,  34,  32, 118,  97, 108, 117, // eckbox" valu
- 101,  61,  34,  48,  34,  32, 100, 105, 115,  97,  98, 108, // e="0" disabl
- 101, 100,  62,  60,  47, 108,  97,  98, 101, 108,  62,  13, // ed></label>.
+  98, 117, 116, 116, 111, 110,  32, 105, 100,  61,  34,  98, // button id="b
+ 116, 110,  65,  54,  34,  32,  99, 108,  97, 115, 115,  61, // tnA6" class=
+  34,  99, 111, 112, 121,  98, 116, 110,  34,  32, 111, 110, // "copybtn" on
+  99, 108, 105,  99, 107,  61,  34,  99, 111, 112, 121,  84, // click="copyT
+ 105, 109, 101, 114,  84, 111,  65, 108, 108,  40,  54,  41, // imerToAll(6)
+  34,  32, 116, 105, 116, 108, 101,  61,  34,  67, 111, 112, // " title="Cop
+ 121,  32, 116, 111,  32,  97, 108, 108,  32, 116, 105, 109, // y to all tim
+ 101, 114, 115,  34,  62,  38,  35, 120,  49,  70,  52,  67, // ers">&#x1F4C
+  66,  59,  60,  47,  98, 117, 116, 116, 111, 110,  62,  13, // B;</button>.
+  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, // .          <
+  47, 104,  50,  62,  13,  10,  32,  32,  32,  32,  32,  32, // /h2>..      
+  32,  32,  32,  32,  60, 112,  62,  13,  10,  32,  32,  32, //     <p>..   
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 116,  97, //          <ta
+  98, 108, 101,  62,  13,  10,  32,  32,  32,  32,  32,  32, // ble>..      
+  32,  32,  32,  32,  32,  32,  32,  32,  60, 116, 114,  62, //         <tr>
+  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
+  32,  32,  32,  32,  32,  32,  60, 116, 100,  32,  99, 108, //       <td cl
+  97, 115, 115,  61,  34, 116, 100,  97, 121,  34,  62,  13, // ass="tday">.
   10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // .           
-  32,  32,  32,  32,  32,  60,  47, 116, 100,  62,  13,  10, //      </td>..
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  32,  32,  32,  60, 116, 100,  32,  99, 108,  97, 115, //     <td clas
- 115,  61,  34, 116, 100,  97, 121,  34,  62,  13,  10,  32, // s="tday">.. 
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  32,  32,  32,  32,  60, 108,  97,  98, 101, 108,  62, //      <label>
-  84,  60,  98, 114,  62,  60, 105, 110, 112, 117, 116,  32, // T<br><input 
- 105, 100,  61,  34, 116,  54,  68,  97, 121,  50,  34,  32, // id="t6Day2" 
- 116, 121, 112, 101,  61,  34,  99, 104, 101,  99, 107,  98, // type="checkb
- 111, 120,  34,  32, 118,  97, 108, 117, 101,  61,  34,  48, // ox" value="0
-  34,  32, 100, 105, 115,  97,  98, 108, 101, 100,  62,  60, // " disabled><
-  47, 108,  97,  98, 101, 108,  62,  13,  10,  32,  32,  32, // /label>..   
+  32,  32,  32,  32,  32,  32,  32,  60, 108,  97,  98, 101, //        <labe
+ 108,  62,  77,  60,  98, 114,  62,  60, 105, 110, 112, 117, // l>M<br><inpu
+ 116,  32, 105, 100,  61,  34, 116,  54,  68,  97, 121,  49, // t id="t6Day1
+  34,  32, 116, 121, 112, 101,  61,  34,  99, 104, 101,  99, // " type="chec
+ 107,  98, 111, 120,  34,  32, 118,  97, 108, 117, 101,  61, // kbox" value=
+  34,  48,  34,  32, 100, 105, 115,  97,  98, 108, 101, 100, // "0" disabled
+  62,  60,  47, 108,  97,  98, 101, 108,  62,  13,  10,  32, // ></label>.. 
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  60,  47, 116, 100,  62,  13,  10,  32,  32,  32,  32, //  </td>..    
+  32,  32,  32,  60,  47, 116, 100,  62,  13,  10,  32,  32, //    </td>..  
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  60, 116, 100,  32,  99, 108,  97, 115, 115,  61,  34, 116, // <td class="t
- 100,  97, 121,  34,  62,  13,  10,  32,  32,  32,  32,  32, // day">..     
+  32,  32,  60, 116, 100,  32,  99, 108,  97, 115, 115,  61, //   <td class=
+  34, 116, 100,  97, 121,  34,  62,  13,  10,  32,  32,  32, // "tday">..   
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  60, 108,  97,  98, 101, 108,  62,  87,  60,  98, 114, //  <label>W<br
-  62,  60, 105, 110, 112, 117, 116,  32, 105, 100,  61,  34, // ><input id="
- 116,  54,  68,  97, 121,  51,  34,  32, 116, 121, 112, 101, // t6Day3" type
-  61,  34,  99, 104, 101,  99, 107,  98, 111, 120,  34,  32, // ="checkbox" 
- 118,  97, 108, 117, 101,  61,  34,  48,  34,  32, 100, 105, // value="0" di
- 115,  97,  98, 108, 101, 100,  62,  60,  47, 108,  97,  98, // sabled></lab
- 101, 108,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // el>..       
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, 116, //          </t
- 100,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // d>..        
-  32,  32,  32,  32,  32,  32,  32,  32,  60, 116, 100,  32, //         <td 
-  99, 108,  97, 115, 115,  61,  34, 116, 100,  97, 121,  34, // class="tday"
+  32,  32,  32,  60, 108,  97,  98, 101, 108,  62,  84,  60, //    <label>T<
+  98, 114,  62,  60, 105, 110, 112, 117, 116,  32, 105, 100, // br><input id
+  61,  34, 116,  54,  68,  97, 121,  50,  34,  32, 116, 121, // ="t6Day2" ty
+ 112, 101,  61,  34,  99, 104, 101,  99, 107,  98, 111, 120, // pe="checkbox
+  34,  32, 118,  97, 108, 117, 101,  61,  34,  48,  34,  32, // " value="0" 
+ 100, 105, 115,  97,  98, 108, 101, 100,  62,  60,  47, 108, // disabled></l
+  97,  98, 101, 108,  62,  13,  10,  32,  32,  32,  32,  32, // abel>..     
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, //            <
+  47, 116, 100,  62,  13,  10,  32,  32,  32,  32,  32,  32, // /td>..      
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 116, //           <t
+ 100,  32,  99, 108,  97, 115, 115,  61,  34, 116, 100,  97, // d class="tda
+ 121,  34,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // y">..       
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, //            <
+ 108,  97,  98, 101, 108,  62,  87,  60,  98, 114,  62,  60, // label>W<br><
+ 105, 110, 112, 117, 116,  32, 105, 100,  61,  34, 116,  54, // input id="t6
+  68,  97, 121,  51,  34,  32, 116, 121, 112, 101,  61,  34, // Day3" type="
+  99, 104, 101,  99, 107,  98, 111, 120,  34,  32, 118,  97, // checkbox" va
+ 108, 117, 101,  61,  34,  48,  34,  32, 100, 105, 115,  97, // lue="0" disa
+  98, 108, 101, 100,  62,  60,  47, 108,  97,  98, 101, 108, // bled></label
   62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32, // >..         
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 108,  97, //          <la
-  98, 101, 108,  62,  84,  60,  98, 114,  62,  60, 105, 110, // bel>T<br><in
- 112, 117, 116,  32, 105, 100,  61,  34, 116,  54,  68,  97, // put id="t6Da
- 121,  52,  34,  32, 116, 121, 112, 101,  61,  34,  99, 104, // y4" type="ch
- 101,  99, 107,  98, 111, 120,  34,  32, 118,  97, 108, 117, // eckbox" valu
- 101,  61,  34,  48,  34,  32, 100, 105, 115,  97,  98, 108, // e="0" disabl
- 101, 100,  62,  60,  47, 108,  97,  98, 101, 108,  62,  13, // ed></label>.
+  32,  32,  32,  32,  32,  32,  32,  60,  47, 116, 100,  62, //        </td>
+  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
+  32,  32,  32,  32,  32,  32,  60, 116, 100,  32,  99, 108, //       <td cl
+  97, 115, 115,  61,  34, 116, 100,  97, 121,  34,  62,  13, // ass="tday">.
   10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // .           
-  32,  32,  32,  32,  32,  60,  47, 116, 100,  62,  13,  10, //      </td>..
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  32,  32,  32,  60, 116, 100,  32,  99, 108,  97, 115, //     <td clas
- 115,  61,  34, 116, 100,  97, 121,  34,  62,  13,  10,  32, // s="tday">.. 
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  32,  32,  32,  32,  60, 108,  97,  98, 101, 108,  62, //      <label>
-  70,  60,  98, 114,  62,  60, 105, 110, 112, 117, 116,  32, // F<br><input 
- 105, 100,  61,  34, 116,  54,  68,  97, 121,  53,  34,  32, // id="t6Day5" 
- 116, 121, 112, 101,  61,  34,  99, 104, 101,  99, 107,  98, // type="checkb
- 111, 120,  34,  32, 118,  97, 108, 117, 101,  61,  34,  48, // ox" value="0
-  34,  32, 100, 105, 115,  97,  98, 108, 101, 100,  62,  60, // " disabled><
-  47, 108,  97,  98, 101, 108,  62,  13,  10,  32,  32,  32, // /label>..   
+  32,  32,  32,  32,  32,  32,  32,  60, 108,  97,  98, 101, //        <labe
+ 108,  62,  84,  60,  98, 114,  62,  60, 105, 110, 112, 117, // l>T<br><inpu
+ 116,  32, 105, 100,  61,  34, 116,  54,  68,  97, 121,  52, // t id="t6Day4
+  34,  32, 116, 121, 112, 101,  61,  34,  99, 104, 101,  99, // " type="chec
+ 107,  98, 111, 120,  34,  32, 118,  97, 108, 117, 101,  61, // kbox" value=
+  34,  48,  34,  32, 100, 105, 115,  97,  98, 108, 101, 100, // "0" disabled
+  62,  60,  47, 108,  97,  98, 101, 108,  62,  13,  10,  32, // ></label>.. 
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  60,  47, 116, 100,  62,  13,  10,  32,  32,  32,  32, //  </td>..    
+  32,  32,  32,  60,  47, 116, 100,  62,  13,  10,  32,  32, //    </td>..  
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  60, 116, 100,  32,  99, 108,  97, 115, 115,  61,  34, 116, // <td class="t
- 100,  97, 121,  34,  62,  13,  10,  32,  32,  32,  32,  32, // day">..     
+  32,  32,  60, 116, 100,  32,  99, 108,  97, 115, 115,  61, //   <td class=
+  34, 116, 100,  97, 121,  34,  62,  13,  10,  32,  32,  32, // "tday">..   
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  60, 108,  97,  98, 101, 108,  62,  83,  60,  98, 114, //  <label>S<br
-  62,  60, 105, 110, 112, 117, 116,  32, 105, 100,  61,  34, // ><input id="
- 116,  54,  68,  97, 121,  54,  34,  32, 116, 121, 112, 101, // t6Day6" type
-  61,  34,  99, 104, 101,  99, 107,  98, 111, 120,  34,  32, // ="checkbox" 
- 118,  97, 108, 117, 101,  61,  34,  48,  34,  32, 100, 105, // value="0" di
- 115,  97,  98, 108, 101, 100,  62,  60,  47, 108,  97,  98, // sabled></lab
- 101, 108,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // el>..       
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, 116, //          </t
- 100,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // d>..        
-  32,  32,  32,  32,  32,  32,  32,  32,  60, 116, 100,  32, //         <td 
-  99, 108,  97, 115, 115,  61,  34, 116, 100,  97, 121,  34, // class="tday"
+  32,  32,  32,  60, 108,  97,  98, 101, 108,  62,  70,  60, //    <label>F<
+  98, 114,  62,  60, 105, 110, 112, 117, 116,  32, 105, 100, // br><input id
+  61,  34, 116,  54,  68,  97, 121,  53,  34,  32, 116, 121, // ="t6Day5" ty
+ 112, 101,  61,  34,  99, 104, 101,  99, 107,  98, 111, 120, // pe="checkbox
+  34,  32, 118,  97, 108, 117, 101,  61,  34,  48,  34,  32, // " value="0" 
+ 100, 105, 115,  97,  98, 108, 101, 100,  62,  60,  47, 108, // disabled></l
+  97,  98, 101, 108,  62,  13,  10,  32,  32,  32,  32,  32, // abel>..     
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, //            <
+  47, 116, 100,  62,  13,  10,  32,  32,  32,  32,  32,  32, // /td>..      
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 116, //           <t
+ 100,  32,  99, 108,  97, 115, 115,  61,  34, 116, 100,  97, // d class="tda
+ 121,  34,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // y">..       
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, //            <
+ 108,  97,  98, 101, 108,  62,  83,  60,  98, 114,  62,  60, // label>S<br><
+ 105, 110, 112, 117, 116,  32, 105, 100,  61,  34, 116,  54, // input id="t6
+  68,  97, 121,  54,  34,  32, 116, 121, 112, 101,  61,  34, // Day6" type="
+  99, 104, 101,  99, 107,  98, 111, 120,  34,  32, 118,  97, // checkbox" va
+ 108, 117, 101,  61,  34,  48,  34,  32, 100, 105, 115,  97, // lue="0" disa
+  98, 108, 101, 100,  62,  60,  47, 108,  97,  98, 101, 108, // bled></label
   62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32, // >..         
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 108,  97, //          <la
-  98, 101, 108,  62,  83,  60,  98, 114,  62,  60, 105, 110, // bel>S<br><in
- 112, 117, 116,  32, 105, 100,  61,  34, 116,  54,  68,  97, // put id="t6Da
- 121,  55,  34,  32, 116, 121, 112, 101,  61,  34,  99, 104, // y7" type="ch
- 101,  99, 107,  98, 111, 120,  34,  32, 118,  97, 108, 117, // eckbox" valu
- 101,  61,  34,  48,  34,  32, 100, 105, 115,  97,  98, 108, // e="0" disabl
- 101, 100,  62,  60,  47, 108,  97,  98, 101, 108,  62,  13, // ed></label>.
+  32,  32,  32,  32,  32,  32,  32,  60,  47, 116, 100,  62, //        </td>
+  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
+  32,  32,  32,  32,  32,  32,  60, 116, 100,  32,  99, 108, //       <td cl
+  97, 115, 115,  61,  34, 116, 100,  97, 121,  34,  62,  13, // ass="tday">.
   10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // .           
-  32,  32,  32,  32,  32,  60,  47, 116, 100,  62,  13,  10, //      </td>..
+  32,  32,  32,  32,  32,  32,  32,  60, 108,  97,  98, 101, //        <labe
+ 108,  62,  83,  60,  98, 114,  62,  60, 105, 110, 112, 117, // l>S<br><inpu
+ 116,  32, 105, 100,  61,  34, 116,  54,  68,  97, 121,  55, // t id="t6Day7
+  34,  32, 116, 121, 112, 101,  61,  34,  99, 104, 101,  99, // " type="chec
+ 107,  98, 111, 120,  34,  32, 118,  97, 108, 117, 101,  61, // kbox" value=
+  34,  48,  34,  32, 100, 105, 115,  97,  98, 108, 101, 100, // "0" disabled
+  62,  60,  47, 108,  97,  98, 101, 108,  62,  13,  10,  32, // ></label>.. 
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  32,  32,  60,  47, 116, 114,  62,  13,  10,  32,  32,  32, //   </tr>..   
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, 116, //          </t
-  97,  98, 108, 101,  62,  13,  10,  32,  32,  32,  32,  32, // able>..     
-  32,  32,  32,  32,  32,  60,  47, 112,  62,  13,  10,  32, //      </p>.. 
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 112,  62, //          <p>
-  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
-  32,  32,  79,  78,  58,  32,  60, 115, 112,  97, 110,  32, //   ON: <span 
- 105, 100,  61,  34, 116,  54,  79, 110,  34,  62,  49,  50, // id="t6On">12
-  58,  48,  48,  32,  65,  77,  60,  47, 115, 112,  97, 110, // :00 AM</span
-  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32, // >..         
-  32,  32,  32,  60,  98, 114,  62,  13,  10,  32,  32,  32, //    <br>..   
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, 105, 110, //          <in
- 112, 117, 116,  32, 105, 100,  61,  34, 116,  54,  79, 110, // put id="t6On
-  73, 110, 112, 117, 116,  34,  32, 111, 110, 105, 110, 112, // Input" oninp
- 117, 116,  61,  34, 109, 111, 118, 101,  84, 105, 109, 101, // ut="moveTime
-  40,  54,  44,  32,  39,  79, 110,  39,  41,  34,  32, 116, // (6, 'On')" t
- 121, 112, 101,  61,  34, 114,  97, 110, 103, 101,  34,  32, // ype="range" 
- 109, 105, 110,  61,  34,  48,  34,  32, 109,  97, 120,  61, // min="0" max=
-  34,  49,  52,  49,  48,  34,  32, 115, 116, 101, 112,  61, // "1410" step=
-  34,  49,  53,  34,  32, 118,  97, 108, 117, 101,  61,  34, // "15" value="
-  48,  34,  32, 100, 105, 115,  97,  98, 108, 101, 100,  62, // 0" disabled>
-  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // ..          
-  60,  47, 112,  62,  13,  10,  32,  32,  32,  32,  32,  32, // </p>..      
-  32,  32,  32,  32,  60, 112,  62,  13,  10,  32,  32,  32, //     <p>..   
-  32,  32,  32,  32,  32,  32,  32,  32,  32,  79,  70,  70, //          OFF
-  58,  32,  60, 115, 112,  97, 110,  32, 105, 100,  61,  34, // : <span id="
- 116,  54,  79, 102, 102,  34,  62,  49,  50,  58,  48,  48, // t6Off">12:00
-  32,  65,  77,  60,  47, 115, 112,  97, 110,  62,  13,  10, //  AM</span>..
+  32,  32,  32,  60,  47, 116, 100,  62,  13,  10,  32,  32, //    </td>..  
   32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
-  60,  98, 114,  62,  13,  10,  32,  32,  32,  32,  32,  32, // <br>..      
-  32,  32,  32,  32,  32,  32,  60, 105, 110, 112, 117, 116, //       <input
-  32, 105, 100,  61,  34, 116,  54,  79, 102, 102,  73, 110, //  id="t6OffIn
+  60,  47, 116, 114,  62,  13,  10,  32,  32,  32,  32,  32, // </tr>..     
+  32,  32,  32,  32,  32,  32,  32,  60,  47, 116,  97,  98, //        </tab
+ 108, 101,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // le>..       
+  32,  32,  32,  60,  47, 112,  62,  13,  10,  32,  32,  32, //    </p>..   
+  32,  32,  32,  32,  32,  32,  32,  60, 112,  62,  13,  10, //        <p>..
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, //             
+  79,  78,  58,  32,  60, 115, 112,  97, 110,  32, 105, 100, // ON: <span id
+  61,  34, 116,  54,  79, 110,  34,  62,  49,  50,  58,  48, // ="t6On">12:0
+  48,  32,  65,  77,  60,  47, 115, 112,  97, 110,  62,  13, // 0 AM</span>.
+  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32, // .           
+  32,  60,  98, 114,  62,  13,  10,  32,  32,  32,  32,  32, //  <br>..     
+  32,  32,  32,  32,  32,  32,  32,  60, 105, 110, 112, 117, //        <inpu
+ 116,  32, 105, 100,  61,  34, 116,  54,  79, 110,  73, 110, // t id="t6OnIn
  112, 117, 116,  34,  32, 111, 110, 105, 110, 112, 117, 116, // put" oninput
   61,  34, 109, 111, 118, 101,  84, 105, 109, 101,  40,  54, // ="moveTime(6
-  44,  32,  39,  79, 102, 102,  39,  41,  34,  32, 116, 121, // , 'Off')" ty
- 112, 101,  61,  34, 114,  97, 110, 103, 101,  34,  32, 109, // pe="range" m
- 105, 110,  61,  34,  48,  34,  32, 109,  97, 120,  61,  34, // in="0" max="
-  49,  52,  49,  48,  34,  32, 115, 116, 101, 112,  61,  34, // 1410" step="
-  49,  53,  34,  32, 118,  97, 108, 117, 101,  61,  34,  48, // 15" value="0
-  34,  32, 100, 105, 115,  97,  98, 108, 101, 100,  62,  13, // " disabled>.
-  10,  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60, // .          <
-  47, 112,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32, // /p>..       
+  44,  32,  39,  79, 110,  39,  41,  34,  32, 116, 121, 112, // , 'On')" typ
+ 101,  61,  34, 114,  97, 110, 103, 101,  34,  32, 109, 105, // e="range" mi
+ 110,  61,  34,  48,  34,  32, 109,  97, 120,  61,  34,  49, // n="0" max="1
+  52,  49,  48,  34,  32, 115, 116, 101, 112,  61,  34,  49, // 410" step="1
+  53,  34,  32, 118,  97, 108, 117, 101,  61,  34,  48,  34, // 5" value="0"
+  32, 100, 105, 115,  97,  98, 108, 101, 100,  62,  13,  10, //  disabled>..
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, //           </
+ 112,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // p>..        
+  32,  32,  60, 112,  62,  13,  10,  32,  32,  32,  32,  32, //   <p>..     
+  32,  32,  32,  32,  32,  32,  32,  79,  70,  70,  58,  32, //        OFF: 
+  60, 115, 112,  97, 110,  32, 105, 100,  61,  34, 116,  54, // <span id="t6
+  79, 102, 102,  34,  62,  49,  50,  58,  48,  48,  32,  65, // Off">12:00 A
+  77,  60,  47, 115, 112,  97, 110,  62,  13,  10,  32,  32, // M</span>..  
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  98, //           <b
+ 114,  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32, // r>..        
+  32,  32,  32,  32,  60, 105, 110, 112, 117, 116,  32, 105, //     <input i
+ 100,  61,  34, 116,  54,  79, 102, 102,  73, 110, 112, 117, // d="t6OffInpu
+ 116,  34,  32, 111, 110, 105, 110, 112, 117, 116,  61,  34, // t" oninput="
+ 109, 111, 118, 101,  84, 105, 109, 101,  40,  54,  44,  32, // moveTime(6, 
+  39,  79, 102, 102,  39,  41,  34,  32, 116, 121, 112, 101, // 'Off')" type
+  61,  34, 114,  97, 110, 103, 101,  34,  32, 109, 105, 110, // ="range" min
+  61,  34,  48,  34,  32, 109,  97, 120,  61,  34,  49,  52, // ="0" max="14
+  49,  48,  34,  32, 115, 116, 101, 112,  61,  34,  49,  53, // 10" step="15
+  34,  32, 118,  97, 108, 117, 101,  61,  34,  48,  34,  32, // " value="0" 
+ 100, 105, 115,  97,  98, 108, 101, 100,  62,  13,  10,  32, // disabled>.. 
+  32,  32,  32,  32,  32,  32,  32,  32,  32,  60,  47, 112, //          </p
+  62,  13,  10,  32,  32,  32,  32,  32,  32,  32,  32,  60, // >..        <
+  47, 100, 105, 118,  62,  13,  10,  32,  32,  32,  32,  32, // /div>..     
   32,  60,  47, 100, 105, 118,  62,  13,  10,  32,  32,  32, //  </div>..   
-  32,  32,  32,  60,  47, 100, 105, 118,  62,  13,  10,  32, //    </div>.. 
-  32,  32,  32,  60,  47, 100, 105, 118,  62,  13,  10,  32, //    </div>.. 
-  32,  60,  47,  98, 111, 100, 121,  62,  13,  10,  13,  10, //  </body>....
-  32,  32,  60, 115,  99, 114, 105, 112, 116,  32, 115, 114, //   <script sr
-  99,  61,  34,  47, 104, 101,  97, 116, 105, 110, 103,  46, // c="/heating.
- 106, 115,  34,  62,  60,  47, 115,  99, 114, 105, 112, 116, // js"></script
-  62,  13,  10,  13,  10,  60,  47, 104, 116, 109, 108,  62, 0 // >....</html>
+  32,  60,  47, 100, 105, 118,  62,  13,  10,  32,  32,  60, //  </div>..  <
+  47,  98, 111, 100, 121,  62,  13,  10,  13,  10,  32,  32, // /body>....  
+  60, 115,  99, 114, 105, 112, 116,  32, 115, 114,  99,  61, // <script src=
+  34,  47, 104, 101,  97, 116, 105, 110, 103,  46, 106, 115, // "/heating.js
+  34,  62,  60,  47, 115,  99, 114, 105, 112, 116,  62,  13, // "></script>.
+  10,  13,  10,  60,  47, 104, 116, 109, 108,  62, 0 // ...</html>
 };
 
 static const struct packed_file {
@@ -2218,8 +2409,8 @@ static const struct packed_file {
   size_t size;
   time_t mtime;
 } packed_files[] = {
-  {"/web/heating.js", v1, sizeof(v1), 1766850891},
-  {"/web/index.html", v2, sizeof(v2), 1766930245},
+  {"/web/heating.js", v1, sizeof(v1), 1792389010},
+  {"/web/index.html", v2, sizeof(v2), 1792384565},
   {NULL, NULL, 0, 0}
 };
 
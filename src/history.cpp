@@ -0,0 +1,416 @@
+/*
+ * history.cpp
+ *
+ * Minute resolution heating history kept in a dedicated flash region
+ * Appending is O(1): a minute in the same state extends the open run, a change writes one record into the RAM page
+ * The page is programmed when full and at the end of each day, so a day costs at most one partial page program,
+ * and sectors are only erased when the ring wraps onto them
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "hardware/sync.h"
+#include "history.h"
+#include "rollup.h"
+#include "ring_log.h"
+
+#define PAGES_PER_SECTOR (FLASH_SECTOR_SIZE / FLASH_PAGE_SIZE)
+#define RUN_MAX_LEN 3 // Tag and a two byte varint, a day is 1440 minutes
+#define DAY_MAX_LEN 9 // Tag, day delta and start minute
+
+// Export state kept in c->data between polls
+#define EXPORT_FORMAT 3 // 'c' CSV or 'j' NDJSON
+#define EXPORT_CURSOR 16 // s_history_cursor
+#define EXPORT_TO (EXPORT_CURSOR + sizeof(s_history_cursor)) // uint16_t day to stop before
+#define EXPORT_SINCE (EXPORT_TO + 2) // uint32_t stamp, only runs starting at or after it are sent
+static_assert(EXPORT_SINCE + sizeof(uint32_t) <= MG_DATA_SIZE, "History export state must fit in c->data");
+#define EXPORT_MAX_SEND 1024 // Stop formatting while this much is waiting to go out
+#define EXPORT_MAX_RUNS 64 // Runs read per call, so skipping to a range start is spread over polls
+
+// Provided by the Pico SDK linker script
+extern "C" char __flash_binary_end;
+
+static bool s_enabled = false;
+
+// Page being filled, a copy of what is, or will be, in flash at s_page
+static uint8_t s_buf[FLASH_PAGE_SIZE];
+static uint16_t s_used = 0; // Bytes of s_buf in use
+static uint16_t s_programmed = 0; // Bytes of s_buf already in flash
+static uint16_t s_page = 0; // Physical page index of s_buf
+static uint16_t s_oldest = 0; // Physical page index of the oldest page
+static uint32_t s_seq = 0; // Sequence number of s_buf
+static uint16_t s_page_day = 0; // Last day block written in s_buf
+
+// Open run, not yet written
+static uint16_t s_day = 0;
+static uint16_t s_minute = 0; // Last minute sampled
+static uint16_t s_run_start = 0;
+static uint16_t s_run_len = 0;
+static uint8_t s_run_state = 0;
+
+static size_t put_varint(uint8_t *p, uint32_t v) {
+	size_t n = 0;
+	while (v >= 0x80) {
+		p[n++] = (uint8_t) (v | 0x80);
+		v >>= 7;
+	}
+	p[n++] = (uint8_t) v;
+	return n;
+}
+
+/***
+ * Read a varint, stopping at the end of the page
+ */
+static uint32_t get_varint(const uint8_t *p, uint16_t *pos) {
+	uint32_t v = 0;
+	for (int shift = 0; *pos < FLASH_PAGE_SIZE && shift < 32; shift += 7) {
+		uint8_t b = p[(*pos)++];
+		v |= (uint32_t) (b & 0x7F) << shift;
+		if (b < 0x80)
+			break;
+	}
+	return v;
+}
+
+static inline const uint8_t *flash_page(uint16_t page) {
+	return (const uint8_t *) (uintptr_t) (XIP_BASE + HISTORY_FLASH_OFFSET + page * FLASH_PAGE_SIZE);
+}
+
+static inline uint32_t page_seq(uint16_t page) {
+	uint32_t seq;
+	memcpy(&seq, flash_page(page), sizeof(seq));
+	return seq;
+}
+
+/***
+ * Program the RAM page, bytes already programmed are written again unchanged
+ */
+void history_flush() {
+	if (!s_enabled || s_used == s_programmed)
+		return;
+	uint32_t ints = save_and_disable_interrupts();
+	flash_range_program(HISTORY_FLASH_OFFSET + s_page * FLASH_PAGE_SIZE, s_buf, FLASH_PAGE_SIZE);
+	restore_interrupts(ints);
+	s_programmed = s_used;
+}
+
+/***
+ * Start a fresh page, erasing its sector first when it is the first page of one
+ * Once the ring has wrapped that sector holds the oldest pages, which are lost
+ */
+static void history_new_page(uint16_t page, uint32_t seq) {
+	if (page % PAGES_PER_SECTOR == 0) {
+		uint32_t ints = save_and_disable_interrupts();
+		flash_range_erase(HISTORY_FLASH_OFFSET + page * FLASH_PAGE_SIZE, FLASH_SECTOR_SIZE);
+		restore_interrupts(ints);
+		if (seq > 1 && s_oldest / PAGES_PER_SECTOR == page / PAGES_PER_SECTOR)
+			s_oldest = (page + PAGES_PER_SECTOR) % HISTORY_PAGES;
+	}
+	s_page = page;
+	s_seq = seq;
+	memset(s_buf, 0xFF, sizeof(s_buf));
+	memcpy(s_buf, &s_seq, sizeof(s_seq));
+	s_used = s_programmed = HISTORY_HEADER;
+}
+
+/***
+ * Write a day block header, moving to a new page if there is no room
+ */
+static void history_put_day(uint16_t day, uint16_t minute) {
+	if (s_used + DAY_MAX_LEN > FLASH_PAGE_SIZE) {
+		history_flush();
+		history_new_page((s_page + 1) % HISTORY_PAGES, s_seq + 1);
+	}
+	int32_t delta = s_used == HISTORY_HEADER ? day : (int32_t) day - s_page_day;
+	s_buf[s_used++] = HISTORY_TAG_DAY;
+	s_used += put_varint(s_buf + s_used, (uint32_t) (delta << 1) ^ (uint32_t) (delta >> 31));
+	s_used += put_varint(s_buf + s_used, minute);
+	s_page_day = day;
+}
+
+/***
+ * Write the open run, a run that does not fit starts a new page with its own day block
+ */
+static void history_put_run() {
+	if (s_run_len == 0)
+		return;
+	if (s_used + RUN_MAX_LEN > FLASH_PAGE_SIZE) {
+		history_flush();
+		history_new_page((s_page + 1) % HISTORY_PAGES, s_seq + 1);
+		history_put_day(s_day, s_run_start);
+	}
+	s_buf[s_used++] = s_run_state;
+	s_used += put_varint(s_buf + s_used, s_run_len);
+	s_run_len = 0;
+}
+
+/***
+ * Find the newest page and reload it, or prepare an empty region
+ */
+void history_init() {
+	if ((uintptr_t) &__flash_binary_end - XIP_BASE > HISTORY_FLASH_OFFSET) {
+		RLOG_ERROR("History region overlaps the firmware, history disabled");
+		return;
+	}
+	s_enabled = true;
+
+	uint32_t newest_seq = 0, oldest_seq = UINT32_MAX;
+	uint16_t newest = 0;
+	for (uint16_t i = 0; i < HISTORY_PAGES; i++) {
+		uint32_t seq = page_seq(i);
+		if (seq == UINT32_MAX)
+			continue;
+		if (seq >= newest_seq) {
+			newest_seq = seq;
+			newest = i;
+		}
+		if (seq < oldest_seq) {
+			oldest_seq = seq;
+			s_oldest = i;
+		}
+	}
+	if (newest_seq == 0) {
+		s_oldest = 0;
+		history_new_page(0, 1);
+		return;
+	}
+
+	// Carry on filling the newest page
+	s_page = newest;
+	s_seq = newest_seq;
+	memcpy(s_buf, flash_page(newest), sizeof(s_buf));
+	uint16_t pos = HISTORY_HEADER;
+	while (pos < FLASH_PAGE_SIZE && s_buf[pos] != 0xFF) {
+		bool first = pos == HISTORY_HEADER;
+		uint8_t tag = s_buf[pos++];
+		uint32_t v = get_varint(s_buf, &pos);
+		if (tag == HISTORY_TAG_DAY) {
+			int32_t delta = (int32_t) (v >> 1) ^ -(int32_t) (v & 1);
+			s_page_day = first ? delta : s_page_day + delta;
+			get_varint(s_buf, &pos);
+		}
+	}
+	s_used = s_programmed = pos;
+	RLOG_INFO("History resumed at page %u, %u bytes used", s_page, s_used);
+}
+
+/***
+ * Copy the writer state out for retained RAM
+ */
+void history_retain(s_history_state *st) {
+	st->enabled = s_enabled;
+	st->used = s_used;
+	st->programmed = s_programmed;
+	st->page = s_page;
+	st->oldest = s_oldest;
+	st->seq = s_seq;
+	st->page_day = s_page_day;
+	st->day = s_day;
+	st->minute = s_minute;
+	st->run_start = s_run_start;
+	st->run_len = s_run_len;
+	st->run_state = s_run_state;
+	memcpy(st->buf, s_buf, sizeof(s_buf));
+}
+
+/***
+ * Take the writer state back from retained RAM after a warm reset, instead of history_init()
+ */
+void history_resume(const s_history_state *st) {
+	s_enabled = st->enabled;
+	s_used = st->used;
+	s_programmed = st->programmed;
+	s_page = st->page;
+	s_oldest = st->oldest;
+	s_seq = st->seq;
+	s_page_day = st->page_day;
+	s_day = st->day;
+	s_minute = st->minute;
+	s_run_start = st->run_start;
+	s_run_len = st->run_len;
+	s_run_state = st->run_state;
+	memcpy(s_buf, st->buf, sizeof(s_buf));
+}
+
+/***
+ * Sample the state, called every second from the one second timer
+ * A minute in the same state extends the open run, anything else closes it
+ * Minutes at or before the last one of the same day are skipped, so the hour repeated when daylight saving
+ * ends is not written as a second, overlapping run or counted twice in the rollups
+ * @param day days since 2000-01-01
+ * @param minute minute of the day
+ * @param state HISTORY_ state code
+ */
+void history_tick(uint16_t day, uint16_t minute, uint8_t state) {
+	if (!s_enabled || day < HISTORY_MIN_DAY || (day == s_day && minute <= s_minute))
+		return;
+	rollup_add(day, minute, 1, HISTORY_IS_ON(state));
+	bool follows = day == s_day && minute == s_minute + 1;
+	if (follows && s_run_len && state == s_run_state) {
+		s_run_len++;
+		s_minute = minute;
+		return;
+	}
+	history_put_run();
+	if (!follows) {
+		// New day, or the clock moved on - finished days are committed to flash
+		if (day != s_day && s_day != 0)
+			history_flush();
+		history_put_day(day, minute);
+	}
+	s_day = day;
+	s_minute = minute;
+	s_run_start = minute;
+	s_run_len = 1;
+	s_run_state = state;
+}
+
+/***
+ * Start reading from the oldest record
+ */
+void history_cursor_start(s_history_cursor *cur) {
+	memset(cur, 0, sizeof(*cur));
+}
+
+/***
+ * Read the next run, oldest first, ending with the run still open
+ * @return false when there are no more runs
+ */
+bool history_next(s_history_cursor *cur, s_history_run *run) {
+	if (!s_enabled)
+		return false;
+	uint16_t pages = (s_page + HISTORY_PAGES - s_oldest) % HISTORY_PAGES + 1;
+	while (cur->page < pages) {
+		uint16_t page = (s_oldest + cur->page) % HISTORY_PAGES;
+		const uint8_t *p = page == s_page ? s_buf : flash_page(page);
+		if (cur->pos < HISTORY_HEADER)
+			cur->pos = HISTORY_HEADER;
+		if (cur->pos >= FLASH_PAGE_SIZE || p[cur->pos] == 0xFF) {
+			cur->page++;
+			cur->pos = 0;
+			continue;
+		}
+		bool first = cur->pos == HISTORY_HEADER;
+		uint8_t tag = p[cur->pos++];
+		uint32_t v = get_varint(p, &cur->pos);
+		if (tag == HISTORY_TAG_DAY) {
+			int32_t delta = (int32_t) (v >> 1) ^ -(int32_t) (v & 1);
+			cur->day = first ? delta : cur->day + delta;
+			cur->minute = get_varint(p, &cur->pos);
+			continue;
+		}
+		run->day = cur->day;
+		run->start = cur->minute;
+		run->minutes = v;
+		run->state = tag;
+		cur->minute += v;
+		return true;
+	}
+	if (cur->done || s_run_len == 0)
+		return false;
+	cur->done = true;
+	run->day = s_day;
+	run->start = s_run_start;
+	run->minutes = s_run_len;
+	run->state = s_run_state;
+	return true;
+}
+
+/***
+ * Print flash use as a JSON object for get_stats
+ */
+size_t history_print_stats(void (*out)(char, void *), void *arg, va_list *ap) {
+	(void) ap;
+	uint16_t pages = s_enabled ? (s_page + HISTORY_PAGES - s_oldest) % HISTORY_PAGES + 1 : 0;
+	return mg_xprintf(out, arg, "{%m: %d, %m: %u, %m: %u, %m: %lu}", MG_ESC("enabled"), s_enabled,
+		MG_ESC("pages"), pages, MG_ESC("capacity_pages"), HISTORY_PAGES,
+		MG_ESC("bytes"), (unsigned long) (pages ? (pages - 1) * FLASH_PAGE_SIZE + s_used : 0));
+}
+
+/***
+ * Start a chunked export of the history runs, oldest first
+ * Query parameters: format=csv (default) or ndjson, from and to day numbers (to is exclusive),
+ * and since, the stamp of the last run a client already has, to fetch only that run and newer for an incremental sync
+ * @param c connection
+ * @param hm HTTP request
+ */
+void history_export_start(struct mg_connection *c, struct mg_http_message *hm) {
+	char var[12];
+	s_history_cursor cur;
+	uint16_t to = UINT16_MAX;
+	uint32_t since = 0;
+	history_cursor_start(&cur);
+	if (mg_http_get_var(&hm->query, "from", var, sizeof(var)) > 0)
+		since = (uint32_t) atol(var) * 1440;
+	if (mg_http_get_var(&hm->query, "to", var, sizeof(var)) > 0)
+		to = (uint16_t) atol(var);
+	if (mg_http_get_var(&hm->query, "since", var, sizeof(var)) > 0)
+		since = MG_MAX(since, (uint32_t) strtoul(var, NULL, 10));
+	bool ndjson = mg_http_get_var(&hm->query, "format", var, sizeof(var)) > 0 && strcmp(var, "ndjson") == 0;
+
+	mg_printf(c, "HTTP/1.1 200 OK\r\nContent-Type: %s\r\nCache-Control: no-cache\r\nTransfer-Encoding: chunked\r\n\r\n",
+		ndjson ? "application/x-ndjson" : "text/csv");
+	if (!ndjson)
+		mg_http_printf_chunk(c, "stamp,day,start,minutes,state,timer\n");
+	memcpy(c->data + EXPORT_CURSOR, &cur, sizeof(cur));
+	memcpy(c->data + EXPORT_TO, &to, sizeof(to));
+	memcpy(c->data + EXPORT_SINCE, &since, sizeof(since));
+	c->data[EXPORT_FORMAT] = ndjson ? 'j' : 'c';
+	c->data[0] = 'H';
+}
+
+/***
+ * Send more of an export while the send buffer has room, called on poll and as data is sent
+ * Memory use is the send buffer and one line buffer, whatever the size of the export
+ * @param c connection started with history_export_start()
+ */
+void history_export_poll(struct mg_connection *c) {
+	static const char *const k_states[] = {"disabled", "off", "timer", "boost"};
+	s_history_cursor cur;
+	s_history_run run;
+	uint16_t to;
+	uint32_t since;
+	char buf[256];
+	size_t n = 0;
+	bool ndjson = c->data[EXPORT_FORMAT] == 'j';
+	memcpy(&cur, c->data + EXPORT_CURSOR, sizeof(cur));
+	memcpy(&to, c->data + EXPORT_TO, sizeof(to));
+	memcpy(&since, c->data + EXPORT_SINCE, sizeof(since));
+	for (int i = 0; i < EXPORT_MAX_RUNS && c->send.len + n < EXPORT_MAX_SEND; i++) {
+		if (!history_next(&cur, &run)) {
+			if (n > 0)
+				mg_http_write_chunk(c, buf, n);
+			mg_http_write_chunk(c, "", 0);
+			// Response complete, the connection can take another request
+			c->data[0] = 0;
+			c->is_resp = 0;
+			return;
+		}
+		uint32_t stamp = (uint32_t) run.day * 1440 + run.start;
+		if (stamp < since || run.day >= to)
+			continue;
+		uint8_t state = HISTORY_STATE(run.state);
+		if (n + 128 > sizeof(buf)) {
+			mg_http_write_chunk(c, buf, n);
+			n = 0;
+		}
+		if (ndjson) {
+			n += mg_snprintf(buf + n, sizeof(buf) - n, "{%m: %lu, %m: %u, %m: %u, %m: %u, %m: %m", MG_ESC("stamp"), (unsigned long) stamp,
+				MG_ESC("day"), run.day, MG_ESC("start"), run.start, MG_ESC("minutes"), run.minutes, MG_ESC("state"), MG_ESC(k_states[state]));
+			if (state == HISTORY_TIMER)
+				n += mg_snprintf(buf + n, sizeof(buf) - n, ", %m: %u", MG_ESC("timer"), HISTORY_TIMER_INDEX(run.state) + 1);
+			n += mg_snprintf(buf + n, sizeof(buf) - n, "}\n");
+		} else if (state == HISTORY_TIMER) {
+			n += mg_snprintf(buf + n, sizeof(buf) - n, "%lu,%u,%u,%u,%s,%u\n", (unsigned long) stamp, run.day, run.start, run.minutes,
+				k_states[state], HISTORY_TIMER_INDEX(run.state) + 1);
+		} else {
+			n += mg_snprintf(buf + n, sizeof(buf) - n, "%lu,%u,%u,%u,%s,\n", (unsigned long) stamp, run.day, run.start, run.minutes,
+				k_states[state]);
+		}
+	}
+	if (n > 0)
+		mg_http_write_chunk(c, buf, n);
+	memcpy(c->data + EXPORT_CURSOR, &cur, sizeof(cur));
+}
@@ -0,0 +1,86 @@
+/*
+ * history.h
+ *
+ * Minute resolution heating history kept in a dedicated flash region
+ * Each day is a block of run-length records, built in a RAM page and programmed a page at a time
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#ifndef SRC_HISTORY_H_
+#define SRC_HISTORY_H_
+
+#include <stdarg.h>
+#include "pico/stdlib.h"
+#include "hardware/flash.h"
+#include "mongoose.h"
+
+// A day with 20 state changes is about 70 bytes, so a year fits in 7 sectors with one more erased ahead of the writer
+#define HISTORY_SECTORS 8
+#define HISTORY_NVS_RESERVE (64 * 1024) // Left free at the top of flash for NVS
+#define HISTORY_FLASH_OFFSET (PICO_FLASH_SIZE_BYTES - HISTORY_NVS_RESERVE - HISTORY_SECTORS * FLASH_SECTOR_SIZE)
+#define HISTORY_PAGES (HISTORY_SECTORS * FLASH_SECTOR_SIZE / FLASH_PAGE_SIZE)
+#define HISTORY_MIN_DAY 7305 // 2020-01-01, earlier days mean the clock has not been set
+
+// State codes, one per minute
+#define HISTORY_DISABLED 0 // Heating switched off
+#define HISTORY_OFF 1 // Heating enabled, relay off
+#define HISTORY_TIMER 2 // On by a timer, the timer index is in bits 2-4
+#define HISTORY_BOOST 3 // On by boost
+#define HISTORY_STATE(code) ((code) & 3)
+#define HISTORY_TIMER_INDEX(code) ((code) >> 2)
+#define HISTORY_IS_ON(code) (HISTORY_STATE(code) >= HISTORY_TIMER)
+
+// Page layout: 4 byte sequence number, then records up to the first 0xFF tag
+// A tag below HISTORY_TAG_DAY is a run of that state code followed by a varint count of minutes
+// HISTORY_TAG_DAY starts a day block, followed by a zigzag varint day delta (absolute when first in a page)
+// and a varint start minute, so each page decodes on its own
+#define HISTORY_TAG_DAY 0x40
+#define HISTORY_HEADER 4
+
+// A decoded run of minutes in one state
+struct s_history_run {
+	uint16_t day; // Days since 2000-01-01
+	uint16_t start; // Minute of the day
+	uint16_t minutes;
+	uint8_t state;
+};
+
+// Writer state, kept across warm resets so the unwritten part of the page is not lost
+struct s_history_state {
+	bool enabled;
+	uint16_t used;
+	uint16_t programmed;
+	uint16_t page;
+	uint16_t oldest;
+	uint32_t seq;
+	uint16_t page_day;
+	uint16_t day;
+	uint16_t minute;
+	uint16_t run_start;
+	uint16_t run_len;
+	uint8_t run_state;
+	uint8_t buf[FLASH_PAGE_SIZE];
+};
+
+// Read position, from history_cursor_start() and advanced by history_next()
+struct s_history_cursor {
+	uint16_t page; // Pages after the oldest
+	uint16_t pos; // Offset within the page, 0 before the header
+	uint16_t day;
+	uint16_t minute;
+	bool done; // The run still being counted has been returned
+};
+
+void history_init();
+void history_retain(s_history_state *st);
+void history_resume(const s_history_state *st);
+void history_tick(uint16_t day, uint16_t minute, uint8_t state);
+void history_flush();
+void history_cursor_start(s_history_cursor *cur);
+bool history_next(s_history_cursor *cur, s_history_run *run);
+void history_export_start(struct mg_connection *c, struct mg_http_message *hm);
+void history_export_poll(struct mg_connection *c);
+size_t history_print_stats(void (*out)(char, void *), void *arg, va_list *ap);
+
+#endif /* SRC_HISTORY_H_ */
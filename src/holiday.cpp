@@ -0,0 +1,222 @@
+/*
+ * holiday.cpp
+ *
+ * The window starts today and covers HOLIDAY_DAYS, as a ring of two bit codes. Each new day clears the
+ * codes of the days that have passed, which become the days at the far end, so the window rolls forward
+ * without moving anything. The table is only saved when it is set - a table loaded with days that have
+ * passed is cleared up to today on the first tick
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#include <cstring>
+#include "NVSOnboard.h"
+#include "calendar.h"
+#include "holiday.h"
+#include "ring_log.h"
+
+static s_holiday_table s_table;
+static uint16_t s_today = UINT16_MAX; // Day the tick last ran for
+static uint8_t s_today_code = HOLIDAY_NORMAL;
+
+static const char *const k_names[] = {"normal", "off", "saturday", "sunday"};
+
+static uint8_t slot_get(uint16_t slot) {
+	return s_table.codes[slot >> 2] >> ((slot & 3) * 2) & 3;
+}
+
+static void slot_put(uint16_t slot, uint8_t code) {
+	uint8_t shift = (slot & 3) * 2;
+	s_table.codes[slot >> 2] = (s_table.codes[slot >> 2] & ~(3 << shift)) | code << shift;
+}
+
+/***
+ * Slot for a day
+ * @param day days since 2000-01-01
+ * @return the slot, or HOLIDAY_DAYS if the day is outside the window
+ */
+static uint16_t slot_of(uint16_t day) {
+	if (day < s_table.start || day - s_table.start >= HOLIDAY_DAYS)
+		return HOLIDAY_DAYS;
+	uint16_t slot = s_table.slot + (day - s_table.start);
+	return slot >= HOLIDAY_DAYS ? slot - HOLIDAY_DAYS : slot;
+}
+
+static void holiday_refresh() {
+	uint16_t slot = slot_of(s_today);
+	s_today_code = slot < HOLIDAY_DAYS ? slot_get(slot) : HOLIDAY_NORMAL;
+}
+
+/***
+ * Load the table from flash, an empty table starts on the first day the tick sees
+ */
+void holiday_load() {
+	NVSOnboard *nvs = NVSOnboard::getInstance();
+	size_t len = sizeof(s_table);
+	if (!nvs->contains("holiday") || nvs->get_blob("holiday", &s_table, &len) != NVS_OK || len != sizeof(s_table) ||
+			s_table.slot >= HOLIDAY_DAYS)
+		memset(&s_table, 0, sizeof(s_table));
+	holiday_refresh();
+}
+
+/***
+ * Copy the table out for retained RAM
+ */
+void holiday_retain(s_holiday_table *st) {
+	*st = s_table;
+}
+
+/***
+ * Take the table back from retained RAM after a warm reset, instead of holiday_load()
+ */
+void holiday_resume(const s_holiday_table *st) {
+	s_table = *st;
+	if (s_table.slot >= HOLIDAY_DAYS)
+		memset(&s_table, 0, sizeof(s_table));
+	holiday_refresh();
+}
+
+/***
+ * Move the window on to today, called each second
+ * Only the day changing does any work, a clock that has not been set yet (before the window) is left alone
+ * @param today days since 2000-01-01
+ */
+void holiday_tick(uint16_t today) {
+	if (today == s_today)
+		return;
+	s_today = today;
+	if (today > s_table.start) {
+		uint16_t passed = today - s_table.start;
+		if (passed >= HOLIDAY_DAYS) {
+			memset(s_table.codes, 0, sizeof(s_table.codes));
+			s_table.slot = 0;
+		} else {
+			for (; passed > 0; passed--) {
+				slot_put(s_table.slot, HOLIDAY_NORMAL);
+				if (++s_table.slot == HOLIDAY_DAYS)
+					s_table.slot = 0;
+			}
+		}
+		s_table.start = today;
+	}
+	holiday_refresh();
+}
+
+/***
+ * @return the override code for today
+ */
+uint8_t holiday_today() {
+	return s_today_code;
+}
+
+/***
+ * Set a range of days to one code and save the table
+ * @param from first day, days since 2000-01-01
+ * @param to last day, inclusive
+ * @param code HOLIDAY_ code, HOLIDAY_NORMAL clears the range
+ * @param error set to a message when the range is invalid
+ * @return true if the range was set
+ */
+bool holiday_set(uint16_t from, uint16_t to, uint8_t code, const char **error) {
+	if (from > to) {
+		*error = "Invalid range";
+		return false;
+	}
+	uint16_t slot = slot_of(from);
+	if (slot == HOLIDAY_DAYS || slot_of(to) == HOLIDAY_DAYS) {
+		*error = "Dates must be from today to two years ahead";
+		return false;
+	}
+	for (uint16_t day = from; day <= to; day++) {
+		slot_put(slot, code);
+		if (++slot == HOLIDAY_DAYS)
+			slot = 0;
+	}
+	NVSOnboard *nvs = NVSOnboard::getInstance();
+	nvs->set_blob("holiday", &s_table, sizeof(s_table));
+	nvs->commit();
+	holiday_refresh();
+	RLOG_INFO("Holiday set for %u days from day %u: %s", to - from + 1, from, k_names[code]);
+	return true;
+}
+
+/***
+ * Parse a date
+ * @param str YYYY-MM-DD
+ * @param day set to days since 2000-01-01
+ * @return true if the date is valid and not before 2000
+ */
+bool holiday_parse_date(const char *str, uint16_t *day) {
+	static const uint8_t k_month_days[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+	uint32_t v[3] = {0, 0, 0};
+	const uint8_t k_digits[3] = {4, 2, 2};
+	for (int i = 0; i < 3; i++) {
+		for (int j = 0; j < k_digits[i]; j++, str++) {
+			if (*str < '0' || *str > '9')
+				return false;
+			v[i] = v[i] * 10 + (*str - '0');
+		}
+		if (*str++ != (i < 2 ? '-' : '\0'))
+			return false;
+	}
+	if (v[0] < 2000 || v[0] > 2099 || v[1] < 1 || v[1] > 12 || v[2] < 1 ||
+			v[2] > k_month_days[v[1] - 1] + (uint32_t) (v[1] == 2 && is_leap(v[0])))
+		return false;
+	*day = (uint16_t) (days_from_civil(v[0], v[1], v[2]) - CALENDAR_EPOCH_DAY);
+	return true;
+}
+
+/***
+ * @param name normal, off, saturday or sunday
+ * @return the HOLIDAY_ code, or -1 if unknown
+ */
+int holiday_code(const char *name) {
+	for (int i = 0; i < 4; i++)
+		if (strcmp(name, k_names[i]) == 0)
+			return i;
+	return -1;
+}
+
+static size_t holiday_print_date(void (*out)(char, void *), void *arg, uint16_t day) {
+	int32_t y = 0;
+	uint32_t m = 0, d = 0;
+	civil_from_days(day + CALENDAR_EPOCH_DAY, y, m, d);
+	char buf[HOLIDAY_DATE_LEN];
+	mg_snprintf(buf, sizeof(buf), "%04d-%02u-%02u", (int) y, (unsigned) m, (unsigned) d);
+	return mg_xprintf(out, arg, "%m", MG_ESC(buf));
+}
+
+/***
+ * Print the window and its overrides as ranges of days with the same code, as a JSON object
+ */
+size_t holiday_print(void (*out)(char, void *), void *arg, va_list *ap) {
+	(void) ap;
+	size_t n = mg_xprintf(out, arg, "{%m: ", MG_ESC("from"));
+	n += holiday_print_date(out, arg, s_table.start);
+	n += mg_xprintf(out, arg, ", %m: ", MG_ESC("to"));
+	n += holiday_print_date(out, arg, s_table.start + HOLIDAY_DAYS - 1);
+	n += mg_xprintf(out, arg, ", %m: [", MG_ESC("ranges"));
+	bool first = true;
+	uint16_t slot = s_table.slot;
+	uint8_t run_code = HOLIDAY_NORMAL;
+	uint16_t run_start = 0;
+	// One past the end closes the last run
+	for (uint16_t i = 0; i <= HOLIDAY_DAYS; i++) {
+		uint8_t code = i < HOLIDAY_DAYS ? slot_get(slot) : HOLIDAY_NORMAL;
+		if (code != run_code) {
+			if (run_code != HOLIDAY_NORMAL) {
+				n += mg_xprintf(out, arg, "%s{%m: ", first ? "" : ", ", MG_ESC("from"));
+				n += holiday_print_date(out, arg, s_table.start + run_start);
+				n += mg_xprintf(out, arg, ", %m: ", MG_ESC("to"));
+				n += holiday_print_date(out, arg, s_table.start + i - 1);
+				n += mg_xprintf(out, arg, ", %m: %m}", MG_ESC("mode"), MG_ESC(k_names[run_code]));
+				first = false;
+			}
+			run_code = code;
+			run_start = i;
+		}
+		if (++slot == HOLIDAY_DAYS)
+			slot = 0;
+	}
+	return n + mg_xprintf(out, arg, "]}");
+}
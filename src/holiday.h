@@ -0,0 +1,43 @@
+/*
+ * holiday.h
+ *
+ * Date overrides for the timers, such as off for a fortnight in August or the Sunday timers on a bank holiday
+ * Two bits per day over a rolling window from today, kept as one NVS blob, so the tick is one lookup
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#ifndef SRC_HOLIDAY_H_
+#define SRC_HOLIDAY_H_
+
+#include <stdarg.h>
+#include "pico/stdlib.h"
+#include "mongoose.h"
+
+#define HOLIDAY_DAYS 732 // Days covered from today, two years with a leap day, a multiple of 4
+#define HOLIDAY_DATE_LEN 11 // YYYY-MM-DD and the terminator
+
+// Override codes, two bits per day
+#define HOLIDAY_NORMAL 0 // Timers for the day of the week
+#define HOLIDAY_OFF 1 // Timers off, boost still runs
+#define HOLIDAY_SATURDAY 2 // Timers for Saturday
+#define HOLIDAY_SUNDAY 3 // Timers for Sunday
+
+// The window as a ring of codes, saved to flash as the NVS blob "holiday" and kept across warm resets
+struct s_holiday_table {
+	uint16_t start; // First day covered, days since 2000-01-01
+	uint16_t slot; // Slot holding the start day, the window wraps around the codes
+	uint8_t codes[HOLIDAY_DAYS / 4]; // Four days to a byte, the lowest bits first
+};
+
+void holiday_load();
+void holiday_retain(s_holiday_table *st);
+void holiday_resume(const s_holiday_table *st);
+void holiday_tick(uint16_t today);
+uint8_t holiday_today();
+bool holiday_set(uint16_t from, uint16_t to, uint8_t code, const char **error);
+bool holiday_parse_date(const char *str, uint16_t *day);
+int holiday_code(const char *name);
+size_t holiday_print(void (*out)(char, void *), void *arg, va_list *ap);
+
+#endif /* SRC_HOLIDAY_H_ */
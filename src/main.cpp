@@ -13,39 +13,99 @@
 #include "pico/util/datetime.h"
 #include <time.h>
 #include "hardware/rtc.h"
+#include "pico/rand.h"
+#include "hardware/watchdog.h"
 
 #include "NVSOnboard.h"
 #include "mongoose.h"
 
 #include "main.h"
+#include "admission.h"
+#include "arena.h"
+#include "boot.h"
+#include "calendar.h"
+#include "clock_sync.h"
+#include "energy.h"
+#include "history.h"
+#include "holiday.h"
+#include "mem_pool.h"
+#include "mem_watch.h"
+#include "net.h"
+#include "retain.h"
+#include "rollup.h"
+#include "ring_log.h"
+#include "status_json.h"
+#include "tariff.h"
+#include "tz.h"
 
 struct mg_mgr g_mgr;
 
-// Used to determine if data needs to be sent on websocket
+// Used to determine if the status snapshot needs rebuilding and sending on websocket
 // Set to true when:
 // Date/Time changes
 // Any set API received
-// First websocket load
 bool state_changed = true; 
 
-// SNTP client connection
-static struct mg_connection *s_sntp_conn = NULL;
-
 struct s_status {
 	uint8_t current_day = 1; // Day 1-7
-	uint16_t current_time = 0; // Time since start of day in minutes
+	uint16_t current_time = 0; // Local time since start of day in minutes
+	int16_t utc_offset = 0; // Minutes added to UTC for local time
 	bool heating_state = false;
+	uint8_t holiday = HOLIDAY_NORMAL; // Override for today from the holiday calendar
 	bool is_heating = false;
 	uint16_t boost_timer_countdown = 0;
 	uint8_t boost_pressed = 0;
 	uint16_t timers[6][3] = {{127, 450, 390},{0, 420, 420},{0, 420, 420},{0, 420, 420},{0, 420, 420},{0, 420, 420}};
 } g_status;
+static_assert(sizeof(s_status) <= RETAIN_STATUS_MAX, "Status must fit in retained RAM");
+
+// Status JSON sent by the REST API and WebSocket, each # is an integer from write_status()
+static constexpr JsonTemplate<"{\"status\": \"OK\", \"current_day\": #, \"current_time\": #, \"utc_offset\": #, \"heating_state\": #, \"holiday\": #, \"is_heating\": #, "
+	"\"boost_timer_countdown\": #, \"energy_today_wh\": #, \"timers\": [[#, #, #],[#, #, #],[#, #, #],[#, #, #],[#, #, #],[#, #, #]]}\n"> k_status_json;
+
+// Serialised status and its HTTP header, rebuilt by status_refresh() only when state_changed is set
+// The version increases each time the content changes, and tags the ETag along with a per-boot id
+struct s_snapshot {
+	uint32_t version = 0;
+	size_t len = 0;
+	size_t head_len = 0;
+	char etag[24] = "";
+	size_t sse_len = 0;
+	char head[160];
+	char json[k_status_json.max_len];
+	char sse[k_status_json.max_len + SSE_FRAME_MAX]; // Server-sent event carrying the JSON, shared by all subscribers
+} g_snapshot;
+// A websocket frame header is at most 4 bytes for these lengths, less than the event framing
+static_assert(k_status_json.max_len + SSE_FRAME_MAX <= POOL_STREAM_SIZE, "A status frame must fit in one stream buffer block");
+
+static uint32_t s_boot_id = 0; // Random per boot, so an ETag from before a restart never matches
+static uint32_t s_broadcast_version = 0; // Snapshot version last sent to websockets
+
+// Parked long-poll request, kept in c->data after the 'L' mark
+struct s_long_poll {
+	uint32_t version; // Snapshot version the client already has
+	uint32_t deadline; // Uptime in seconds when a 304 is sent instead
+};
+static_assert(4 + sizeof(s_long_poll) <= MG_DATA_SIZE, "Long-poll state must fit in c->data");
+
+static uint32_t s_sse_heartbeat = 0; // Uptime in seconds when the next server-sent event heartbeat is due
+
+// Cost of sending the last status change to one class of subscriber
+struct s_fanout_stats {
+	uint16_t clients = 0;
+	uint32_t bytes = 0; // Queued for all clients
+	uint32_t last_us = 0; // Time taken to queue for all clients
+	uint32_t max_us = 0;
+} g_ws_stats, g_sse_stats;
 
 static void mif_fn(struct mg_tcpip_if *ifp, int ev, void *ev_data) {
   	// TODO(): should we include this inside ifp ? add an fn_data ?
 	if (ev == MG_TCPIP_EV_ST_CHG) {
-		MG_INFO(("State change: %u", *(uint8_t *) ev_data));
+		RLOG_INFO("State change: %u", *(uint8_t *) ev_data);
+		if (*(uint8_t *) ev_data == MG_TCPIP_STATE_READY)
+			boot_mark(BOOT_ONLINE);
 	}
+	net_event(ifp, ev, ev_data);
 }
 
 void wifi_setconfig(void *data) {
@@ -119,31 +179,44 @@ static void relay_timer(void *arg) {
 }
 
 /***
- * 1-second timer, used to check state and enable/disable heating and send data back via websocket if required
- * @param arg
+ * Read the RTC and update the status day and time, which follow the local time zone, and today's holiday override
+ * @return the calendar for this second
  */
-static void one_second_timer(void *arg) {
-	
-	// Get the RTC date and time
-	datetime_t dt;
-	rtc_get_datetime(&dt);
-
-	/*MG_INFO(("RTC: %d-%d-%d %d:%d:%d\n", dt.year, dt.month, dt.day, dt.hour, dt.min, dt.sec));*/
-	uint16_t new_time = dt.hour * 60 + dt.min;
+static const s_calendar *clock_read() {
+	const s_calendar *cal = calendar_tick(calendar_read_rtc());
+	holiday_tick(cal->day);
+	if (g_status.holiday != holiday_today()) {
+		g_status.holiday = holiday_today();
+		state_changed = true;
+	}
+	if (g_status.utc_offset * 60 != cal->offset) {
+		g_status.utc_offset = cal->offset / 60;
+		state_changed = true;
+	}
 	// Day will change when time changes, so implied
-	if (new_time != g_status.current_time) {
-		g_status.current_day = day_of_week(&dt);
-		g_status.current_time = new_time;
+	if (cal->minute != g_status.current_time) {
+		g_status.current_day = cal->dow;
+		g_status.current_time = cal->minute;
 		state_changed = true;
 	}
+	return cal;
+}
 
-	// iterate through timers
+/***
+ * Decide whether the heating should be on from the timers and boost
+ * A holiday override turns the timers off for the day, or runs them as Saturday or Sunday
+ * @return the timer index charged with the energy, ENERGY_BOOST or ENERGY_NONE
+ */
+static uint8_t heating_decide() {
+	// iterate through timers, the first one on is charged with the energy
     g_status.is_heating = false;
+	uint8_t source = ENERGY_NONE;
+	uint8_t timer_day = g_status.holiday == HOLIDAY_SATURDAY ? 6 : g_status.holiday == HOLIDAY_SUNDAY ? 7 : g_status.current_day;
     // if heating is enabled
     if (g_status.heating_state) {
-		for (char i = 0; i < 6; i++) {
+		for (char i = 0; i < 6 && g_status.holiday != HOLIDAY_OFF; i++) {
 			// if timer is enabled for today (bitwise AND)
-			if (1 << (g_status.current_day - 1) & g_status.timers[i][0]) {
+			if (1 << (timer_day - 1) & g_status.timers[i][0]) {
 				// if the on and off timer are not the same
 				if (g_status.timers[i][1] != g_status.timers[i][2]) {
 					if (g_status.timers[i][1] < g_status.timers[i][2]) {
@@ -159,78 +232,334 @@ static void one_second_timer(void *arg) {
 					}
 				}
 			}
+			if (g_status.is_heating && source == ENERGY_NONE)
+				source = i;
 		}
 		if (g_status.boost_timer_countdown > 0) {
 			g_status.is_heating = true;
-            g_status.boost_timer_countdown--; // take off 1 second
-			state_changed = true;
+			if (source == ENERGY_NONE)
+				source = ENERGY_BOOST;
 		}
 	}
+	return source;
+}
+
+/***
+ * 1-second timer, used to check state and enable/disable heating and send data back via websocket if required
+ * @param arg
+ */
+static void one_second_timer(void *arg) {
+	
+	// Get the time
+	const s_calendar *cal = clock_read();
+
+	uint8_t source = heating_decide();
+	if (g_status.heating_state && g_status.boost_timer_countdown > 0) {
+		g_status.boost_timer_countdown--; // take off 1 second
+		state_changed = true;
+	}
+	energy_tick(cal->day, source);
+	history_tick(cal->day, g_status.current_time, !g_status.heating_state ? HISTORY_DISABLED : source == ENERGY_NONE ? HISTORY_OFF : 
+		source == ENERGY_BOOST ? HISTORY_BOOST : HISTORY_TIMER | source << 2);
+	boot_clock_tick(cal->utc);
 	
-	// If status changed, send web socket
-	if (state_changed) {
-		struct mg_mgr *mgr = (struct mg_mgr *) arg;
-		struct mg_connection *c;
-		for (c = mgr->conns; c != NULL; c = c->next) {
-			if (c->data[0] != 'W') continue;
-			MG_INFO(("WS Send"));
-
-			mg_ws_printf(c, WEBSOCKET_OP_TEXT, 
-				"{%m: %m, %m: %d, %m: %d, %m: %d, %m: %d, %m: %d, %m: [[%d, %d, %d],[%d, %d, %d],[%d, %d, %d],[%d, %d, %d],[%d, %d, %d],[%d, %d, %d]]}\n", 
-				MG_ESC("status"), MG_ESC("OK"), MG_ESC("current_day"), g_status.current_day, MG_ESC("current_time"), g_status.current_time, 
-				MG_ESC("heating_state"), g_status.heating_state, MG_ESC("is_heating"), g_status.is_heating, 
-				MG_ESC("boost_timer_countdown"), g_status.boost_timer_countdown, MG_ESC("timers"), 
-				g_status.timers[0][0], g_status.timers[0][1], g_status.timers[0][2],
-				g_status.timers[1][0], g_status.timers[1][1], g_status.timers[1][2],
-				g_status.timers[2][0], g_status.timers[2][1], g_status.timers[2][2],
-				g_status.timers[3][0], g_status.timers[3][1], g_status.timers[3][2],
-				g_status.timers[4][0], g_status.timers[4][1], g_status.timers[4][2],
-				g_status.timers[5][0], g_status.timers[5][1], g_status.timers[5][2]
-			);
+	// If status changed, send web socket and wake long polls
+	status_publish((struct mg_mgr *) arg);
+
+	// Keep this second's state for a warm reset
+	s_retain_settings settings = {boost_timer, boost_timer_add, element_watts, ""};
+	strcpy(settings.tz, tz_get());
+	retain_save(&g_status, sizeof(g_status), &settings, cal->utc);
+}
+
+/***
+ * Serialise the current status as JSON, the one definition used by every output
+ * @param buf destination, at least k_status_json.max_len bytes
+ * @return length written
+ */
+static size_t write_status(char *buf) {
+	const int32_t values[] = {
+		g_status.current_day, g_status.current_time, g_status.utc_offset, g_status.heating_state, g_status.holiday, g_status.is_heating, g_status.boost_timer_countdown, (int32_t) energy_today_wh(),
+		g_status.timers[0][0], g_status.timers[0][1], g_status.timers[0][2],
+		g_status.timers[1][0], g_status.timers[1][1], g_status.timers[1][2],
+		g_status.timers[2][0], g_status.timers[2][1], g_status.timers[2][2],
+		g_status.timers[3][0], g_status.timers[3][1], g_status.timers[3][2],
+		g_status.timers[4][0], g_status.timers[4][1], g_status.timers[4][2],
+		g_status.timers[5][0], g_status.timers[5][1], g_status.timers[5][2]
+	};
+	return k_status_json.write(buf, values);
+}
+
+/***
+ * Rebuild the status snapshot if state has changed since it was last built
+ * The version only moves on when the serialised bytes differ
+ */
+static void status_refresh() {
+	if (!state_changed)
+		return;
+	state_changed = false;
+
+	char buf[k_status_json.max_len];
+	size_t len = write_status(buf);
+	if (len == g_snapshot.len && memcmp(buf, g_snapshot.json, len) == 0)
+		return;
+
+	memcpy(g_snapshot.json, buf, len);
+	g_snapshot.len = len;
+	g_snapshot.version++;
+	mg_snprintf(g_snapshot.etag, sizeof(g_snapshot.etag), "\"%08lx-%lu\"", (unsigned long) s_boot_id, (unsigned long) g_snapshot.version);
+	// Server-sent event, the JSON already ends with the newline for the data line, one more ends the event
+	g_snapshot.sse_len = mg_snprintf(g_snapshot.sse, sizeof(g_snapshot.sse), "id: %08lx-%lu\ndata: ", (unsigned long) s_boot_id, (unsigned long) g_snapshot.version);
+	memcpy(g_snapshot.sse + g_snapshot.sse_len, g_snapshot.json, len);
+	g_snapshot.sse_len += len;
+	g_snapshot.sse[g_snapshot.sse_len++] = '\n';
+	g_snapshot.head_len = mg_snprintf(g_snapshot.head, sizeof(g_snapshot.head), 
+		"HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nCache-Control: no-cache\r\nETag: %s\r\nX-Status-Version: %lu\r\nContent-Length: %lu\r\n\r\n", 
+		g_snapshot.etag, (unsigned long) g_snapshot.version, (unsigned long) len);
+}
+
+/***
+ * Send the status snapshot to every websocket, event stream and parked long-poll if it has changed
+ * Long-polls past their deadline are answered with a 304, event streams get a periodic heartbeat
+ * @param mgr event manager
+ */
+static void status_publish(struct mg_mgr *mgr) {
+	status_refresh();
+	bool changed = g_snapshot.version != s_broadcast_version;
+	uint32_t now = mg_millis() / 1000;
+	bool heartbeat = (int32_t) (now - s_sse_heartbeat) >= 0;
+	s_fanout_stats ws = {}, sse = {};
+	struct mg_connection *c;
+	for (c = mgr->conns; c != NULL; c = c->next) {
+		if (!c->is_accepted) // Client connections, such as SNTP, keep their own state in c->data
+			continue;
+		// A subscriber still sending an earlier frame is skipped rather than queued behind, so a stalled client
+		// cannot grow its buffer. Every frame is the whole status, which changes at least once a minute
+		if ((c->data[0] == 'W' || c->data[0] == 'S') && c->send.len > 0)
+			continue;
+		if (c->data[0] == 'W' && changed) {
+			RLOG_DEBUG("WS Send");
+			uint32_t start = time_us_32();
+			ws.bytes += mg_ws_send(c, g_snapshot.json, g_snapshot.len, WEBSOCKET_OP_TEXT);
+			ws.last_us += time_us_32() - start;
+			ws.clients++;
+		} else if (c->data[0] == 'S') {
+			uint32_t start = time_us_32();
+			if (changed) {
+				mg_send(c, g_snapshot.sse, g_snapshot.sse_len);
+				sse.bytes += g_snapshot.sse_len;
+			} else if (heartbeat) {
+				mg_send(c, ": hb\n\n", 6);
+			}
+			sse.last_us += time_us_32() - start;
+			sse.clients++;
+		} else if (c->data[0] == 'L') {
+			struct s_long_poll lp;
+			memcpy(&lp, c->data + 4, sizeof(lp));
+			if (lp.version != g_snapshot.version) {
+				mg_send(c, g_snapshot.head, g_snapshot.head_len);
+				mg_send(c, g_snapshot.json, g_snapshot.len);
+			} else if ((int32_t) (now - lp.deadline) >= 0) {
+				mg_printf(c, "HTTP/1.1 304 Not Modified\r\nCache-Control: no-cache\r\nETag: %s\r\n\r\n", g_snapshot.etag);
+			} else {
+				continue;
+			}
+			c->data[0] = 0;
+			c->is_resp = 0;
+		}
+	}
+	if (changed) {
+		ws.max_us = MG_MAX(ws.last_us, g_ws_stats.max_us);
+		sse.max_us = MG_MAX(sse.last_us, g_sse_stats.max_us);
+		g_ws_stats = ws;
+		g_sse_stats = sse;
+	}
+	if (changed || heartbeat)
+		s_sse_heartbeat = now + SSE_HEARTBEAT;
+	s_broadcast_version = g_snapshot.version;
+}
+
+/***
+ * Start a server-sent event stream of status changes
+ * The current status is sent first unless Last-Event-ID shows the client already has it
+ * @param c connection
+ * @param hm HTTP request
+ */
+static void http_event_stream(struct mg_connection *c, struct mg_http_message *hm) {
+	status_refresh();
+	mg_printf(c, "HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\nCache-Control: no-cache\r\n\r\nretry: %d\n\n", SSE_RETRY_MS);
+	struct mg_str *last_id = mg_http_get_header(hm, "Last-Event-ID");
+	// The event id is the ETag without its quotes
+	struct mg_str id = mg_str_n(g_snapshot.etag + 1, strlen(g_snapshot.etag) - 2);
+	if (last_id == NULL || mg_strcmp(*last_id, id) != 0)
+		mg_send(c, g_snapshot.sse, g_snapshot.sse_len);
+	// The response never completes, so is_resp stays set and no further requests are read
+	c->data[0] = 'S';
+}
+
+/***
+ * Report status fan-out cost and memory for each kind of subscriber
+ * @param c connection
+ */
+static void http_send_stats(struct mg_connection *c) {
+	size_t ws_mem = 0, sse_mem = 0;
+	uint16_t ws_clients = 0, sse_clients = 0;
+	for (struct mg_connection *t = c->mgr->conns; t != NULL; t = t->next) {
+		if (!t->is_accepted)
+			continue;
+		size_t mem = sizeof(*t) + t->recv.size + t->send.size;
+		if (t->data[0] == 'W') {
+			ws_mem += mem;
+			ws_clients++;
+		} else if (t->data[0] == 'S') {
+			sse_mem += mem;
+			sse_clients++;
 		}
-		// Sent state, clear status
-		state_changed = false;
 	}
+	mg_http_reply(c, 200, "Content-Type: application/json\r\n", 
+		"{%m: %m, %m: {%m: %d, %m: %lu, %m: %lu, %m: %lu, %m: %lu}, %m: {%m: %d, %m: %lu, %m: %lu, %m: %lu, %m: %lu}, %m: %M, %m: %M, %m: %M, %m: %M, %m: %M, %m: %M, %m: %M}\n",
+		MG_ESC("status"), MG_ESC("OK"),
+		MG_ESC("websocket"), MG_ESC("clients"), ws_clients, MG_ESC("last_fanout_us"), (unsigned long) g_ws_stats.last_us, 
+		MG_ESC("max_fanout_us"), (unsigned long) g_ws_stats.max_us, MG_ESC("last_fanout_bytes"), (unsigned long) g_ws_stats.bytes,
+		MG_ESC("bytes_per_client"), (unsigned long) (ws_clients ? ws_mem / ws_clients : 0),
+		MG_ESC("sse"), MG_ESC("clients"), sse_clients, MG_ESC("last_fanout_us"), (unsigned long) g_sse_stats.last_us, 
+		MG_ESC("max_fanout_us"), (unsigned long) g_sse_stats.max_us, MG_ESC("last_fanout_bytes"), (unsigned long) g_sse_stats.bytes,
+		MG_ESC("bytes_per_client"), (unsigned long) (sse_clients ? sse_mem / sse_clients : 0),
+		MG_ESC("rejected"), admission_print_stats,
+		MG_ESC("memory"), pool_print_stats,
+		MG_ESC("arena"), arena_print_stats,
+		MG_ESC("ram"), mem_watch_print_stats,
+		MG_ESC("network"), net_print_stats,
+		MG_ESC("sntp"), clock_sync_print_stats,
+		MG_ESC("history"), history_print_stats
+	);
 }
 
+/***
+ * Long-poll for a status change
+ * The client passes the version it has, as If-None-Match or ?version=, and an optional ?timeout= in seconds
+ * If that is already out of date the snapshot is sent now, otherwise the connection is parked for status_publish()
+ * @param c connection
+ * @param hm HTTP request
+ */
+static void http_long_poll(struct mg_connection *c, struct mg_http_message *hm) {
+	status_refresh();
+	struct s_long_poll lp = {g_snapshot.version, 0};
+	char var[12];
+	struct mg_str *inm = mg_http_get_header(hm, "If-None-Match");
+	if (mg_http_get_var(&hm->query, "version", var, sizeof(var)) > 0) {
+		lp.version = strtoul(var, NULL, 10);
+	} else if (inm == NULL || mg_strcmp(*inm, mg_str(g_snapshot.etag)) != 0) {
+		lp.version = g_snapshot.version - 1; // No or stale ETag, answer straight away
+	}
+	if (lp.version != g_snapshot.version) {
+		mg_send(c, g_snapshot.head, g_snapshot.head_len);
+		mg_send(c, g_snapshot.json, g_snapshot.len);
+		c->is_resp = 0;
+		return;
+	}
+
+	uint32_t timeout = LONG_POLL_TIMEOUT;
+	if (mg_http_get_var(&hm->query, "timeout", var, sizeof(var)) > 0) {
+		timeout = strtoul(var, NULL, 10);
+		if (timeout < 1) timeout = 1;
+		if (timeout > LONG_POLL_TIMEOUT_MAX) timeout = LONG_POLL_TIMEOUT_MAX;
+	}
+	lp.deadline = mg_millis() / 1000 + timeout;
+	c->data[0] = 'L';
+	memcpy(c->data + 4, &lp, sizeof(lp));
+}
+
+/***
+ * Reply with the cached status snapshot
+ * Answers 304 if If-None-Match has the current ETag, and HEAD gets the headers only
+ * @param c connection
+ * @param hm HTTP request
+ */
+static void http_send_status(struct mg_connection *c, struct mg_http_message *hm) {
+	status_refresh();
+	struct mg_str *inm = mg_http_get_header(hm, "If-None-Match");
+	if (inm != NULL && mg_strcmp(*inm, mg_str(g_snapshot.etag)) == 0) {
+		mg_printf(c, "HTTP/1.1 304 Not Modified\r\nCache-Control: no-cache\r\nETag: %s\r\n\r\n", g_snapshot.etag);
+	} else {
+		mg_send(c, g_snapshot.head, g_snapshot.head_len);
+		if (mg_strcmp(hm->method, mg_str("HEAD")) != 0)
+			mg_send(c, g_snapshot.json, g_snapshot.len);
+	}
+	c->is_resp = 0; // Response complete, same as mg_http_reply
+}
+
+#if STATUS_BENCHMARK
+/***
+ * Time the compile time serialiser against the printf formatting used by mg_ws_printf
+ * Results are logged once at boot
+ */
+static void status_benchmark() {
+	const int runs = 1000;
+	char buf_tpl[k_status_json.max_len];
+	char buf_fmt[k_status_json.max_len + 1];
+	size_t len_tpl = 0, len_fmt = 0;
+
+	uint64_t start = time_us_64();
+	for (int i = 0; i < runs; i++)
+		len_tpl = write_status(buf_tpl);
+	uint64_t tpl_us = time_us_64() - start;
+
+	start = time_us_64();
+	for (int i = 0; i < runs; i++) {
+		len_fmt = mg_snprintf(buf_fmt, sizeof(buf_fmt),
+			"{%m: %m, %m: %d, %m: %d, %m: %d, %m: %d, %m: %d, %m: %d, %m: %d, %m: %d, %m: [[%d, %d, %d],[%d, %d, %d],[%d, %d, %d],[%d, %d, %d],[%d, %d, %d],[%d, %d, %d]]}\n", 
+			MG_ESC("status"), MG_ESC("OK"), MG_ESC("current_day"), g_status.current_day, MG_ESC("current_time"), g_status.current_time, 
+			MG_ESC("utc_offset"), g_status.utc_offset, MG_ESC("heating_state"), g_status.heating_state, MG_ESC("holiday"), g_status.holiday, MG_ESC("is_heating"), g_status.is_heating, 
+			MG_ESC("boost_timer_countdown"), g_status.boost_timer_countdown, MG_ESC("energy_today_wh"), (int) energy_today_wh(), MG_ESC("timers"), 
+			g_status.timers[0][0], g_status.timers[0][1], g_status.timers[0][2],
+			g_status.timers[1][0], g_status.timers[1][1], g_status.timers[1][2],
+			g_status.timers[2][0], g_status.timers[2][1], g_status.timers[2][2],
+			g_status.timers[3][0], g_status.timers[3][1], g_status.timers[3][2],
+			g_status.timers[4][0], g_status.timers[4][1], g_status.timers[4][2],
+			g_status.timers[5][0], g_status.timers[5][1], g_status.timers[5][2]
+		);
+	}
+	uint64_t fmt_us = time_us_64() - start;
+
+	bool same = len_tpl == len_fmt && memcmp(buf_tpl, buf_fmt, len_tpl) == 0;
+	RLOG_INFO("Status serialise x%d: template %lu us, printf %lu us, output %s", runs, (uint32_t) tpl_us, (uint32_t) fmt_us, same ? "identical" : "DIFFERS");
+}
+#endif
+
 /***
  * Check network timer 
- * Called every 60 seconds - resets network state if stuck in DHCP REQUESTING or DOWN
+ * Called every NET_CHECK_MS - starts a scheduled reconnect, or gives up on one stuck before READY
  * @param arg
  */
 static void net_check_timer(void *arg) {
-	/* check state */
-	//MG_INFO(("State: %d", g_mgr.ifp->state));
-	if (g_mgr.ifp->state == MG_TCPIP_STATE_DOWN) {
-		// If interface is down, request connection again
-		struct mg_wifi_data *wifi = &((struct mg_tcpip_driver_pico_w_data *) g_mgr.ifp->driver_data)->wifi;
-        MG_INFO(("Disconnected"));
-        bool res = mg_wifi_connect(wifi);
-        MG_INFO(("Manually connecting: %s", res ? "OK":"FAIL"));
-	} else if (g_mgr.ifp->state == MG_TCPIP_STATE_REQ) {
-		// Reset interface status to down, mg_tcpip_poll will cause a reconnect
-		g_mgr.ifp->state = MG_TCPIP_STATE_DOWN;
-		MG_INFO(("State was MG_TCPIP_STATE_REQ, reset state to MG_TCPIP_STATE_DOWN"));
-	}
+	net_poll(((struct mg_mgr *) arg)->ifp);
+}
+
+/***
+ * Log drain timer, formats a few pending log entries to USB
+ * @param arg
+ */
+static void log_drain_timer(void *arg) {
+	(void) arg;
+	ring_log_drain_usb();
+}
+
+/***
+ * Memory watch timer, samples stack and heap high-water marks
+ * @param arg
+ */
+static void mem_watch_timer(void *arg) {
+	(void) arg;
+	mem_watch_sample();
 }
 
 /***
- * SNTP Timer - runs every 10 seconds, but only updates daily as required
+ * SNTP Timer - runs every 10 seconds, but only starts a round of requests when one is due
  * @param arg
  */
 static void sntp_timer(void *arg) {
-	// Check if refresh was at least 24h ago
-	if (sntp_refresh_counter > 8640)
-		sntp_refresh_required = true;
-	if (sntp_refresh_required) {
-		struct mg_mgr *mgr = (struct mg_mgr *) arg;
-		if (s_sntp_conn == NULL) { // connection issues a request
-			s_sntp_conn = mg_sntp_connect(mgr, NULL, sfn, NULL);
-		} else {
-			mg_sntp_request(s_sntp_conn);
-		}
-	}
-	sntp_refresh_counter++;
+	clock_sync_tick((struct mg_mgr *) arg);
 }
 
 /*
@@ -260,9 +589,24 @@ static void get_data() {
 		if (nvs->contains("heating_state")) {
 			nvs->get_bool("heating_state", &g_status.heating_state);
 		}
-		MG_INFO(("Data read from flash"));
+		if (nvs->contains("boost_timer")) {
+			nvs->get_u16("boost_timer", &boost_timer);
+		}
+		if (nvs->contains("boost_timer_add")) {
+			nvs->get_u16("boost_timer_add", &boost_timer_add);
+		}
+		if (nvs->contains("element_watts")) {
+			nvs->get_u16("element_watts", &element_watts);
+		}
+		if (nvs->contains("tz")) {
+			char tz[TZ_MAX_LEN];
+			size_t len = sizeof(tz);
+			if (nvs->get_str("tz", tz, &len) == NVS_OK)
+				tz_set(tz);
+		}
+		RLOG_INFO("Data read from flash");
 	} else {
-		MG_INFO(("No data in flash"));
+		RLOG_INFO("No data in flash");
 	}
 }
 
@@ -283,10 +627,14 @@ static void save_data() {
 	}
 	
 	nvs->set_bool("heating_state", g_status.heating_state);
+	nvs->set_u16("boost_timer", boost_timer);
+	nvs->set_u16("boost_timer_add", boost_timer_add);
+	nvs->set_u16("element_watts", element_watts);
+	nvs->set_str("tz", tz_get());
 
 	nvs->commit();
 
-	MG_INFO(("Data saved to flash"));
+	RLOG_INFO("Data saved to flash");
 }
 
 /*
@@ -311,32 +659,222 @@ static void do_boost() {
 	state_changed = true; 
 }
 
+/*
+ * Validate and apply a whole configuration in one request
+ * All fields are optional - timers (6 arrays of days, on, off), heating_state, boost_timer, boost_timer_add, element_watts
+ * and tz, a POSIX TZ string such as GMT0BST,M3.5.0/1,M10.5.0
+ * Everything present is validated before anything is applied, then it is saved to flash once
+ * @param json request body
+ * @param error set to a message when validation fails
+ * @return true if the configuration was applied
+ */
+static bool set_config(struct mg_str json, const char **error) {
+	uint16_t new_timers[6][3];
+	bool new_heating_state = g_status.heating_state;
+	uint16_t new_boost_timer = boost_timer;
+	uint16_t new_boost_timer_add = boost_timer_add;
+	uint16_t new_element_watts = element_watts;
+	bool has_timers = mg_json_get(json, "$.timers", NULL) >= 0;
+	double d;
+
+	if (has_timers) {
+		char path[] = "$.timers[0][0]";
+		for (char i = 0; i < 6; i++) {
+			for (char j = 0; j < 3; j++) {
+				path[9] = i+48;
+				path[12] = j+48;
+				if (!mg_json_get_num(json, path, &d)) {
+					*error = "Timers must be 6 arrays of days, on time and off time";
+					return false;
+				}
+				if (d < 0 || d > (j == 0 ? 127 : 1410)) {
+					*error = (j == 0 ? "Invalid timer days" : (j == 1 ? "Invalid on time" : "Invalid off time"));
+					return false;
+				}
+				new_timers[(int) i][(int) j] = d;
+			}
+		}
+	}
+	if (mg_json_get(json, "$.heating_state", NULL) >= 0 && !mg_json_get_bool(json, "$.heating_state", &new_heating_state)) {
+		*error = "Invalid heating state";
+		return false;
+	}
+	if (mg_json_get_num(json, "$.boost_timer", &d)) {
+		// Boost plus three increases must fit in the 16 bit countdown
+		if (d < 60 || d > 14400) {
+			*error = "Invalid boost timer";
+			return false;
+		}
+		new_boost_timer = d;
+	}
+	if (mg_json_get_num(json, "$.boost_timer_add", &d)) {
+		if (d < 0 || d > 3600) {
+			*error = "Invalid boost timer increase";
+			return false;
+		}
+		new_boost_timer_add = d;
+	}
+	if (mg_json_get_num(json, "$.element_watts", &d)) {
+		if (d < 1 || d > ELEMENT_WATTS_MAX) {
+			*error = "Invalid element watts";
+			return false;
+		}
+		new_element_watts = d;
+	}
+	const char *new_tz = arena_json_str(json, "$.tz");
+	if (new_tz != NULL && !tz_valid(new_tz)) {
+		*error = "Invalid time zone";
+		return false;
+	}
+
+	// All valid, apply together
+	if (has_timers)
+		memcpy(g_status.timers, new_timers, sizeof(new_timers));
+	g_status.heating_state = new_heating_state;
+	boost_timer = new_boost_timer;
+	boost_timer_add = new_boost_timer_add;
+	element_watts = new_element_watts;
+	if (new_tz != NULL)
+		tz_set(new_tz);
+	save_data();
+	state_changed = true;
+	return true;
+}
+
 /***
- * SNTP callback handler for Mongoose
- * @param c
- * @param ev
- * @param ev_data
+ * Apply a set_holiday request - from and to as YYYY-MM-DD (to defaults to from, inclusive) and a mode of
+ * normal, off, saturday or sunday
+ * @param json request body
+ * @param error set to a message when the request is invalid
+ * @return true if the range was set
  */
-static void sfn(struct mg_connection *c, int ev, void *ev_data) {
-	if (ev == MG_EV_SNTP_TIME) {
-		// Time received, the internal protocol handler updates what mg_now() returns
-		uint64_t curtime = mg_now();
-		MG_INFO(("SNTP-updated current time is: %llu ms from epoch", curtime));
-		// otherwise, you can process the server returned data yourself
-		{
-			uint64_t t = *(uint64_t *) ev_data;
-			datetime_t dt;
-			time_to_datetime(t / 1000, &dt);
-			MG_INFO(("Setting RTC to: %d-%d-%d %d:%d:%d\n", dt.year, dt.month, dt.day, dt.hour, dt.min, dt.sec));
-			rtc_set_datetime(&dt);
-			// Reset counter and refresh required flag
-			sntp_refresh_counter = 0;
-			sntp_refresh_required = false;
+static bool set_holiday(struct mg_str json, const char **error) {
+	const char *str_from = arena_json_str(json, "$.from");
+	const char *str_to = arena_json_str(json, "$.to");
+	const char *str_mode = arena_json_str(json, "$.mode");
+	uint16_t from = 0, to = 0;
+	if (str_from == NULL || !holiday_parse_date(str_from, &from) || (str_to != NULL && !holiday_parse_date(str_to, &to))) {
+		*error = "Dates must be YYYY-MM-DD";
+		return false;
+	}
+	if (str_to == NULL)
+		to = from;
+	int code = str_mode == NULL ? -1 : holiday_code(str_mode);
+	if (code < 0) {
+		*error = "Mode must be normal, off, saturday or sunday";
+		return false;
+	}
+	if (!holiday_set(from, to, code, error))
+		return false;
+	g_status.holiday = holiday_today();
+	state_changed = true;
+	return true;
+}
+
+/***
+ * Apply a plan_tariff request - prices, 48 half hourly prices from midnight in any unit such as p/kWh, minutes
+ * of heating needed each day, and optionally days (timer day bits, default every day) and apply (default true)
+ * The plan replaces all six timers, windows left over are disabled
+ * @param json request body
+ * @param plan set to the plan
+ * @param apply set to false for a plan that is only returned
+ * @param error set to a message when the request is invalid
+ * @return true if planned
+ */
+static bool plan_tariff(struct mg_str json, struct s_tariff_plan *plan, bool *apply, const char **error) {
+	int32_t prices[TARIFF_SLOTS];
+	char path[] = "$.prices[00]";
+	double d;
+	for (int i = 0; i < TARIFF_SLOTS; i++) {
+		path[9] = i / 10 + 48;
+		path[10] = i % 10 + 48;
+		if (!mg_json_get_num(json, path, &d)) {
+			*error = "Prices must be 48 half hourly prices";
+			return false;
 		}
-	} else if (ev == MG_EV_CLOSE) {
-		s_sntp_conn = NULL;
+		if (d < -TARIFF_PRICE_MAX || d > TARIFF_PRICE_MAX) {
+			*error = "Invalid price";
+			return false;
+		}
+		prices[i] = (int32_t) (d * TARIFF_SCALE + (d < 0 ? -0.5 : 0.5));
+	}
+	if (mg_json_get(json, "$.prices[48]", NULL) >= 0) {
+		*error = "Prices must be 48 half hourly prices";
+		return false;
 	}
-	(void) c;
+	if (!mg_json_get_num(json, "$.minutes", &d) || d < 0 || d > 1410) {
+		*error = "Invalid heating minutes";
+		return false;
+	}
+	uint8_t slots = (uint8_t) (((uint16_t) d + TARIFF_SLOT_MIN - 1) / TARIFF_SLOT_MIN);
+	uint16_t days = 127;
+	if (mg_json_get_num(json, "$.days", &d)) {
+		if (d < 1 || d > 127) {
+			*error = "Invalid timer days";
+			return false;
+		}
+		days = d;
+	}
+	if (mg_json_get(json, "$.apply", NULL) >= 0 && !mg_json_get_bool(json, "$.apply", apply)) {
+		*error = "Invalid apply";
+		return false;
+	}
+	if (!tariff_plan(prices, slots, plan)) {
+		*error = "No plan";
+		return false;
+	}
+	RLOG_INFO("Tariff planned %u slots in %u windows, %u us", plan->slots, plan->windows, plan->us);
+	if (!*apply)
+		return true;
+
+	for (int i = 0; i < 6; i++) {
+		g_status.timers[i][0] = i < plan->windows ? days : 0;
+		g_status.timers[i][1] = i < plan->windows ? plan->on[i] : 0;
+		g_status.timers[i][2] = i < plan->windows ? plan->off[i] : 0;
+	}
+	save_data();
+	state_changed = true;
+	return true;
+}
+
+/***
+ * Read a get_history request - from and to day numbers (to is exclusive, default the last 7 days) and an optional
+ * step of hour, day or week for a series
+ * @param json request body
+ * @param q set to the query
+ * @param error set to a message when the request is invalid
+ * @return true if the query is valid
+ */
+static bool get_history_query(struct mg_str json, struct s_rollup_query *q, const char **error) {
+	double d;
+	q->to = mg_json_get_num(json, "$.to", &d) && d >= 1 && d <= UINT16_MAX ? (uint16_t) d : rollup_today() + 1;
+	q->from = mg_json_get_num(json, "$.from", &d) && d >= 0 && d <= UINT16_MAX ? (uint16_t) d : (q->to > 7 ? q->to - 7 : 0);
+	if (q->from >= q->to) {
+		*error = "Invalid range";
+		return false;
+	}
+	const char *step = arena_json_str(json, "$.step");
+	uint32_t points = 0;
+	if (step == NULL) {
+		q->step = -1;
+	} else if (strcmp(step, "hour") == 0) {
+		q->step = ROLLUP_HOUR;
+		points = (uint32_t) (q->to - q->from) * 24;
+	} else if (strcmp(step, "day") == 0) {
+		q->step = ROLLUP_DAY;
+		points = q->to - q->from;
+	} else if (strcmp(step, "week") == 0) {
+		q->step = ROLLUP_WEEK;
+		points = (q->to - q->from + 13) / 7;
+	} else {
+		*error = "Invalid step";
+		return false;
+	}
+	if (points > ROLLUP_SERIES_MAX) {
+		*error = "Too many points, use a larger step";
+		return false;
+	}
+	return true;
 }
 
 /***
@@ -346,39 +884,100 @@ static void sfn(struct mg_connection *c, int ev, void *ev_data) {
  * @param ev_data
  */
 static void http_ev_handler(struct mg_connection *c, int ev, void *ev_data) {
-	if (ev == MG_EV_HTTP_MSG){
+	// Buffer sizing by role, and freeing buffers of idle connections
+	io_buffers_event(c, ev);
+	if (ev == MG_EV_ACCEPT) {
+		// Turn away connections over the overall limit
+		admission_accept(c);
+	} else if (ev == MG_EV_POLL && c->data[0] == 'G') {
+		// Feed a /logs stream as the send buffer drains
+		ring_log_http_poll(c);
+	} else if ((ev == MG_EV_POLL || ev == MG_EV_WRITE) && c->data[0] == 'H') {
+		// Continue a history export from its cursor
+		history_export_poll(c);
+	} else if (ev == MG_EV_HTTP_MSG){
 		struct mg_http_message *hm = (struct mg_http_message *) ev_data;  // Parsed HTTP request
+		ArenaScope arena; // Transient request memory, released however the handler returns
+		// Check class limits and the per-IP rate limit, rejections are already answered
+		if (!admission_request(c, hm))
+			return;
 		if (mg_match(hm->uri, mg_str("/websocket"), NULL)) {
 			// Upgrade to websocket. From now on, a connection is a full-duplex
 			// Websocket connection, which will receive MG_EV_WS_MSG events.
 			mg_ws_upgrade(c, hm, NULL);
 			// Set some unique mark on the connection
 			c->data[0] = 'W';
-			state_changed = true; // Ensure current state is sent
+			io_buffers_role(c, IO_ROLE_STREAM);
+			// Send the current state straight away
+			status_refresh();
+			mg_ws_send(c, g_snapshot.json, g_snapshot.len, WEBSOCKET_OP_TEXT);
+		} else if (mg_match(hm->uri, mg_str("/events"), NULL)) {
+			// Server-sent event stream for read only dashboards, the role first so the first event sizes the buffer
+			io_buffers_role(c, IO_ROLE_STREAM);
+			http_event_stream(c, hm);
+		} else if (mg_match(hm->uri, mg_str("/logs"), NULL)) {
+			// Stream the log ring as plain text
+			ring_log_http_start(c);
+			io_buffers_role(c, IO_ROLE_STREAM);
+		} else if (mg_match(hm->uri, mg_str("/api/history"), NULL)) {
+			// Stream the stored history as CSV or NDJSON
+			io_buffers_role(c, IO_ROLE_STATIC);
+			history_export_start(c, hm);
+		} else if (mg_match(hm->uri, mg_str("/api/poll"), NULL)) {
+			// Long-poll, held open until the status changes
+			http_long_poll(c, hm);
+		} else if (mg_match(hm->uri, mg_str("/api"), NULL) && 
+				(mg_strcmp(hm->method, mg_str("GET")) == 0 || mg_strcmp(hm->method, mg_str("HEAD")) == 0)) {
+			// Cheap status read for polling clients, supports If-None-Match
+			http_send_status(c, hm);
 		} else if (mg_match(hm->uri, mg_str("/api"), NULL)) {
-			char *str_action = mg_json_get_str(hm->body, "$.action");
+			const char *str_action = arena_json_str(hm->body, "$.action");
+			if (str_action == NULL) {
+				mg_http_reply(c, 400, "", "{%m: %m, %m: %m}\n", MG_ESC("status"), MG_ESC("ERROR"), MG_ESC("message"), MG_ESC("No action"));
+				return;
+			}
+
+			// Actions that commit to flash have a stricter per-IP budget, a plan_tariff with apply false only plans
+			// The budget is checked first but only spent once the write is made, so a rejected request costs nothing
+			bool tariff_apply = true;
+			mg_json_get_bool(hm->body, "$.apply", &tariff_apply);
+			if ((strcmp(str_action, "trigger_heating") == 0 || strcmp(str_action, "set_timer") == 0 || 
+					strcmp(str_action, "set_config") == 0 || strcmp(str_action, "set_holiday") == 0 || 
+					(strcmp(str_action, "plan_tariff") == 0 && tariff_apply)) && !admission_flash_allowed(c)) {
+				RLOG_INFO("Flash write rate limited");
+				return;
+			}
+			bool flash_written = false;
 			
 			if (strcmp(str_action, "get_status") == 0) {
-				MG_INFO(("Getting status"));
-				datetime_t dt;
-				rtc_get_datetime(&dt);
-				mg_http_reply(c, 200, "Content-Type: application/json\r\n", 
-					"{%m: %m, %m: %d, %m: %d, %m: %d, %m: %d, %m: %d, %m: [[%d, %d, %d],[%d, %d, %d],[%d, %d, %d],[%d, %d, %d],[%d, %d, %d],[%d, %d, %d]]}\n", 
-					MG_ESC("status"), MG_ESC("OK"), MG_ESC("current_day"), g_status.current_day, MG_ESC("current_time"), g_status.current_time, 
-					MG_ESC("heating_state"), g_status.heating_state, MG_ESC("is_heating"), g_status.is_heating, 
-					MG_ESC("boost_timer_countdown"), g_status.boost_timer_countdown, MG_ESC("timers"), 
-					g_status.timers[0][0], g_status.timers[0][1], g_status.timers[0][2],
-					g_status.timers[1][0], g_status.timers[1][1], g_status.timers[1][2],
-					g_status.timers[2][0], g_status.timers[2][1], g_status.timers[2][2],
-					g_status.timers[3][0], g_status.timers[3][1], g_status.timers[3][2],
-					g_status.timers[4][0], g_status.timers[4][1], g_status.timers[4][2],
-					g_status.timers[5][0], g_status.timers[5][1], g_status.timers[5][2]
-				);
+				RLOG_DEBUG("Getting status");
+				http_send_status(c, hm);
+			} else if (strcmp(str_action, "get_stats") == 0) {
+				http_send_stats(c);
+			} else if (strcmp(str_action, "get_history") == 0) {
+				struct s_rollup_query q;
+				const char *error = NULL;
+				if (get_history_query(hm->body, &q, &error)) {
+					mg_http_reply(c, 200, "Content-Type: application/json\r\n", "{%m: %m, %m: %M}\n",
+						MG_ESC("status"), MG_ESC("OK"), MG_ESC("history"), rollup_print, &q);
+				} else {
+					mg_http_reply(c, 400, "", "{%m: %m, %m: %m}\n", MG_ESC("status"), MG_ESC("ERROR"), MG_ESC("message"), MG_ESC(error));
+				}
+			} else if (strcmp(str_action, "get_boot") == 0) {
+				mg_http_reply(c, 200, "Content-Type: application/json\r\n", "{%m: %m, %m: %M, %m: %M}\n",
+					MG_ESC("status"), MG_ESC("OK"), MG_ESC("boot"), boot_print_stats, MG_ESC("retained"), retain_print_stats);
+			} else if (strcmp(str_action, "get_energy") == 0) {
+				mg_http_reply(c, 200, "Content-Type: application/json\r\n", "{%m: %m, %m: %M}\n",
+					MG_ESC("status"), MG_ESC("OK"), MG_ESC("energy"), energy_print);
+			} else if (strcmp(str_action, "get_holidays") == 0) {
+				mg_http_reply(c, 200, "Content-Type: application/json\r\n", "{%m: %m, %m: %M}\n",
+					MG_ESC("status"), MG_ESC("OK"), MG_ESC("holidays"), holiday_print);
 			} else if (strcmp(str_action, "trigger_heating") == 0) {
-				MG_INFO(("Trigger heating"));
+				RLOG_INFO("Trigger heating");
 				// Permanently turn heating off (holiday mode) or on
         		g_status.heating_state = !g_status.heating_state;
 				save_data();
+				flash_written = true;
 				mg_http_reply(c, 200, "Content-Type: application/json\r\n", "{%m: %m, %m: %d}",
 					MG_ESC("status"), MG_ESC("OK"), MG_ESC("heating_state"), g_status.heating_state
 				);
@@ -432,19 +1031,60 @@ static void http_ev_handler(struct mg_connection *c, int ev, void *ev_data) {
 					g_status.timers[timer_number - 1][1] = new_on_time;
 					g_status.timers[timer_number - 1][2] = new_off_time;
 					save_data();
+					flash_written = true;
 					mg_http_reply(c, 200, "Content-Type: application/json\r\n", "{%m: %m, %m: %d}",
 						MG_ESC("status"), MG_ESC("OK"), MG_ESC("timer_number"), timer_number, MG_ESC("new_days"), new_days, MG_ESC("new_on_time"), new_on_time, MG_ESC("new_off_time"), new_off_time
 					);
 					state_changed = true; 
 				}
+			} else if (strcmp(str_action, "set_config") == 0) {
+				// Change all timers, heating state and boost settings at once
+				const char *error = NULL;
+				if (set_config(hm->body, &error)) {
+					RLOG_INFO("Configuration set");
+					flash_written = true;
+					mg_http_reply(c, 200, "Content-Type: application/json\r\n", "{%m: %m, %m: %d, %m: %d, %m: %d, %m: %d, %m: %m}",
+						MG_ESC("status"), MG_ESC("OK"), MG_ESC("heating_state"), g_status.heating_state,
+						MG_ESC("boost_timer"), boost_timer, MG_ESC("boost_timer_add"), boost_timer_add, MG_ESC("element_watts"), element_watts,
+						MG_ESC("tz"), MG_ESC(tz_get())
+					);
+				} else {
+					mg_http_reply(c, 400, "", "{%m: %m, %m: %m}\n", MG_ESC("status"), MG_ESC("ERROR"), MG_ESC("message"), MG_ESC(error));
+				}
+			} else if (strcmp(str_action, "set_holiday") == 0) {
+				// Override a range of dates, to is optional for a single day
+				const char *error = NULL;
+				if (set_holiday(hm->body, &error)) {
+					flash_written = true;
+					mg_http_reply(c, 200, "Content-Type: application/json\r\n", "{%m: %m, %m: %M}\n",
+						MG_ESC("status"), MG_ESC("OK"), MG_ESC("holidays"), holiday_print);
+				} else {
+					mg_http_reply(c, 400, "", "{%m: %m, %m: %m}\n", MG_ESC("status"), MG_ESC("ERROR"), MG_ESC("message"), MG_ESC(error));
+				}
+			} else if (strcmp(str_action, "plan_tariff") == 0) {
+				// Plan the timers from half hourly prices
+				struct s_tariff_plan plan;
+				bool apply = true;
+				const char *error = NULL;
+				if (plan_tariff(hm->body, &plan, &apply, &error)) {
+					flash_written = apply;
+					mg_http_reply(c, 200, "Content-Type: application/json\r\n", "{%m: %m, %m: %s, %m: %M}\n",
+						MG_ESC("status"), MG_ESC("OK"), MG_ESC("applied"), apply ? "true" : "false", MG_ESC("plan"), tariff_print_plan, &plan);
+				} else {
+					mg_http_reply(c, 400, "", "{%m: %m, %m: %m}\n", MG_ESC("status"), MG_ESC("ERROR"), MG_ESC("message"), MG_ESC(error));
+				}
 			} else {
 				mg_http_reply(c, 400, "", "{%m: %m, %m: %m}\n", MG_ESC("status"), MG_ESC("ERROR"), MG_ESC("message"), MG_ESC("Unknown Action"));
-				MG_INFO(("Unknown action"));
+				RLOG_INFO("Unknown action");
 			}
-			
-			mg_free(str_action);
+			if (flash_written)
+				admission_flash_spend(c);
+
+			// Push any change to websockets and long-polls now, rather than on the next tick
+			status_publish(c->mgr);
 		} else {
-			MG_INFO(("Got: %s", hm->uri));
+			RLOG_DEBUG("Got: %s", hm->uri);
+			io_buffers_role(c, IO_ROLE_STATIC);
 			struct mg_http_serve_opts opts = {
 				.root_dir = "/web",
 				.fs = &mg_fs_packed
@@ -458,57 +1098,50 @@ static void http_ev_handler(struct mg_connection *c, int ev, void *ev_data) {
 	}
 }
 
-/***
- * Get the day of week from a datetime_t
- * From https://forums.raspberrypi.com/viewtopic.php?t=312419
- * @return uint8_t for the day of the week 1=Monday, 7=Sunday
- */
-uint8_t day_of_week(datetime_t *dt) {
-    uint8_t day = dt->day; 
-    uint8_t month = dt->month; 
-    uint16_t year = dt->year;
-
-    // adjust month year
-    if (month < 3) {
-        month += 12;
-        year -= 1;
-    }
-
-    // split year
-    uint32_t c = year / 100;
-    year = year % 100;
-
-    // Zeller's congruence
-    uint8_t dow = (c / 4 - 2 * c + year + year / 4 + 13 * (month + 1) / 5 + day - 1) % 7;
-	// Change Sunday from 0 to 7
-	if (dow == 0)
-		return 7;
-	else
-		return dow;
-}
-
 /***
  * Main
  * @return
  */
 int main(){
+	// Paint the stacks first, so high-water marks cover everything after this
+	mem_watch_paint();
 	stdio_init_all();
-	sleep_ms(3000);
+#if BOOT_USB_WAIT_MS
+	// Give a terminal the chance to connect and see the boot messages
+	while (!stdio_usb_connected() && time_us_32() < BOOT_USB_WAIT_MS * 1000)
+		sleep_ms(10);
+#endif
+	boot_mark(BOOT_STDIO);
 
 	printf("Go\n");
 
-	get_data();
-
-	// RTC init with default date and time
-	datetime_t dt;
-    dt.year = 2000;
-    dt.month = 1;
-    dt.day = 1;
-    dt.hour = 0;
-    dt.min = 0;
-    dt.sec = 0;
+	// A warm reset takes the clock, settings and holidays back from retained RAM, otherwise they are read from flash
 	rtc_init();
-	rtc_set_datetime(&dt);
+	s_retain_settings settings;
+	bool warm = retain_resume(&g_status, sizeof(g_status), &settings);
+	if (warm) {
+		boost_timer = settings.boost_timer;
+		boost_timer_add = settings.boost_timer_add;
+		element_watts = settings.element_watts;
+		tz_set(settings.tz);
+	} else {
+		get_data();
+		holiday_load();
+	}
+	boot_mark(BOOT_SETTINGS);
+
+	// RTC init from the last saved time after a power on, or a default date and time
+	if (!warm && !boot_clock_restore()) {
+		datetime_t dt;
+		dt.year = 2000;
+		dt.month = 1;
+		dt.day = 1;
+		dt.hour = 0;
+		dt.min = 0;
+		dt.sec = 0;
+		rtc_set_datetime(&dt);
+	}
+	boot_mark(BOOT_CLOCK);
 
 	// Boost button setup
     gpio_init(GPIO_BUTTON_PIN); // Initialise the GPIO pin
@@ -523,18 +1156,38 @@ int main(){
     gpio_set_dir(GPIO_RELAY_HOLD, GPIO_OUT); // Set it as an output
     gpio_put(GPIO_RELAY_HOLD, 0);
 
+	// Drive the relay for the current time now, rather than after storage and networking are up
+	clock_read();
+	heating_decide();
+	relay_timer(NULL);
+	boot_mark(BOOT_DECISION);
+
+	// A warm reset already has these from retained RAM
+	if (!warm) {
+		energy_load();
+		history_init();
+		rollup_rebuild();
+	}
+	boot_mark(BOOT_STORAGE);
+
 	// do not access the CYW43 LED before Mongoose initializes !
-	MG_INFO(("Hardware initialised, starting firmware..."));
+	RLOG_INFO("Hardware initialised, starting firmware...");
 	
 	// This blocks forever. Call it at the end of main()
 	mg_mgr_init(&g_mgr);      // Initialise event manager
+	boot_mark(BOOT_NETIF);
+	s_boot_id = get_rand_32();
 
   	// Host name
 	memcpy(g_mgr.ifp->dhcp_name, "water", 6);
 	g_mgr.ifp->fn = mif_fn;
+	net_init(g_mgr.ifp);
 
-	mg_log_set(MG_LL_DEBUG);  // Set log level to debug
-	MG_INFO(("Starting HTTP listener"));
+	mg_log_set(LOG_LEVEL);  // Set Mongoose's log level, application logs go through the ring logger
+#if STATUS_BENCHMARK
+	status_benchmark();
+#endif
+	RLOG_INFO("Starting HTTP listener");
 	mg_http_listen(&g_mgr, HTTP_URL, http_ev_handler, NULL);
 
 	// This timer just blinks every second
@@ -544,13 +1197,21 @@ int main(){
 	// This timer does the relay output and hold
 	mg_timer_add(&g_mgr, 300, MG_TIMER_REPEAT, relay_timer, NULL);
 	// This timer activates any timers and sends status to open web sockets
-	mg_timer_add(&g_mgr, 1000, MG_TIMER_REPEAT, one_second_timer, &g_mgr);
-	// This timer does an SNTP refresh. Refresh happens once a day, but timer checks if the time needs setting every 10s
+	mg_timer_add(&g_mgr, 1000, MG_TIMER_REPEAT | MG_TIMER_RUN_NOW, one_second_timer, &g_mgr);
+	// This timer runs SNTP. Syncs are an hour to a week apart, adapted to the measured drift, but the timer checks every 10s whether one is due
 	mg_timer_add(&g_mgr, 10000, MG_TIMER_REPEAT | MG_TIMER_RUN_NOW, sntp_timer, &g_mgr);
-	// This timer is a network reset check
-	mg_timer_add(&g_mgr, 60000, MG_TIMER_REPEAT | MG_TIMER_RUN_NOW, net_check_timer, &g_mgr);
+	// This timer writes the log ring to USB
+	mg_timer_add(&g_mgr, RING_LOG_DRAIN_MS, MG_TIMER_REPEAT, log_drain_timer, NULL);
+	// This timer samples stack and heap high-water marks
+	mg_timer_add(&g_mgr, MEM_WATCH_INTERVAL, MG_TIMER_REPEAT, mem_watch_timer, NULL);
+	// This timer starts scheduled reconnects, the schedule itself is set by interface events in mif_fn
+	mg_timer_add(&g_mgr, NET_CHECK_MS, MG_TIMER_REPEAT, net_check_timer, &g_mgr);
+
+	// Reset if the loop stops, state is then resumed from retained RAM
+	watchdog_enable(WATCHDOG_MS, true);
 	for (;;) {
 		mg_mgr_poll(&g_mgr, 10);
+		watchdog_update();
 	}
 	mg_mgr_free(&g_mgr); // Free manager resources
 
@@ -1,12 +1,16 @@
 #define HTTP_URL "http://0.0.0.0:80"
 
+#define LONG_POLL_TIMEOUT 30 // Default seconds a long-poll is held open
+#define LONG_POLL_TIMEOUT_MAX 300
+
+#define SSE_HEARTBEAT 15 // Seconds between event stream heartbeat comments
+#define SSE_RETRY_MS 3000 // Reconnect delay suggested to event stream clients
+#define SSE_FRAME_MAX 32 // Event id and data prefix, and the blank line ending an event, around the status JSON
+
 #define GPIO_BUTTON_PIN 18
 #define GPIO_RELAY_TRIG 28
 #define GPIO_RELAY_HOLD 27
 
-uint64_t sntp_refresh_counter = 0;
-bool sntp_refresh_required = true;
-
 uint16_t boost_timer = 1800; // timer in seconds (30 minutes)
 uint16_t boost_timer_add = 900; // timer increase in seconds (15 minutes)
 
@@ -14,13 +18,27 @@ static void blink_timer(void *arg);
 static void button_timer(void *arg);
 static void relay_timer(void *arg);
 static void one_second_timer(void *arg);
+static const struct s_calendar *clock_read();
+static uint8_t heating_decide();
 static void net_check_timer(void *arg);
 static void sntp_timer(void *arg);
+static void mem_watch_timer(void *arg);
+static void log_drain_timer(void *arg);
+
+static size_t write_status(char *buf);
+static void status_refresh();
+static void status_publish(struct mg_mgr *mgr);
+static void http_long_poll(struct mg_connection *c, struct mg_http_message *hm);
+static void http_event_stream(struct mg_connection *c, struct mg_http_message *hm);
+static void http_send_stats(struct mg_connection *c);
+static void http_send_status(struct mg_connection *c, struct mg_http_message *hm);
 
 static void get_data();
 static void save_data();
 static void do_boost();
-uint8_t day_of_week(datetime_t *dt);
+static bool set_config(struct mg_str json, const char **error);
+static bool set_holiday(struct mg_str json, const char **error);
+static bool plan_tariff(struct mg_str json, struct s_tariff_plan *plan, bool *apply, const char **error);
+static bool get_history_query(struct mg_str json, struct s_rollup_query *q, const char **error);
 
-static void sfn(struct mg_connection *c, int ev, void *ev_data);
 static void http_ev_handler(struct mg_connection *c, int ev, void *ev_data);
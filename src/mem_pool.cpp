@@ -0,0 +1,185 @@
+/*
+ * mem_pool.cpp
+ *
+ * Fixed size block pools behind Mongoose's mg_calloc / mg_free
+ * A request takes the smallest class that fits, falling back to the heap if that class is full or
+ * the request is larger than every class
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#include <stdlib.h>
+#include "mem_pool.h"
+
+#define LOG_MODULE_LEVEL MG_LL_ERROR
+#include "ring_log.h"
+
+struct s_pool {
+	uint16_t size; // Block size
+	uint16_t count; // Number of blocks
+	uint8_t *base; // Storage
+	void *free_list; // Free blocks, linked through their first word
+	uint16_t in_use;
+	uint16_t peak;
+	uint32_t fallback; // Requests that went to the heap because this pool was full
+};
+
+alignas(8) static uint8_t s_small[POOL_SMALL_COUNT][POOL_SMALL_SIZE];
+alignas(8) static uint8_t s_conn[POOL_CONN_COUNT][POOL_CONN_SIZE];
+alignas(8) static uint8_t s_stream[POOL_STREAM_COUNT][POOL_STREAM_SIZE];
+alignas(8) static uint8_t s_io[POOL_IO_COUNT][POOL_IO_SIZE];
+
+// Smallest first, so the first that fits is the tightest
+static s_pool s_pools[] = {
+	{POOL_SMALL_SIZE, POOL_SMALL_COUNT, &s_small[0][0], NULL, 0, 0, 0},
+	{POOL_CONN_SIZE, POOL_CONN_COUNT, &s_conn[0][0], NULL, 0, 0, 0},
+	{POOL_STREAM_SIZE, POOL_STREAM_COUNT, &s_stream[0][0], NULL, 0, 0, 0},
+	{POOL_IO_SIZE, POOL_IO_COUNT, &s_io[0][0], NULL, 0, 0, 0},
+};
+static const int k_pools = sizeof(s_pools) / sizeof(s_pools[0]);
+
+static bool s_initialised = false;
+static uint32_t s_heap_allocs = 0; // Heap blocks currently held
+static uint32_t s_heap_failures = 0; // Heap allocations that failed
+
+// Role and last traffic time of a connection, kept in c->data
+#define IO_DATA_ROLE 2
+#define IO_DATA_ACTIVE 12
+static_assert(IO_DATA_ACTIVE + sizeof(uint32_t) <= MG_DATA_SIZE, "I/O buffer state must fit in c->data");
+
+static const uint16_t k_role_align[IO_ROLES] = {IO_ALIGN_REQUEST, IO_ALIGN_STATIC, IO_ALIGN_STREAM};
+static uint32_t s_role_peak[IO_ROLES]; // Largest connection plus buffers seen for each role
+
+/***
+ * Thread every block of every pool onto its free list
+ */
+static void pool_init() {
+	for (s_pool *p = s_pools; p < s_pools + k_pools; p++) {
+		p->free_list = NULL;
+		for (int i = p->count - 1; i >= 0; i--) {
+			void **block = (void **) (p->base + (size_t) i * p->size);
+			*block = p->free_list;
+			p->free_list = block;
+		}
+	}
+	s_initialised = true;
+}
+
+/***
+ * Allocate zeroed memory for Mongoose
+ * @param count number of elements
+ * @param size size of each element
+ * @return memory, or NULL if neither a pool nor the heap could supply it
+ */
+void *mg_calloc(size_t count, size_t size) {
+	if (!s_initialised)
+		pool_init();
+	if (size != 0 && count > SIZE_MAX / size)
+		return NULL;
+	size_t n = count * size;
+
+	for (s_pool *p = s_pools; p < s_pools + k_pools; p++) {
+		if (n > p->size) continue;
+		if (p->free_list == NULL) {
+			p->fallback++;
+			break;
+		}
+		void **block = (void **) p->free_list;
+		p->free_list = *block;
+		p->in_use++;
+		if (p->in_use > p->peak) p->peak = p->in_use;
+		memset(block, 0, n);
+		return block;
+	}
+
+	void *ptr = calloc(count, size);
+	if (ptr == NULL) {
+		s_heap_failures++;
+		RLOG_ERROR("Allocation of %lu bytes failed", n);
+	} else {
+		s_heap_allocs++;
+	}
+	return ptr;
+}
+
+/***
+ * Free memory from mg_calloc, returning pool blocks to their pool
+ * @param ptr memory, may be NULL
+ */
+void mg_free(void *ptr) {
+	if (ptr == NULL)
+		return;
+	uint8_t *addr = (uint8_t *) ptr;
+	for (s_pool *p = s_pools; p < s_pools + k_pools; p++) {
+		if (addr < p->base || addr >= p->base + (size_t) p->count * p->size) continue;
+		void **block = (void **) ptr;
+		*block = p->free_list;
+		p->free_list = block;
+		p->in_use--;
+		return;
+	}
+	free(ptr);
+	s_heap_allocs--;
+}
+
+/***
+ * Size a connection's I/O buffers for its role
+ * Buffers grow in steps of the role's alignment, existing contents are kept
+ * @param c connection
+ * @param role what the connection is used for
+ */
+void io_buffers_role(struct mg_connection *c, io_role role) {
+	c->data[IO_DATA_ROLE] = role;
+	c->recv.align = role == IO_ROLE_STREAM ? IO_ALIGN_STREAM : IO_ALIGN_REQUEST;
+	c->send.align = k_role_align[role];
+}
+
+/***
+ * Track traffic on accepted connections and free empty buffers once idle
+ * Call for every event on the HTTP listener's connections
+ * @param c connection
+ * @param ev Mongoose event
+ */
+void io_buffers_event(struct mg_connection *c, int ev) {
+	if (!c->is_accepted)
+		return;
+	uint32_t now = (uint32_t) mg_millis();
+	if (ev == MG_EV_ACCEPT) {
+		io_buffers_role(c, IO_ROLE_REQUEST);
+		memcpy(c->data + IO_DATA_ACTIVE, &now, sizeof(now));
+	} else if (ev == MG_EV_READ || ev == MG_EV_WRITE) {
+		memcpy(c->data + IO_DATA_ACTIVE, &now, sizeof(now));
+	} else if (ev == MG_EV_POLL) {
+		uint8_t role = c->data[IO_DATA_ROLE];
+		uint32_t mem = POOL_CONN_SIZE + c->recv.size + c->send.size;
+		if (role < IO_ROLES && mem > s_role_peak[role])
+			s_role_peak[role] = mem;
+
+		uint32_t active;
+		memcpy(&active, c->data + IO_DATA_ACTIVE, sizeof(active));
+		if (now - active < IO_IDLE_SHRINK_MS)
+			return;
+		if (c->recv.len == 0 && c->recv.size > 0)
+			mg_iobuf_resize(&c->recv, 0);
+		if (c->send.len == 0 && c->send.size > 0)
+			mg_iobuf_resize(&c->send, 0);
+	}
+}
+
+/***
+ * Print pool occupancy, failures and peak memory per connection role as a JSON object, for use with %M
+ */
+size_t pool_print_stats(void (*out)(char, void *), void *arg, va_list *ap) {
+	(void) ap;
+	size_t n = mg_xprintf(out, arg, "{%m: [", MG_ESC("pools"));
+	for (s_pool *p = s_pools; p < s_pools + k_pools; p++) {
+		n += mg_xprintf(out, arg, "%s{%m: %d, %m: %d, %m: %d, %m: %d, %m: %lu}", p == s_pools ? "" : ", ",
+			MG_ESC("size"), p->size, MG_ESC("count"), p->count, MG_ESC("in_use"), p->in_use, 
+			MG_ESC("peak"), p->peak, MG_ESC("fallback"), (unsigned long) p->fallback);
+	}
+	n += mg_xprintf(out, arg, "], %m: %lu, %m: %lu, %m: {%m: %lu, %m: %lu, %m: %lu}}", 
+		MG_ESC("heap_allocs"), (unsigned long) s_heap_allocs, MG_ESC("heap_failures"), (unsigned long) s_heap_failures,
+		MG_ESC("peak_per_client"), MG_ESC("request"), (unsigned long) s_role_peak[IO_ROLE_REQUEST],
+		MG_ESC("static"), (unsigned long) s_role_peak[IO_ROLE_STATIC], MG_ESC("stream"), (unsigned long) s_role_peak[IO_ROLE_STREAM]);
+	return n;
+}
@@ -0,0 +1,48 @@
+/*
+ * mem_pool.h
+ *
+ * Fixed size block pools behind Mongoose's mg_calloc / mg_free (MG_ENABLE_CUSTOM_CALLOC)
+ * Connections and I/O buffers come from static pools so the heap does not fragment over time
+ * I/O buffers are sized by connection role and freed when idle
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#ifndef SRC_MEM_POOL_H_
+#define SRC_MEM_POOL_H_
+
+#include <stdarg.h>
+#include "mongoose.h"
+
+// Size classes, tuned to Mongoose allocations - small strings and timers, connection structs with request
+// and API buffers, websocket and event stream buffers, and static file send windows
+// A stream block holds the largest status frame, checked against the status template in main.cpp
+// Counts cover MAX_CONNECTIONS of mixed traffic with no heap fallbacks, see tools/mem_pool_soak
+// Nothing admitted needs more than a send window, larger requests fall back to the heap
+#define POOL_SMALL_SIZE 64
+#define POOL_SMALL_COUNT 32
+#define POOL_CONN_SIZE 512
+#define POOL_CONN_COUNT 32
+#define POOL_STREAM_SIZE 544
+#define POOL_STREAM_COUNT 12
+#define POOL_IO_SIZE MG_IO_SIZE
+#define POOL_IO_COUNT 18
+
+// Buffer growth step for each connection role, a status frame for streams, a full window for static files
+#define IO_ALIGN_REQUEST 512 // New connections, until the request is known
+#define IO_ALIGN_STREAM POOL_STREAM_SIZE
+#define IO_ALIGN_STATIC MG_IO_SIZE
+#define IO_IDLE_SHRINK_MS 2000 // Empty buffers are freed after this long without traffic
+
+enum io_role {
+	IO_ROLE_REQUEST,
+	IO_ROLE_STATIC,
+	IO_ROLE_STREAM,
+	IO_ROLES
+};
+
+void io_buffers_role(struct mg_connection *c, io_role role);
+void io_buffers_event(struct mg_connection *c, int ev);
+size_t pool_print_stats(void (*out)(char, void *), void *arg, va_list *ap);
+
+#endif /* SRC_MEM_POOL_H_ */
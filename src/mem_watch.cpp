@@ -0,0 +1,115 @@
+/*
+ * mem_watch.cpp
+ *
+ * Heap and stack high-water telemetry for both cores
+ * Sampling is a word compare up the unused part of each stack and one mallinfo call, cheap enough to leave on
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#include <malloc.h>
+#include <unistd.h>
+#include "mem_watch.h"
+
+#define LOG_MODULE_LEVEL MG_LL_ERROR
+#include "ring_log.h"
+
+#define STACK_PAINT 0x5AFEC0DEu
+
+// Provided by the Pico SDK linker script
+extern "C" {
+extern uint32_t __StackBottom, __StackTop; // Core 0 stack, SCRATCH_Y
+extern uint32_t __StackOneBottom, __StackOneTop; // Core 1 stack, SCRATCH_X
+extern char __end__, __StackLimit; // Heap runs from the end of .bss up to __StackLimit
+}
+
+struct s_stack_watch {
+	uint32_t *bottom;
+	uint32_t *top;
+	uint32_t *low; // Lowest word found overwritten so far, scanning restarts here
+	bool warned;
+};
+
+static s_stack_watch s_stacks[2] = {
+	{&__StackBottom, &__StackTop, &__StackTop, false},
+	{&__StackOneBottom, &__StackOneTop, &__StackOneTop, false},
+};
+
+static struct {
+	uint32_t total;
+	uint32_t free;
+	uint32_t min_free; // Lowest free ever seen
+	uint32_t largest_free; // Space above the top chunk, a lower bound on the largest block
+	bool warned;
+} s_heap;
+
+/***
+ * Paint both stacks with a known pattern so the deepest use can be found later
+ * Call first thing in main() - core 0 is painted up to just below the current frame
+ */
+void mem_watch_paint() {
+	uint32_t here;
+	uint32_t *sp = &here - 16;
+	for (uint32_t *p = s_stacks[0].bottom; p < sp; p++)
+		*p = STACK_PAINT;
+	s_stacks[0].low = sp;
+	// Core 1 is not running, paint all of it
+	for (uint32_t *p = s_stacks[1].bottom; p < s_stacks[1].top; p++)
+		*p = STACK_PAINT;
+	s_heap.total = &__StackLimit - &__end__;
+	s_heap.min_free = s_heap.total;
+	mem_watch_sample();
+}
+
+/***
+ * Bytes of a stack that have never been used
+ */
+static uint32_t stack_headroom(s_stack_watch *s) {
+	// Only the still painted region below the previous low mark needs checking
+	uint32_t *p = s->bottom;
+	while (p < s->low && *p == STACK_PAINT)
+		p++;
+	s->low = p;
+	return (p - s->bottom) * sizeof(uint32_t);
+}
+
+/***
+ * Update the stack high-water marks and heap statistics, logging when a threshold is crossed
+ */
+void mem_watch_sample() {
+	for (int core = 0; core < 2; core++) {
+		s_stack_watch *s = &s_stacks[core];
+		uint32_t headroom = stack_headroom(s);
+		if (headroom < STACK_HEADROOM_WARN && !s->warned) {
+			RLOG_ERROR("Core %d stack headroom down to %lu bytes", core, headroom);
+			s->warned = true;
+		}
+	}
+
+	struct mallinfo mi = mallinfo();
+	s_heap.free = s_heap.total - mi.uordblks;
+	s_heap.largest_free = (&__StackLimit - (char *) sbrk(0)) + mi.keepcost;
+	if (s_heap.free < s_heap.min_free)
+		s_heap.min_free = s_heap.free;
+	if (s_heap.free < HEAP_FREE_WARN && !s_heap.warned) {
+		RLOG_ERROR("Heap free down to %lu bytes", s_heap.free);
+		s_heap.warned = true;
+	} else if (s_heap.free >= HEAP_FREE_WARN) {
+		s_heap.warned = false;
+	}
+}
+
+/***
+ * Print stack and heap statistics as a JSON object, for use with %M
+ */
+size_t mem_watch_print_stats(void (*out)(char, void *), void *arg, va_list *ap) {
+	(void) ap;
+	mem_watch_sample();
+	s_stack_watch *s0 = &s_stacks[0], *s1 = &s_stacks[1];
+	return mg_xprintf(out, arg, "{%m: [{%m: %lu, %m: %lu}, {%m: %lu, %m: %lu}], %m: {%m: %lu, %m: %lu, %m: %lu, %m: %lu}}",
+		MG_ESC("stack"),
+		MG_ESC("size"), (unsigned long) ((s0->top - s0->bottom) * sizeof(uint32_t)), MG_ESC("headroom"), (unsigned long) ((s0->low - s0->bottom) * sizeof(uint32_t)),
+		MG_ESC("size"), (unsigned long) ((s1->top - s1->bottom) * sizeof(uint32_t)), MG_ESC("headroom"), (unsigned long) ((s1->low - s1->bottom) * sizeof(uint32_t)),
+		MG_ESC("heap"), MG_ESC("total"), (unsigned long) s_heap.total, MG_ESC("free"), (unsigned long) s_heap.free,
+		MG_ESC("min_free"), (unsigned long) s_heap.min_free, MG_ESC("largest_free"), (unsigned long) s_heap.largest_free);
+}
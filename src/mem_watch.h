@@ -0,0 +1,24 @@
+/*
+ * mem_watch.h
+ *
+ * Heap and stack high-water telemetry for both cores
+ * Stacks are painted at boot and scanned for the deepest overwritten word, the heap is sampled with mallinfo
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#ifndef SRC_MEM_WATCH_H_
+#define SRC_MEM_WATCH_H_
+
+#include <stdarg.h>
+#include "mongoose.h"
+
+#define MEM_WATCH_INTERVAL 10000 // ms between samples
+#define STACK_HEADROOM_WARN 256 // Log when a stack has less than this many bytes never used
+#define HEAP_FREE_WARN 16384 // Log when free heap drops below this
+
+void mem_watch_paint();
+void mem_watch_sample();
+size_t mem_watch_print_stats(void (*out)(char, void *), void *arg, va_list *ap);
+
+#endif /* SRC_MEM_WATCH_H_ */
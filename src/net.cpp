@@ -0,0 +1,224 @@
+/*
+ * net.cpp
+ *
+ * Wi-Fi reconnect state machine
+ * mif_fn passes interface state changes to net_event(), which starts timing an outage and schedules the
+ * next attempt; net_poll() only compares the deadline so no work is done while the link is up.
+ * While the BSSID and channel of the last access point are known, the first attempts join it directly,
+ * which skips the scan of every channel. After NET_FAST_TRIES failures the driver's full scan is used.
+ * The DHCP lease is not cached - Mongoose's DHCP client always starts with DISCOVER and has no way to
+ * request a previous address, so a saved lease could not be reapplied
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#include <cstring>
+#include "pico/cyw43_arch.h"
+#include "pico/rand.h"
+#include "NVSOnboard.h"
+#include "net.h"
+#include "ring_log.h"
+
+// Last access point, saved as the NVS blob "net"
+struct s_net_cache {
+	uint8_t bssid[6];
+	uint8_t channel; // 0 if unknown
+	uint8_t valid;
+};
+
+struct s_net_stats {
+	uint32_t outages;
+	uint32_t fast_tries;
+	uint32_t fast_ok;
+	uint32_t scan_tries;
+	uint32_t scan_ok;
+	uint32_t failures;
+	uint32_t last_online_ms; // Time from losing the link to READY, for the last outage
+	uint32_t max_online_ms;
+};
+
+static s_net_cache s_cache;
+static s_net_stats s_stats;
+static uint8_t s_backoff = 0; // Failed attempts since the link was last READY
+static bool s_online = false;
+static bool s_attempt_fast = false;
+static uint64_t s_down_ms = 0; // Uptime when the outage started
+static uint64_t s_next_attempt = 0; // Uptime of the next attempt, 0 if none scheduled
+static uint64_t s_deadline = 0; // Uptime when the attempt in progress fails, 0 if none
+
+/***
+ * Schedule the next attempt, the delay doubles with each failure and the second half is random
+ * so devices that lost the same access point do not retry in step
+ */
+static void net_schedule() {
+	uint32_t delay = NET_BACKOFF_MIN_MS << MG_MIN(s_backoff, 7);
+	if (delay > NET_BACKOFF_MAX_MS)
+		delay = NET_BACKOFF_MAX_MS;
+	delay = delay / 2 + get_rand_32() % (delay / 2 + 1);
+	s_next_attempt = mg_millis() + delay;
+	s_deadline = 0;
+	RLOG_DEBUG("Reconnect in %lu ms", delay);
+}
+
+/***
+ * Count a failed attempt and back off
+ */
+static void net_fail() {
+	s_stats.failures++;
+	if (s_backoff < 255)
+		s_backoff++;
+	net_schedule();
+}
+
+/***
+ * Save the access point once READY, flash is only written when it changed
+ */
+static void net_cache_save() {
+	s_net_cache c;
+	memset(&c, 0, sizeof(c));
+	if (cyw43_wifi_get_bssid(&cyw43_state, c.bssid) != 0)
+		return;
+	// WLC_GET_CHANNEL returns three little endian words, the first is the channel in use
+	uint8_t info[12] = {0};
+	if (cyw43_ioctl(&cyw43_state, CYW43_IOCTL_GET_CHANNEL, sizeof(info), info, CYW43_ITF_STA) == 0 && info[0] <= 165)
+		c.channel = info[0];
+	c.valid = 1;
+	if (memcmp(&c, &s_cache, sizeof(c)) == 0)
+		return;
+	s_cache = c;
+	NVSOnboard *nvs = NVSOnboard::getInstance();
+	nvs->set_blob("net", &s_cache, sizeof(s_cache));
+	nvs->commit();
+	RLOG_INFO("Saved access point, channel %u", c.channel);
+}
+
+/***
+ * Start a reconnect, directly to the cached access point while fast tries remain
+ * @param ifp interface
+ */
+static void net_attempt(struct mg_tcpip_if *ifp) {
+	struct mg_wifi_data *wifi = &((struct mg_tcpip_driver_pico_w_data *) ifp->driver_data)->wifi;
+	s_next_attempt = 0;
+	s_deadline = mg_millis() + NET_ATTEMPT_MS;
+	s_attempt_fast = s_cache.valid && s_backoff < NET_FAST_TRIES;
+	bool ok;
+	if (s_attempt_fast) {
+		s_stats.fast_tries++;
+		size_t pass_len = strlen(wifi->pass);
+		ok = cyw43_wifi_join(&cyw43_state, strlen(wifi->ssid), (const uint8_t *) wifi->ssid, pass_len, (const uint8_t *) wifi->pass,
+			pass_len ? CYW43_AUTH_WPA2_AES_PSK : CYW43_AUTH_OPEN, s_cache.bssid, s_cache.channel ? s_cache.channel : CYW43_CHANNEL_NONE) == 0;
+	} else {
+		s_stats.scan_tries++;
+		ok = mg_wifi_connect(wifi);
+	}
+	RLOG_INFO("Reconnecting (%s): %d", s_attempt_fast ? "direct" : "scan", ok);
+	if (!ok)
+		net_fail();
+}
+
+/***
+ * Load the cached access point, and treat the driver's own join at start up as an attempt in progress
+ * @param ifp interface
+ */
+void net_init(struct mg_tcpip_if *ifp) {
+	(void) ifp;
+	NVSOnboard *nvs = NVSOnboard::getInstance();
+	size_t len = sizeof(s_cache);
+	if (!nvs->contains("net") || nvs->get_blob("net", &s_cache, &len) != NVS_OK || len != sizeof(s_cache))
+		memset(&s_cache, 0, sizeof(s_cache));
+	s_deadline = mg_millis() + NET_ATTEMPT_MS;
+}
+
+/***
+ * Interface events from mif_fn
+ * @param ifp interface
+ * @param ev MG_TCPIP_EV_ event
+ * @param ev_data event data, the new state for MG_TCPIP_EV_ST_CHG
+ */
+void net_event(struct mg_tcpip_if *ifp, int ev, void *ev_data) {
+	if (ev == MG_TCPIP_EV_WIFI_CONNECT_ERR) {
+		RLOG_INFO("Wi-Fi connect error");
+		if (s_deadline)
+			net_fail();
+		return;
+	}
+	if (ev != MG_TCPIP_EV_ST_CHG)
+		return;
+	uint8_t state = *(uint8_t *) ev_data;
+	uint64_t now = mg_millis();
+	if (state == MG_TCPIP_STATE_READY) {
+		if (s_down_ms) {
+			s_stats.last_online_ms = (uint32_t) (now - s_down_ms);
+			if (s_stats.last_online_ms > s_stats.max_online_ms)
+				s_stats.max_online_ms = s_stats.last_online_ms;
+			if (s_deadline && s_attempt_fast)
+				s_stats.fast_ok++;
+			else if (s_deadline)
+				s_stats.scan_ok++;
+			RLOG_INFO("Online %lu ms after outage", s_stats.last_online_ms);
+		}
+		s_online = true;
+		s_down_ms = 0;
+		s_backoff = 0;
+		s_next_attempt = 0;
+		s_deadline = 0;
+		s_attempt_fast = false;
+		net_cache_save();
+		return;
+	}
+	if (s_online) {
+		s_online = false;
+		s_down_ms = now;
+		s_stats.outages++;
+	}
+	if (state == MG_TCPIP_STATE_DOWN) {
+		// The link dropped, or an attempt that had associated lost it again
+		if (s_deadline)
+			net_fail();
+		else if (!s_next_attempt)
+			net_schedule();
+	} else if (!s_deadline) {
+		// Associated without an attempt of ours, DHCP still has to finish in time
+		s_next_attempt = 0;
+		s_deadline = now + NET_ATTEMPT_MS;
+	}
+}
+
+/***
+ * Check the deadlines, called every NET_CHECK_MS
+ * An attempt stuck before READY, such as in DHCP REQUESTING, is forced DOWN and counts as a failure
+ * @param ifp interface
+ */
+void net_poll(struct mg_tcpip_if *ifp) {
+	if (ifp->state == MG_TCPIP_STATE_READY)
+		return;
+	uint64_t now = mg_millis();
+	if (s_deadline && now >= s_deadline) {
+		RLOG_INFO("Reconnect timed out in state %u", ifp->state);
+		// mg_tcpip_poll moves a DOWN interface with a live link back to UP, restarting DHCP
+		ifp->state = MG_TCPIP_STATE_DOWN;
+		net_fail();
+	} else if (s_next_attempt && now >= s_next_attempt) {
+		if (ifp->state == MG_TCPIP_STATE_DOWN)
+			net_attempt(ifp);
+		else
+			s_next_attempt = 0;
+	}
+}
+
+/***
+ * Print reconnect counters and the cached access point, as a JSON object for get_stats
+ */
+size_t net_print_stats(void (*out)(char, void *), void *arg, va_list *ap) {
+	(void) ap;
+	size_t n = mg_xprintf(out, arg, "{%m: %lu, %m: %lu, %m: %lu, %m: %lu, %m: %lu, %m: %lu, %m: %lu, %m: %lu, %m: %u, ",
+		MG_ESC("outages"), (unsigned long) s_stats.outages, MG_ESC("fast_tries"), (unsigned long) s_stats.fast_tries,
+		MG_ESC("fast_ok"), (unsigned long) s_stats.fast_ok, MG_ESC("scan_tries"), (unsigned long) s_stats.scan_tries,
+		MG_ESC("scan_ok"), (unsigned long) s_stats.scan_ok, MG_ESC("failures"), (unsigned long) s_stats.failures,
+		MG_ESC("last_online_ms"), (unsigned long) s_stats.last_online_ms, MG_ESC("max_online_ms"), (unsigned long) s_stats.max_online_ms,
+		MG_ESC("backoff"), s_backoff);
+	if (!s_cache.valid)
+		return n + mg_xprintf(out, arg, "%m: null}", MG_ESC("cached"));
+	return n + mg_xprintf(out, arg, "%m: {%m: \"%M\", %m: %u}}", MG_ESC("cached"),
+		MG_ESC("bssid"), mg_print_mac, s_cache.bssid, MG_ESC("channel"), s_cache.channel);
+}
@@ -0,0 +1,28 @@
+/*
+ * net.h
+ *
+ * Wi-Fi reconnect, driven by interface state changes with jittered exponential backoff
+ * The last access point is kept in NVS so a reconnect can join directly
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#ifndef SRC_NET_H_
+#define SRC_NET_H_
+
+#include <stdarg.h>
+#include "pico/stdlib.h"
+#include "mongoose.h"
+
+#define NET_CHECK_MS 250 // Period of net_poll(), only deadlines are compared so it is cheap
+#define NET_BACKOFF_MIN_MS 500 // Delay before the first reconnect attempt after losing the link
+#define NET_BACKOFF_MAX_MS 60000 // Longest delay between attempts
+#define NET_ATTEMPT_MS 15000 // Time an attempt has to reach READY before it counts as failed
+#define NET_FAST_TRIES 2 // Directed joins to the cached access point before falling back to a full scan
+
+void net_init(struct mg_tcpip_if *ifp);
+void net_event(struct mg_tcpip_if *ifp, int ev, void *ev_data);
+void net_poll(struct mg_tcpip_if *ifp);
+size_t net_print_stats(void (*out)(char, void *), void *arg, va_list *ap);
+
+#endif /* SRC_NET_H_ */
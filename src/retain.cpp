@@ -0,0 +1,107 @@
+/*
+ * retain.cpp
+ *
+ * Runtime state kept in RAM that is not cleared by a reset
+ * The block is rewritten with a new CRC at the end of every one second tick, after a power cut or a
+ * reset part way through an update the CRC does not match and the normal flash path is used
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#include <string.h>
+#include "hardware/rtc.h"
+#include "energy.h"
+#include "history.h"
+#include "holiday.h"
+#include "retain.h"
+#include "ring_log.h"
+#include "rollup.h"
+
+struct s_retain_block {
+	uint32_t magic;
+	uint32_t crc; // Over everything after this field
+	uint32_t warm_resets;
+	uint32_t epoch; // Time at the last save
+	uint8_t status[RETAIN_STATUS_MAX];
+	s_retain_settings settings;
+	s_energy_state energy;
+	s_history_state history;
+	s_rollup_state rollup;
+	s_holiday_table holiday;
+};
+
+// A different build may lay the block out differently, so the magic changes with every build
+static constexpr uint32_t k_magic = 0x52544E00u ^ rlog_hash(__DATE__ " " __TIME__) ^ (uint32_t) sizeof(s_retain_block);
+
+static s_retain_block __uninitialized_ram(s_retained);
+static bool s_resumed = false;
+static uint32_t s_resumed_warm_resets = 0;
+static uint32_t s_resume_us = 0;
+
+static uint32_t retain_crc() {
+	const char *p = (const char *) &s_retained + offsetof(s_retain_block, warm_resets);
+	return mg_crc32(0, p, sizeof(s_retain_block) - offsetof(s_retain_block, warm_resets));
+}
+
+/***
+ * Restore state kept across a warm reset, call after rtc_init() and instead of reading settings from flash
+ * Sets the RTC and takes back the status, settings, energy counters, history writer, rollups and holidays
+ * @param status main's status struct
+ * @param len its size
+ * @param settings set to main's other settings
+ * @return true if the retained block was valid, false after a power on or if it was damaged
+ */
+bool retain_resume(void *status, size_t len, s_retain_settings *settings) {
+	uint32_t start = time_us_32();
+	if (s_retained.magic != k_magic || s_retained.crc != retain_crc() || len > RETAIN_STATUS_MAX) {
+		memset(&s_retained, 0, sizeof(s_retained));
+		return false;
+	}
+	datetime_t dt;
+	if (time_to_datetime(s_retained.epoch, &dt))
+		rtc_set_datetime(&dt);
+	memcpy(status, s_retained.status, len);
+	*settings = s_retained.settings;
+	energy_resume(&s_retained.energy);
+	history_resume(&s_retained.history);
+	rollup_resume(&s_retained.rollup);
+	holiday_resume(&s_retained.holiday);
+	// Counted into the block, so it must be sealed again or the next reset before a save finds it damaged
+	s_retained.warm_resets++;
+	s_retained.crc = retain_crc();
+	s_resumed = true;
+	s_resumed_warm_resets = s_retained.warm_resets;
+	s_resume_us = time_us_32() - start;
+	RLOG_INFO("Resumed from retained RAM in %lu us, warm reset %lu", s_resume_us, s_retained.warm_resets);
+	return true;
+}
+
+/***
+ * Copy the current state into the retained block, called at the end of the one second tick
+ * @param status main's status struct
+ * @param len its size
+ * @param settings main's other settings
+ * @param utc current time, seconds from epoch
+ */
+void retain_save(const void *status, size_t len, const s_retain_settings *settings, uint32_t utc) {
+	s_retained.magic = 0; // Invalid while it is being written
+	s_retained.epoch = utc;
+	memcpy(s_retained.status, status, MG_MIN(len, sizeof(s_retained.status)));
+	s_retained.settings = *settings;
+	energy_retain(&s_retained.energy);
+	history_retain(&s_retained.history);
+	rollup_retain(&s_retained.rollup);
+	holiday_retain(&s_retained.holiday);
+	s_retained.crc = retain_crc();
+	s_retained.magic = k_magic;
+}
+
+/***
+ * Print whether this boot resumed from retained RAM, as a JSON object for get_boot
+ */
+size_t retain_print_stats(void (*out)(char, void *), void *arg, va_list *ap) {
+	(void) ap;
+	return mg_xprintf(out, arg, "{%m: %d, %m: %lu, %m: %lu, %m: %lu}", MG_ESC("resumed"), s_resumed,
+		MG_ESC("warm_resets"), (unsigned long) s_resumed_warm_resets, MG_ESC("resume_us"), (unsigned long) s_resume_us,
+		MG_ESC("bytes"), (unsigned long) sizeof(s_retain_block));
+}
@@ -0,0 +1,34 @@
+/*
+ * retain.h
+ *
+ * Runtime state kept in RAM that is not cleared by a reset, so a watchdog or software reset
+ * resumes without reading back from flash
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#ifndef SRC_RETAIN_H_
+#define SRC_RETAIN_H_
+
+#include <stdarg.h>
+#include "pico/stdlib.h"
+#include "pico/util/datetime.h"
+#include "mongoose.h"
+#include "tz.h"
+
+#define RETAIN_STATUS_MAX 64 // Room for main's status struct
+#define WATCHDOG_MS 8000 // Longest time the main loop may go without polling before a reset
+
+// Settings main reads from flash that are not in its status struct
+struct s_retain_settings {
+	uint16_t boost_timer;
+	uint16_t boost_timer_add;
+	uint16_t element_watts;
+	char tz[TZ_MAX_LEN];
+};
+
+bool retain_resume(void *status, size_t len, s_retain_settings *settings);
+void retain_save(const void *status, size_t len, const s_retain_settings *settings, uint32_t utc);
+size_t retain_print_stats(void (*out)(char, void *), void *arg, va_list *ap);
+
+#endif /* SRC_RETAIN_H_ */
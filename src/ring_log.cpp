@@ -0,0 +1,212 @@
+/*
+ * ring_log.cpp
+ *
+ * Non-blocking logger, records a format string pointer, timestamp and raw arguments into a RAM ring
+ * There is a single writer, the Mongoose event loop on core 0, and each reader keeps its own sequence
+ * number, so nothing is locked and a slow reader only loses the entries it was lapped on
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#include <cstdio>
+#include "ring_log.h"
+
+static_assert((RING_LOG_ENTRIES & (RING_LOG_ENTRIES - 1)) == 0, "RING_LOG_ENTRIES must be a power of 2");
+
+static s_log_entry s_ring[RING_LOG_ENTRIES];
+static volatile uint32_t s_head = 0; // Sequence number of the next entry written
+static uint32_t s_usb_seq = 0; // Next entry for USB
+
+#define LOG_HTTP_SEQ 4 // Offset in c->data of a /logs stream's next sequence number
+#define LOG_HTTP_MAX_SEND 1024 // Stop formatting while this much is waiting to go out
+
+/***
+ * Write an entry to the ring, overwriting the oldest
+ * @param level log level
+ * @param fmt format string pointer, or its token
+ * @param a arguments and captured text
+ */
+void ring_log_write(uint8_t level, uintptr_t fmt, const s_log_args &a) {
+	uint32_t seq = s_head;
+	s_log_entry *e = &s_ring[seq & (RING_LOG_ENTRIES - 1)];
+	e->time_us = time_us_64();
+	e->fmt = fmt;
+	e->level = level;
+	e->nargs = a.n;
+	memcpy(e->args, a.args, a.n * sizeof(uint32_t));
+	e->text_len = a.text_len;
+	memcpy(e->text, a.text, a.text_len);
+	__dmb(); // Entry complete before it is published
+	s_head = seq + 1;
+}
+
+/***
+ * Fetch the entry for a reader's sequence number, skipping forward if the writer has lapped it
+ * @param seq reader's next sequence number, advanced past the entry returned
+ * @param e copy of the entry
+ * @param dropped set to the number of entries skipped
+ * @return false if there is nothing new
+ */
+static bool ring_log_read(uint32_t *seq, s_log_entry *e, uint32_t *dropped) {
+	*dropped = 0;
+	for (;;) {
+		uint32_t head = s_head;
+		if (*seq == head)
+			return false;
+		if (head - *seq > RING_LOG_ENTRIES) {
+			*dropped += head - *seq - RING_LOG_ENTRIES;
+			*seq = head - RING_LOG_ENTRIES;
+		}
+		*e = s_ring[*seq & (RING_LOG_ENTRIES - 1)];
+		__dmb();
+		// Keep the copy unless the writer came round and overwrote it meanwhile
+		if (s_head - *seq <= RING_LOG_ENTRIES)
+			break;
+	}
+	(*seq)++;
+	return true;
+}
+
+#if LOG_TOKENIZED
+/***
+ * Append an unsigned LEB128 varint
+ */
+static size_t put_varint(uint8_t *p, uint32_t v) {
+	size_t n = 0;
+	while (v >= 0x80) {
+		p[n++] = (uint8_t) (v | 0x80);
+		v >>= 7;
+	}
+	p[n++] = (uint8_t) v;
+	return n;
+}
+
+/***
+ * Encode an entry as a line of text, $ followed by the base64 of a binary frame:
+ * token (4 bytes little endian), time in ms, level, argument count, arguments, text length (varints) then text
+ * @return length written, excluding the terminator
+ */
+static size_t ring_log_format(const s_log_entry *e, char *buf, size_t len) {
+	static const char k_b64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	uint8_t frame[4 + 5 * (RING_LOG_ARGS + 4) + RING_LOG_TEXT];
+	size_t n = 0;
+	uint32_t token = (uint32_t) e->fmt;
+	for (int i = 0; i < 4; i++)
+		frame[n++] = (uint8_t) (token >> (8 * i));
+	n += put_varint(frame + n, (uint32_t) (e->time_us / 1000));
+	n += put_varint(frame + n, e->level);
+	n += put_varint(frame + n, e->nargs);
+	for (int i = 0; i < e->nargs; i++)
+		n += put_varint(frame + n, e->args[i]);
+	n += put_varint(frame + n, e->text_len);
+	memcpy(frame + n, e->text, e->text_len);
+	n += e->text_len;
+
+	size_t out = 0;
+	buf[out++] = '$';
+	for (size_t i = 0; i < n && out + 5 < len; i += 3) {
+		uint32_t v = frame[i] << 16 | (i + 1 < n ? frame[i + 1] << 8 : 0) | (i + 2 < n ? frame[i + 2] : 0);
+		buf[out++] = k_b64[(v >> 18) & 63];
+		buf[out++] = k_b64[(v >> 12) & 63];
+		buf[out++] = i + 1 < n ? k_b64[(v >> 6) & 63] : '=';
+		buf[out++] = i + 2 < n ? k_b64[v & 63] : '=';
+	}
+	buf[out] = 0;
+	return out;
+}
+#else
+/***
+ * Format an entry as a line of text
+ * @return length written, excluding the terminator
+ */
+static size_t ring_log_format(const s_log_entry *e, char *buf, size_t len) {
+	static const char k_levels[] = "-EIDV";
+	uint32_t ms = (uint32_t) (e->time_us / 1000);
+	size_t n = mg_snprintf(buf, len, "%lu.%03lu %c ", (unsigned long) (ms / 1000), (unsigned long) (ms % 1000), 
+		k_levels[e->level < 5 ? e->level : 0]);
+	int arg = 0;
+	for (const char *f = (const char *) e->fmt; *f != 0 && n + 1 < len; f++) {
+		if (*f != '%') {
+			buf[n++] = *f;
+			continue;
+		}
+		// Zero flag and width are kept, length modifiers are not needed as every argument is 32 bits
+		char spec[8] = "%";
+		int s = 1;
+		f++;
+		for (; (*f >= '0' && *f <= '9') || *f == 'l'; f++)
+			if (*f != 'l' && s < 4) spec[s++] = *f;
+		if (*f == 0)
+			break;
+		if (*f == '%') {
+			buf[n++] = '%';
+		} else if (*f == 's') {
+			n += mg_snprintf(buf + n, len - n, "%.*s", (int) e->text_len, e->text);
+		} else if (arg < RING_LOG_ARGS) {
+			uint32_t v = e->args[arg++];
+			if (*f == 'c') {
+				buf[n++] = (char) v;
+			} else {
+				// Always format as long, so the stored 32 bits print the same on any host
+				spec[s++] = 'l';
+				spec[s++] = (*f == 'i') ? 'd' : *f;
+				spec[s] = 0;
+				if (*f == 'd' || *f == 'i')
+					n += mg_snprintf(buf + n, len - n, spec, (long) (int32_t) v);
+				else
+					n += mg_snprintf(buf + n, len - n, spec, (unsigned long) v);
+			}
+		}
+		if (n >= len) n = len - 1;
+	}
+	buf[n] = 0;
+	return n;
+}
+#endif
+
+/***
+ * Write pending entries to USB stdio, a few at a time so the event loop is never held up
+ */
+void ring_log_drain_usb() {
+	s_log_entry e;
+	uint32_t dropped;
+	char line[128];
+	for (int i = 0; i < RING_LOG_DRAIN_MAX && ring_log_read(&s_usb_seq, &e, &dropped); i++) {
+		if (dropped)
+			printf("... %lu log entries dropped\n", (unsigned long) dropped);
+		ring_log_format(&e, line, sizeof(line));
+		puts(line);
+	}
+}
+
+/***
+ * Start streaming the log over HTTP as chunked plain text, from the oldest entry still held
+ * @param c connection
+ */
+void ring_log_http_start(struct mg_connection *c) {
+	mg_printf(c, "HTTP/1.1 200 OK\r\nContent-Type: text/plain\r\nCache-Control: no-cache\r\nTransfer-Encoding: chunked\r\n\r\n");
+	uint32_t head = s_head;
+	uint32_t seq = head > RING_LOG_ENTRIES ? head - RING_LOG_ENTRIES : 0;
+	memcpy(c->data + LOG_HTTP_SEQ, &seq, sizeof(seq));
+	// The response never completes, so is_resp stays set and no further requests are read
+	c->data[0] = 'G';
+}
+
+/***
+ * Send new entries on a /logs stream while there is room in the send buffer
+ * @param c connection started with ring_log_http_start()
+ */
+void ring_log_http_poll(struct mg_connection *c) {
+	uint32_t seq, dropped;
+	s_log_entry e;
+	char line[128];
+	memcpy(&seq, c->data + LOG_HTTP_SEQ, sizeof(seq));
+	while (c->send.len < LOG_HTTP_MAX_SEND && ring_log_read(&seq, &e, &dropped)) {
+		if (dropped)
+			mg_http_printf_chunk(c, "... %lu log entries dropped\n", (unsigned long) dropped);
+		size_t n = ring_log_format(&e, line, sizeof(line) - 1);
+		line[n++] = '\n';
+		mg_http_write_chunk(c, line, n);
+	}
+	memcpy(c->data + LOG_HTTP_SEQ, &seq, sizeof(seq));
+}
@@ -0,0 +1,126 @@
+/*
+ * ring_log.h
+ *
+ * Non-blocking logger, records a format string pointer, timestamp and raw arguments into a RAM ring
+ * Text is only formatted when a consumer drains the ring, to USB stdio or the /logs stream
+ * Levels are filtered at compile time per module, and with LOG_TOKENIZED the format strings are replaced
+ * by hashes, decoded on the host with tools/log_decode.py and the dictionary generated by the build
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#ifndef SRC_RING_LOG_H_
+#define SRC_RING_LOG_H_
+
+#include <type_traits>
+#include "mongoose.h"
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL MG_LL_INFO // Most verbose level compiled in, also applied to Mongoose's own logging
+#endif
+// A module can define its own level before including this header
+#ifndef LOG_MODULE_LEVEL
+#define LOG_MODULE_LEVEL LOG_LEVEL
+#endif
+
+#define RING_LOG_ENTRIES 64 // Must be a power of 2
+#define RING_LOG_ARGS 6
+#define RING_LOG_TEXT 13 // Characters kept from a %s argument
+#define RING_LOG_DRAIN_MS 20 // USB drain period
+#define RING_LOG_DRAIN_MAX 8 // Entries written to USB per drain
+
+/***
+ * FNV-1a hash of a format string, the token that replaces it in tokenised builds
+ * tools/log_dictionary.py computes the same hash from the sources
+ */
+constexpr uint32_t rlog_hash(const char *s) {
+	uint32_t h = 2166136261u;
+	while (*s)
+		h = (h ^ (uint8_t) *s++) * 16777619u;
+	return h;
+}
+
+/***
+ * Number of %s conversions in a format string, skipping %% and any 0 flag and width
+ */
+constexpr int rlog_strings(const char *s) {
+	int n = 0;
+	while (*s) {
+		if (*s++ != '%')
+			continue;
+		while (*s >= '0' && *s <= '9')
+			s++;
+		if (*s == 's')
+			n++;
+		if (*s)
+			s++;
+	}
+	return n;
+}
+
+#if LOG_TOKENIZED
+// Only the compile time hash is kept, so the string itself is never placed in flash
+#define RLOG_FMT(fmt) ((uintptr_t) std::integral_constant<uint32_t, rlog_hash(fmt)>::value)
+#else
+#define RLOG_FMT(fmt) ((uintptr_t) (fmt))
+#endif
+
+// Format strings must be a single literal, and support %d %i %u %x %X %c %s and %%, with optional 0 flag and width
+// Arguments are stored as 32 bits, and at most one %s whose text is copied when logging
+// Calls above the module's level compile to nothing, arguments included
+#define RLOG_AT(level, fmt, ...) do { static_assert(rlog_strings(fmt) <= 1, "Log formats may hold at most one %s"); if constexpr ((level) <= LOG_MODULE_LEVEL) rlog((level), RLOG_FMT(fmt) __VA_OPT__(,) __VA_ARGS__); } while (0)
+#define RLOG_ERROR(fmt, ...) RLOG_AT(MG_LL_ERROR, fmt __VA_OPT__(,) __VA_ARGS__)
+#define RLOG_INFO(fmt, ...) RLOG_AT(MG_LL_INFO, fmt __VA_OPT__(,) __VA_ARGS__)
+#define RLOG_DEBUG(fmt, ...) RLOG_AT(MG_LL_DEBUG, fmt __VA_OPT__(,) __VA_ARGS__)
+
+struct s_log_entry {
+	uint64_t time_us;
+	uintptr_t fmt; // Format string pointer, or its token when tokenised
+	uint32_t args[RING_LOG_ARGS];
+	uint8_t level;
+	uint8_t nargs;
+	uint8_t text_len;
+	char text[RING_LOG_TEXT];
+};
+
+// Arguments collected by rlog() before writing an entry
+struct s_log_args {
+	uint32_t args[RING_LOG_ARGS];
+	uint8_t n = 0;
+	uint8_t text_len = 0;
+	const char *text = NULL;
+};
+
+void ring_log_write(uint8_t level, uintptr_t fmt, const s_log_args &a);
+void ring_log_drain_usb();
+void ring_log_http_start(struct mg_connection *c);
+void ring_log_http_poll(struct mg_connection *c);
+
+inline void rlog_put(s_log_args &a, const char *s) {
+	a.text = s;
+	a.text_len = s == NULL ? 0 : strnlen(s, RING_LOG_TEXT);
+}
+inline void rlog_put(s_log_args &a, struct mg_str s) {
+	a.text = s.buf;
+	a.text_len = MG_MIN(s.len, (size_t) RING_LOG_TEXT);
+}
+template <typename T>
+inline void rlog_put(s_log_args &a, T v) {
+	static_assert(std::is_integral_v<T> || std::is_enum_v<T>, "Log arguments must be integers or one string");
+	a.args[a.n++] = (uint32_t) v;
+}
+
+/***
+ * Record a log entry, no formatting is done here - use the RLOG_ macros rather than calling directly
+ * @param level MG_LL_ERROR, MG_LL_INFO or MG_LL_DEBUG
+ * @param fmt format string literal pointer, or its token
+ */
+template <typename... Args>
+inline void rlog(uint8_t level, uintptr_t fmt, Args... args) {
+	static_assert(sizeof...(args) <= RING_LOG_ARGS, "Too many log arguments");
+	s_log_args a;
+	(rlog_put(a, args), ...);
+	ring_log_write(level, fmt, a);
+}
+
+#endif /* SRC_RING_LOG_H_ */
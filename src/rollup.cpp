@@ -0,0 +1,236 @@
+/*
+ * rollup.cpp
+ *
+ * Hourly, daily and weekly totals of heating on-time
+ * Each level is a ring indexed by hour, day or week number, moved on as newer samples arrive
+ * Sums use whole weeks where they can, then days, so a year is under 70 bucket reads
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#include <string.h>
+#include "energy.h"
+#include "history.h"
+#include "rollup.h"
+#include "ring_log.h"
+
+struct s_rollup_level {
+	s_rollup_bucket *b;
+	uint16_t size;
+	bool used;
+	uint32_t head; // Newest index seen
+};
+
+static s_rollup_bucket s_hours[ROLLUP_HOURS];
+static s_rollup_bucket s_days[ROLLUP_DAYS];
+static s_rollup_bucket s_weeks[ROLLUP_WEEKS];
+static s_rollup_level s_levels[3] = {
+	{s_hours, ROLLUP_HOURS, false, 0},
+	{s_days, ROLLUP_DAYS, false, 0},
+	{s_weeks, ROLLUP_WEEKS, false, 0},
+};
+static const s_rollup_bucket k_empty = {0, 0};
+static bool s_last_on = false;
+
+// Week number, 2000-01-03 was the first Monday
+static inline uint32_t week_of(uint32_t day) {
+	return (day + 5) / 7;
+}
+
+// First day of a week, can be before day 0 for week 0
+static inline int32_t week_start(uint32_t week) {
+	return (int32_t) week * 7 - 5;
+}
+
+/***
+ * Add to a bucket, moving the ring on and clearing the buckets passed over when the index is newer than the head
+ * Indexes older than the ring holds are dropped
+ */
+static void level_add(s_rollup_level *l, uint32_t idx, uint16_t on_min, uint16_t cycles) {
+	if (!l->used || idx > l->head) {
+		uint32_t clear = !l->used || idx - l->head >= l->size ? l->size : idx - l->head;
+		for (uint32_t i = 0; i < clear; i++)
+			l->b[(idx - i) % l->size] = k_empty;
+		l->head = idx;
+		l->used = true;
+	} else if (l->head - idx >= l->size) {
+		return;
+	}
+	s_rollup_bucket *b = &l->b[idx % l->size];
+	b->on_min += on_min;
+	b->cycles += cycles;
+}
+
+/***
+ * Read a bucket, indexes after the head are empty
+ * @return NULL when the index is older than the ring holds
+ */
+static const s_rollup_bucket *level_get(const s_rollup_level *l, uint32_t idx) {
+	if (!l->used || idx > l->head)
+		return &k_empty;
+	if (l->head - idx >= l->size)
+		return NULL;
+	return &l->b[idx % l->size];
+}
+
+/***
+ * Add minutes in one state, within one day
+ * Called for each new minute from history_tick() and for each stored run at boot
+ * @param day days since 2000-01-01
+ * @param minute first minute of the day
+ * @param minutes count
+ * @param on relay was on
+ */
+void rollup_add(uint16_t day, uint16_t minute, uint16_t minutes, bool on) {
+	uint16_t cycles = on && !s_last_on;
+	s_last_on = on;
+	uint16_t total = on ? minutes : 0;
+	level_add(&s_levels[ROLLUP_DAY], day, total, cycles);
+	level_add(&s_levels[ROLLUP_WEEK], week_of(day), total, cycles);
+	// Runs are split at hour boundaries, the cycle is counted in the hour it started
+	uint32_t m = minute;
+	uint32_t end = minute + minutes;
+	while (m < end) {
+		uint32_t n = MG_MIN(end - m, 60 - m % 60);
+		level_add(&s_levels[ROLLUP_HOUR], (uint32_t) day * 24 + m / 60, on ? n : 0, cycles);
+		cycles = 0;
+		m += n;
+	}
+}
+
+/***
+ * Rebuild all levels from the runs stored in flash, after history_init()
+ */
+void rollup_rebuild() {
+	uint32_t start = time_us_32();
+	uint32_t runs = 0;
+	s_history_cursor cur;
+	s_history_run run;
+	history_cursor_start(&cur);
+	while (history_next(&cur, &run)) {
+		rollup_add(run.day, run.start, run.minutes, HISTORY_IS_ON(run.state));
+		runs++;
+	}
+	RLOG_INFO("Rollups rebuilt from %lu runs in %lu us", runs, time_us_32() - start);
+}
+
+/***
+ * Copy the levels out for retained RAM
+ */
+void rollup_retain(s_rollup_state *st) {
+	memcpy(st->hours, s_hours, sizeof(s_hours));
+	memcpy(st->days, s_days, sizeof(s_days));
+	memcpy(st->weeks, s_weeks, sizeof(s_weeks));
+	for (int i = 0; i < 3; i++) {
+		st->head[i] = s_levels[i].head;
+		st->used[i] = s_levels[i].used;
+	}
+	st->last_on = s_last_on;
+}
+
+/***
+ * Take the levels back from retained RAM after a warm reset, instead of rollup_rebuild()
+ */
+void rollup_resume(const s_rollup_state *st) {
+	memcpy(s_hours, st->hours, sizeof(s_hours));
+	memcpy(s_days, st->days, sizeof(s_days));
+	memcpy(s_weeks, st->weeks, sizeof(s_weeks));
+	for (int i = 0; i < 3; i++) {
+		s_levels[i].head = st->head[i];
+		s_levels[i].used = st->used[i];
+	}
+	s_last_on = st->last_on;
+}
+
+/***
+ * Newest day with a sample
+ * @return day number, 0 when nothing is recorded
+ */
+uint16_t rollup_today() {
+	return s_levels[ROLLUP_DAY].used ? s_levels[ROLLUP_DAY].head : 0;
+}
+
+static inline void bucket_add(s_rollup_total *total, const s_rollup_bucket *b) {
+	total->on_min += b->on_min;
+	total->cycles += b->cycles;
+}
+
+/***
+ * Total a range of days, from the coarsest level that covers each part
+ * Days older than the daily ring are taken from the week that holds them
+ * @param from first day
+ * @param to day after the last
+ * @param total set to the sum
+ * @return false if any part was only available at week resolution
+ */
+bool rollup_sum(uint16_t from, uint16_t to, s_rollup_total *total) {
+	bool exact = true;
+	const s_rollup_bucket *b;
+	*total = {0, 0};
+	uint32_t d = from;
+	while (d < to) {
+		uint32_t w = week_of(d);
+		if (week_start(w) == (int32_t) d && d + 7 <= to && (b = level_get(&s_levels[ROLLUP_WEEK], w)) != NULL) {
+			bucket_add(total, b);
+			d += 7;
+		} else if ((b = level_get(&s_levels[ROLLUP_DAY], d)) != NULL) {
+			bucket_add(total, b);
+			d++;
+		} else {
+			if ((b = level_get(&s_levels[ROLLUP_WEEK], w)) != NULL)
+				bucket_add(total, b);
+			exact = false;
+			d = week_start(w) + 7;
+		}
+	}
+	return exact;
+}
+
+/***
+ * Print a bucket or total as a JSON object, watt-hours use the current element rating
+ */
+static size_t print_bucket(void (*out)(char, void *), void *arg, const char *key, uint32_t idx, uint32_t on_min, uint32_t cycles) {
+	return mg_xprintf(out, arg, "{%m: %lu, %m: %lu, %m: %lu, %m: %lu}", MG_ESC(key), (unsigned long) idx,
+		MG_ESC("on_min"), (unsigned long) on_min, MG_ESC("cycles"), (unsigned long) cycles,
+		MG_ESC("wh"), (unsigned long) ((uint64_t) on_min * element_watts / 60));
+}
+
+/***
+ * Print the totals for a query and, if a step was asked for, the series at that level
+ * Takes a const s_rollup_query * argument, series buckets older than their ring holds are left out
+ */
+size_t rollup_print(void (*out)(char, void *), void *arg, va_list *ap) {
+	static const char *const k_keys[] = {"hour", "day", "week"};
+	const s_rollup_query *q = va_arg(*ap, const s_rollup_query *);
+	s_rollup_total total;
+	bool exact = rollup_sum(q->from, q->to, &total);
+	size_t n = mg_xprintf(out, arg, "{%m: %u, %m: %u, %m: %s, %m: ", MG_ESC("from"), q->from, MG_ESC("to"), q->to,
+		MG_ESC("exact"), exact ? "true" : "false", MG_ESC("total"));
+	n += print_bucket(out, arg, "days", q->to - q->from, total.on_min, total.cycles);
+	if (q->step >= 0) {
+		uint32_t first, last;
+		if (q->step == ROLLUP_HOUR) {
+			first = (uint32_t) q->from * 24;
+			last = (uint32_t) q->to * 24;
+		} else if (q->step == ROLLUP_DAY) {
+			first = q->from;
+			last = q->to;
+		} else {
+			first = week_of(q->from);
+			last = week_of(q->to - 1) + 1;
+		}
+		n += mg_xprintf(out, arg, ", %m: [", MG_ESC("series"));
+		bool sep = false;
+		for (uint32_t i = first; i < last; i++) {
+			const s_rollup_bucket *b = level_get(&s_levels[q->step], i);
+			if (b == NULL)
+				continue;
+			if (sep)
+				n += mg_xprintf(out, arg, ", ");
+			n += print_bucket(out, arg, k_keys[q->step], i, b->on_min, b->cycles);
+			sep = true;
+		}
+		n += mg_xprintf(out, arg, "]");
+	}
+	return n + mg_xprintf(out, arg, "}");
+}
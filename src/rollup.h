@@ -0,0 +1,61 @@
+/*
+ * rollup.h
+ *
+ * Hourly, daily and weekly totals of heating on-time, kept up to date as history samples arrive
+ * so range queries never scan the minute data
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#ifndef SRC_ROLLUP_H_
+#define SRC_ROLLUP_H_
+
+#include <stdarg.h>
+#include "mongoose.h"
+
+#define ROLLUP_HOURS 168 // 7 days
+#define ROLLUP_DAYS 400
+#define ROLLUP_WEEKS 106 // 2 years, weeks start on Monday
+#define ROLLUP_SERIES_MAX 64 // Points returned by one get_history request
+
+#define ROLLUP_HOUR 0
+#define ROLLUP_DAY 1
+#define ROLLUP_WEEK 2
+
+struct s_rollup_bucket {
+	uint16_t on_min; // Minutes the relay was on
+	uint16_t cycles; // Times it switched on
+};
+
+// All levels, kept across warm resets so they are not rebuilt from flash
+struct s_rollup_state {
+	s_rollup_bucket hours[ROLLUP_HOURS];
+	s_rollup_bucket days[ROLLUP_DAYS];
+	s_rollup_bucket weeks[ROLLUP_WEEKS];
+	uint32_t head[3];
+	bool used[3];
+	bool last_on;
+};
+
+// Sum over a range, wider than a bucket
+struct s_rollup_total {
+	uint32_t on_min;
+	uint32_t cycles;
+};
+
+// A get_history request, days are numbered from 2000-01-01 and to is exclusive
+struct s_rollup_query {
+	uint16_t from;
+	uint16_t to;
+	int8_t step; // ROLLUP_ level for the series, -1 for totals only
+};
+
+void rollup_add(uint16_t day, uint16_t minute, uint16_t minutes, bool on);
+void rollup_rebuild();
+void rollup_retain(s_rollup_state *st);
+void rollup_resume(const s_rollup_state *st);
+uint16_t rollup_today();
+bool rollup_sum(uint16_t from, uint16_t to, s_rollup_total *total);
+size_t rollup_print(void (*out)(char, void *), void *arg, va_list *ap);
+
+#endif /* SRC_ROLLUP_H_ */
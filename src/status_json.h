@@ -0,0 +1,143 @@
+/*
+ * status_json.h
+ *
+ * Compile time JSON templates, used so the status is serialised without a runtime printf
+ * Field names and punctuation are fixed when compiling, only integers are converted when writing
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#ifndef SRC_STATUS_JSON_H_
+#define SRC_STATUS_JSON_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Two ASCII digits for each value 0-99, so conversion needs one division per pair of digits
+struct DigitPairs {
+	char d[200];
+	constexpr DigitPairs() : d() {
+		for (int i = 0; i < 100; i++) {
+			d[i * 2] = '0' + i / 10;
+			d[i * 2 + 1] = '0' + i % 10;
+		}
+	}
+};
+inline constexpr DigitPairs k_digit_pairs;
+
+/***
+ * Fast unsigned integer to ASCII, writes into a caller buffer without a terminator
+ * @param buf destination, must have room for 10 characters
+ * @param v value to convert
+ * @return number of characters written
+ */
+inline size_t u32_to_ascii(char *buf, uint32_t v) {
+	char tmp[10];
+	char *p = tmp + sizeof(tmp);
+	while (v >= 100) {
+		uint32_t q = v / 100;
+		const char *d = &k_digit_pairs.d[(v - q * 100) * 2];
+		*--p = d[1];
+		*--p = d[0];
+		v = q;
+	}
+	if (v >= 10) {
+		const char *d = &k_digit_pairs.d[v * 2];
+		*--p = d[1];
+		*--p = d[0];
+	} else {
+		*--p = '0' + v;
+	}
+	size_t len = tmp + sizeof(tmp) - p;
+	memcpy(buf, p, len);
+	return len;
+}
+
+/***
+ * Fast signed integer to ASCII, writes into a caller buffer without a terminator
+ * @param buf destination, must have room for 11 characters
+ * @param v value to convert
+ * @return number of characters written
+ */
+inline size_t i32_to_ascii(char *buf, int32_t v) {
+	if (v >= 0)
+		return u32_to_ascii(buf, v);
+	*buf = '-';
+	return 1 + u32_to_ascii(buf + 1, 0u - (uint32_t) v);
+}
+
+// String literal usable as a template parameter
+template <size_t N>
+struct FixedString {
+	char s[N];
+	constexpr FixedString(const char (&str)[N]) : s() {
+		for (size_t i = 0; i < N; i++)
+			s[i] = str[i];
+	}
+};
+
+/***
+ * JSON template where each # is replaced by an integer
+ * The template is split into literal segments at compile time, so writing is a
+ * memcpy per segment plus one integer conversion per field
+ */
+template <FixedString Tpl>
+class JsonTemplate {
+	static constexpr size_t text_len = sizeof(Tpl.s) - 1;
+
+	static constexpr size_t count_fields() {
+		size_t n = 0;
+		for (size_t i = 0; i < text_len; i++)
+			if (Tpl.s[i] == '#')
+				n++;
+		return n;
+	}
+
+public:
+	// Number of integer fields in the template
+	static constexpr size_t fields = count_fields();
+	// Largest possible output, every field at 11 characters
+	static constexpr size_t max_len = text_len - fields + fields * 11;
+
+	/***
+	 * Write the template with its fields filled in
+	 * @param buf destination, must have room for max_len characters
+	 * @param values one value per field, in template order
+	 * @return number of characters written, no terminator is added
+	 */
+	size_t write(char *buf, const int32_t (&values)[fields]) const {
+		char *p = buf;
+		for (size_t i = 0; i < fields; i++) {
+			memcpy(p, Tpl.s + seg[i].off, seg[i].len);
+			p += seg[i].len;
+			p += i32_to_ascii(p, values[i]);
+		}
+		memcpy(p, Tpl.s + seg[fields].off, seg[fields].len);
+		p += seg[fields].len;
+		return p - buf;
+	}
+
+private:
+	struct Segment {
+		uint16_t off;
+		uint16_t len;
+	};
+	struct Segments {
+		Segment s[fields + 1];
+		constexpr Segments() : s() {
+			size_t n = 0, start = 0;
+			for (size_t i = 0; i < text_len; i++) {
+				if (Tpl.s[i] == '#') {
+					s[n++] = {(uint16_t) start, (uint16_t) (i - start)};
+					start = i + 1;
+				}
+			}
+			s[n] = {(uint16_t) start, (uint16_t) (text_len - start)};
+		}
+		constexpr const Segment &operator[](size_t i) const { return s[i]; }
+	};
+	static constexpr Segments seg{};
+};
+
+#endif /* SRC_STATUS_JSON_H_ */
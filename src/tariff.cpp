@@ -0,0 +1,155 @@
+/*
+ * tariff.cpp
+ *
+ * The programme walks the day a half hour at a time, keeping for each number of slots heated, number of
+ * runs started and whether the slot is on, the cheapest cost so far. That is 48 x 48 x 8 x 2 states,
+ * each from two others, so a plan is about 70,000 integer compares and adds with no division.
+ * A run can join over midnight with the one at the start of the day, so a second pass forces the first
+ * and last slots on and allows one more run - the cheaper of the two passes is the plan
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#include <cstring>
+#include "energy.h"
+#include "tariff.h"
+
+#define TARIFF_RUNS (TARIFF_WINDOWS + 1) // Runs in a day when the first and last join over midnight
+#define TARIFF_INF INT32_MAX
+
+// Working tables, static rather than on the 2 KB main stack
+// Cheapest cost to the current slot by slots heated, runs started and the slot off (0) or on (1), updated in place
+static int32_t s_cost[TARIFF_SLOTS][TARIFF_RUNS + 1][2];
+// By slot and slots heated, a bit for each runs started and on, set when the state came from the previous slot being on
+static uint16_t s_from_on[TARIFF_SLOTS][TARIFF_SLOTS];
+static_assert((TARIFF_RUNS + 1) * 2 <= 16, "Runs and on must fit in the 16 bit back pointers");
+
+/***
+ * One pass of the programme from midnight to midnight
+ * @param prices per slot, in TARIFF_SCALE units
+ * @param slots half hours to heat, 1 to TARIFF_SLOTS - 1
+ * @param wrap force the first and last slots on, their runs are one window over midnight so one more run is allowed
+ * @param on set to the slots heated
+ * @return the cost, TARIFF_INF if there is no plan
+ */
+static int32_t tariff_pass(const int32_t *prices, uint8_t slots, bool wrap, bool *on) {
+	int runs = wrap ? TARIFF_RUNS : TARIFF_WINDOWS;
+	for (int k = 0; k <= slots; k++)
+		for (int w = 0; w <= runs; w++)
+			s_cost[k][w][0] = s_cost[k][w][1] = TARIFF_INF;
+	if (!wrap)
+		s_cost[0][0][0] = 0;
+	s_cost[1][1][1] = prices[0];
+
+	for (int i = 1; i < TARIFF_SLOTS; i++) {
+		// Downwards, so the row for one slot fewer still holds the previous slot's costs
+		for (int k = slots; k >= 0; k--) {
+			uint16_t from_on = 0;
+			for (int w = runs; w >= 0; w--) {
+				int32_t was_off = s_cost[k][w][0], was_on = s_cost[k][w][1];
+				// Off, after either
+				s_cost[k][w][0] = MG_MIN(was_off, was_on);
+				if (was_on < was_off)
+					from_on |= 1 << (w * 2);
+				// On, carrying on a run or starting one
+				int32_t cost = TARIFF_INF;
+				if (k > 0 && w > 0) {
+					int32_t carry = s_cost[k - 1][w][1], start = s_cost[k - 1][w - 1][0];
+					if (carry <= start)
+						from_on |= 1 << (w * 2 + 1);
+					int32_t best = MG_MIN(carry, start);
+					if (best != TARIFF_INF)
+						cost = best + prices[i];
+				}
+				s_cost[k][w][1] = cost;
+			}
+			s_from_on[i][k] = from_on;
+		}
+	}
+
+	// Cheapest finish, fewest runs on a tie
+	int32_t best = TARIFF_INF;
+	int best_w = 0, best_on = 0;
+	for (int w = 1; w <= runs; w++) {
+		for (int s = wrap ? 1 : 0; s < 2; s++) {
+			if (s_cost[slots][w][s] < best) {
+				best = s_cost[slots][w][s];
+				best_w = w;
+				best_on = s;
+			}
+		}
+	}
+	if (best == TARIFF_INF)
+		return TARIFF_INF;
+
+	// Back from the last slot
+	int k = slots, w = best_w, s = best_on;
+	for (int i = TARIFF_SLOTS - 1; i > 0; i--) {
+		on[i] = s;
+		int prev_on = s_from_on[i][k] >> (w * 2 + s) & 1;
+		if (s) {
+			k--;
+			if (!prev_on)
+				w--;
+		}
+		s = prev_on;
+	}
+	on[0] = s;
+	return best;
+}
+
+/***
+ * Plan the cheapest windows for a day
+ * @param prices TARIFF_SLOTS prices from midnight, in TARIFF_SCALE units
+ * @param slots half hours to heat, below TARIFF_SLOTS as a whole day cannot be one timer
+ * @param plan set to the windows and their cost
+ * @return true if planned
+ */
+bool tariff_plan(const int32_t *prices, uint8_t slots, s_tariff_plan *plan) {
+	uint64_t start = time_us_64();
+	memset(plan, 0, sizeof(*plan));
+	if (slots >= TARIFF_SLOTS)
+		return false;
+	plan->slots = slots;
+	if (slots == 0)
+		return true;
+
+	bool on[TARIFF_SLOTS], on_wrap[TARIFF_SLOTS];
+	plan->cost = tariff_pass(prices, slots, false, on);
+	if (slots >= 2) {
+		int32_t cost = tariff_pass(prices, slots, true, on_wrap);
+		if (cost < plan->cost) {
+			plan->cost = cost;
+			memcpy(on, on_wrap, sizeof(on));
+		}
+	}
+
+	// Windows, starting after an off slot so a run over midnight is one window
+	int first = 0;
+	while (on[first])
+		first++;
+	for (int n = 1; n <= TARIFF_SLOTS; n++) {
+		int i = first + n < TARIFF_SLOTS ? first + n : first + n - TARIFF_SLOTS;
+		int prev = i > 0 ? i - 1 : TARIFF_SLOTS - 1;
+		int next = i < TARIFF_SLOTS - 1 ? i + 1 : 0;
+		if (on[i] && !on[prev])
+			plan->on[plan->windows] = i * TARIFF_SLOT_MIN;
+		if (on[i] && !on[next])
+			plan->off[plan->windows++] = next * TARIFF_SLOT_MIN;
+	}
+	plan->us = time_us_64() - start;
+	return true;
+}
+
+/***
+ * Print a plan as a JSON object, the cost is for element_watts in the unit the prices were given in
+ */
+size_t tariff_print_plan(void (*out)(char, void *), void *arg, va_list *ap) {
+	const s_tariff_plan *plan = va_arg(*ap, const s_tariff_plan *);
+	size_t n = mg_xprintf(out, arg, "{%m: %u, %m: %g, %m: %lu, %m: [", MG_ESC("slots"), plan->slots,
+		MG_ESC("cost"), (double) plan->cost * element_watts / (TARIFF_SCALE * 2000.0), MG_ESC("us"), (unsigned long) plan->us,
+		MG_ESC("windows"));
+	for (int i = 0; i < plan->windows; i++)
+		n += mg_xprintf(out, arg, "%s[%u, %u]", i ? ", " : "", plan->on[i], plan->off[i]);
+	return n + mg_xprintf(out, arg, "]}");
+}
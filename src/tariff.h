@@ -0,0 +1,37 @@
+/*
+ * tariff.h
+ *
+ * Cheapest heating windows for a time-of-use tariff
+ * Given a price for each half hour of the day and the heating time needed, a dynamic programme picks
+ * the cheapest half hours that fit in the six timers, in fixed point with fixed size tables
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#ifndef SRC_TARIFF_H_
+#define SRC_TARIFF_H_
+
+#include <stdarg.h>
+#include "pico/stdlib.h"
+#include "mongoose.h"
+
+#define TARIFF_SLOTS 48 // Half hours in a day
+#define TARIFF_SLOT_MIN 30
+#define TARIFF_WINDOWS 6 // One window per timer
+#define TARIFF_SCALE 1000 // Prices are held in thousandths of the price unit, such as p/kWh
+#define TARIFF_PRICE_MAX 1000 // Largest price accepted either side of zero, so a day's sum fits in 32 bits
+
+// A plan, the windows are in minutes of the day like the timers, an off time before the on time runs over midnight
+struct s_tariff_plan {
+	uint8_t slots; // Half hours heated
+	uint8_t windows;
+	uint16_t on[TARIFF_WINDOWS];
+	uint16_t off[TARIFF_WINDOWS];
+	int32_t cost; // Sum of the prices of the slots heated, in TARIFF_SCALE units
+	uint32_t us; // Time taken to plan
+};
+
+bool tariff_plan(const int32_t *prices, uint8_t slots, s_tariff_plan *plan);
+size_t tariff_print_plan(void (*out)(char, void *), void *arg, va_list *ap);
+
+#endif /* SRC_TARIFF_H_ */
@@ -0,0 +1,343 @@
+/*
+ * tz.cpp
+ *
+ * POSIX TZ parsing and daylight saving changes, all constexpr so the rules are checked while compiling
+ * against known changes and over fifty years of dates (the static_asserts at the end)
+ * A change is kept as the UTC second it happens and the offset from then on. Changes from the year
+ * before to the year after are worked out and sorted, which also covers southern zones where
+ * daylight saving spans the new year
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#include <cstring>
+#include "calendar.h"
+#include "tz.h"
+
+// Date of a change: 'M' month.week.weekday, 'J' day 1-365 never counting 29 February, 'D' day 0-365
+struct s_tz_rule {
+	char kind = 'M';
+	uint8_t month = 0;
+	uint8_t week = 0; // 1-5, 5 is the last in the month
+	uint8_t wday = 0; // 0 Sunday - 6 Saturday
+	uint16_t day = 0;
+	int32_t time = 7200; // Local seconds after midnight, can be negative or beyond a day
+};
+
+struct s_tz_zone {
+	int32_t std_offset = 0; // Seconds east of UTC, the opposite sign to the TZ string
+	int32_t dst_offset = 0;
+	bool has_dst = false;
+	s_tz_rule start; // Given in standard time
+	s_tz_rule end; // Given in daylight saving time
+};
+
+struct s_tz_change {
+	int64_t at; // UTC second the offset changes
+	int32_t offset; // Offset from then on
+};
+
+/*** Read a number of up to max, advancing p */
+static constexpr bool parse_num(const char *&p, int32_t max, int32_t &v) {
+	if (*p < '0' || *p > '9')
+		return false;
+	v = 0;
+	while (*p >= '0' && *p <= '9') {
+		v = v * 10 + (*p++ - '0');
+		if (v > max)
+			return false;
+	}
+	return true;
+}
+
+/*** Read a zone name, three or more letters or anything between < and > */
+static constexpr bool parse_name(const char *&p) {
+	int n = 0;
+	if (*p == '<') {
+		for (p++; *p != 0 && *p != '>'; p++)
+			n++;
+		if (*p++ != '>')
+			return false;
+	} else {
+		for (; (*p >= 'A' && *p <= 'Z') || (*p >= 'a' && *p <= 'z'); p++)
+			n++;
+	}
+	return n >= 3;
+}
+
+/*** Read [+-]hh[:mm[:ss]] as seconds */
+static constexpr bool parse_time(const char *&p, int32_t max_hours, int32_t &secs) {
+	int32_t sign = 1, h = 0, m = 0, s = 0;
+	if (*p == '+' || *p == '-')
+		sign = *p++ == '-' ? -1 : 1;
+	if (!parse_num(p, max_hours, h))
+		return false;
+	if (*p == ':' && !parse_num(++p, 59, m))
+		return false;
+	if (*p == ':' && !parse_num(++p, 59, s))
+		return false;
+	secs = sign * (h * 3600 + m * 60 + s);
+	return true;
+}
+
+/*** Read Jn, n or Mm.w.d with an optional /time */
+static constexpr bool parse_rule(const char *&p, s_tz_rule &r) {
+	int32_t v = 0;
+	if (*p == 'M') {
+		r.kind = 'M';
+		if (!parse_num(++p, 12, v) || v < 1)
+			return false;
+		r.month = v;
+		if (*p != '.' || !parse_num(++p, 5, v) || v < 1)
+			return false;
+		r.week = v;
+		if (*p != '.' || !parse_num(++p, 6, v))
+			return false;
+		r.wday = v;
+	} else if (*p == 'J') {
+		r.kind = 'J';
+		if (!parse_num(++p, 365, v) || v < 1)
+			return false;
+		r.day = v;
+	} else {
+		r.kind = 'D';
+		if (!parse_num(p, 365, v))
+			return false;
+		r.day = v;
+	}
+	r.time = 7200;
+	return *p != '/' || parse_time(++p, 167, r.time);
+}
+
+/***
+ * Parse a POSIX TZ string
+ * Without rules, daylight saving follows the US rules as glibc does
+ * @return false if the string is not valid
+ */
+static constexpr bool tz_parse(const char *spec, s_tz_zone &z) {
+	const char *p = spec;
+	int32_t off = 0;
+	z = s_tz_zone();
+	if (!parse_name(p) || !parse_time(p, 24, off))
+		return false;
+	z.std_offset = -off;
+	if (*p == 0)
+		return true;
+	if (!parse_name(p))
+		return false;
+	z.has_dst = true;
+	z.dst_offset = z.std_offset + 3600;
+	if (*p != ',' && *p != 0) {
+		if (!parse_time(p, 24, off))
+			return false;
+		z.dst_offset = -off;
+	}
+	if (*p == 0) {
+		z.start = {'M', 3, 2, 0, 0, 7200};
+		z.end = {'M', 11, 1, 0, 0, 7200};
+		return true;
+	}
+	if (*p++ != ',' || !parse_rule(p, z.start) || *p++ != ',' || !parse_rule(p, z.end))
+		return false;
+	return *p == 0;
+}
+
+/*** Day from 1970-01-01 a rule falls on in a year */
+static constexpr int32_t rule_day(const s_tz_rule &r, int32_t year) {
+	int32_t jan1 = days_from_civil(year, 1, 1);
+	if (r.kind == 'J')
+		return jan1 + r.day - 1 + (is_leap(year) && r.day >= 60);
+	if (r.kind == 'D')
+		return jan1 + r.day;
+	int32_t first = days_from_civil(year, r.month, 1);
+	int32_t next = r.month == 12 ? days_from_civil(year + 1, 1, 1) : days_from_civil(year, r.month + 1, 1);
+	int32_t d = first + (int32_t) ((r.wday + 7 - weekday(first)) % 7) + (r.week - 1) * 7;
+	while (d >= next)
+		d -= 7;
+	return d;
+}
+
+/***
+ * Changes in the years either side of a year, sorted
+ * @return number of changes, 0 without daylight saving
+ */
+static constexpr int tz_changes(const s_tz_zone &z, int32_t year, s_tz_change (&out)[6]) {
+	if (!z.has_dst)
+		return 0;
+	int n = 0;
+	for (int32_t y = year - 1; y <= year + 1; y++) {
+		s_tz_change add[2] = {
+			{(int64_t) rule_day(z.start, y) * 86400 + z.start.time - z.std_offset, z.dst_offset},
+			{(int64_t) rule_day(z.end, y) * 86400 + z.end.time - z.dst_offset, z.std_offset}
+		};
+		for (const s_tz_change &c : add) {
+			int j = n++;
+			for (; j > 0 && out[j - 1].at > c.at; j--)
+				out[j] = out[j - 1];
+			out[j] = c;
+		}
+	}
+	return n;
+}
+
+/*** Offset at a UTC second, worked out in full */
+static constexpr int32_t tz_offset_at(const s_tz_zone &z, int64_t utc) {
+	s_tz_change changes[6] = {};
+	int n = tz_changes(z, year_from_days((int32_t) (utc / 86400)), changes);
+	int32_t offset = n ? changes[0].offset == z.dst_offset ? z.std_offset : z.dst_offset : z.std_offset;
+	for (int i = 0; i < n && changes[i].at <= utc; i++)
+		offset = changes[i].offset;
+	return offset;
+}
+
+static char s_spec[TZ_MAX_LEN] = TZ_DEFAULT;
+static s_tz_zone s_zone;
+static s_tz_change s_table[TZ_CHANGES]; // Next changes, s_table[s_next] is the first still to come
+static int s_count = 0;
+static int s_next = 0;
+static int64_t s_from = 0; // Earliest UTC the table is valid for
+static int64_t s_until = 0; // UTC the table must be rebuilt at, 0 until built
+static int32_t s_offset = 0;
+static bool s_ready = false;
+
+/***
+ * Work out the offset now and the next changes
+ * Without daylight saving the offset never changes, so the table is never rebuilt. Otherwise it holds
+ * until the end of this year - changes of the years either side are known, and none of the year after
+ * next can come before then
+ * @param utc seconds from epoch
+ */
+static void tz_build(uint32_t utc) {
+	if (!s_ready) {
+		tz_parse(s_spec, s_zone);
+		s_ready = true;
+	}
+	s_count = 0;
+	s_next = 0;
+	if (!s_zone.has_dst) {
+		s_offset = s_zone.std_offset;
+		s_from = 0;
+		s_until = INT64_MAX;
+		return;
+	}
+	int32_t year = year_from_days(utc / 86400);
+	s_tz_change changes[6] = {};
+	int n = tz_changes(s_zone, year, changes);
+	s_offset = tz_offset_at(s_zone, utc);
+	s_from = utc;
+	s_until = (int64_t) days_from_civil(year + 1, 1, 1) * 86400;
+	for (int i = 0; i < n && s_count < TZ_CHANGES; i++)
+		if (changes[i].at > utc)
+			s_table[s_count++] = changes[i];
+	// A full table may not hold every change up to the end of the year
+	if (s_count == TZ_CHANGES && s_table[TZ_CHANGES - 1].at < s_until)
+		s_until = s_table[TZ_CHANGES - 1].at;
+}
+
+/***
+ * Check a TZ string without using it
+ */
+bool tz_valid(const char *spec) {
+	s_tz_zone z;
+	return spec != NULL && strlen(spec) < TZ_MAX_LEN && tz_parse(spec, z);
+}
+
+/***
+ * Use a TZ string, the table is rebuilt on the next conversion
+ * @return false if the string is not valid, the zone is then unchanged
+ */
+bool tz_set(const char *spec) {
+	if (!tz_valid(spec))
+		return false;
+	strcpy(s_spec, spec);
+	tz_parse(s_spec, s_zone);
+	s_ready = true;
+	s_count = s_next = 0;
+	s_until = 0;
+	return true;
+}
+
+const char *tz_get() {
+	return s_spec;
+}
+
+/***
+ * Offset of local time from UTC, called each second
+ * Normally one or two comparisons, the table is rebuilt once a year or if the clock goes back
+ * @param utc seconds from epoch
+ * @return seconds to add to UTC for local time
+ */
+int32_t tz_offset(uint32_t utc) {
+	if (utc >= s_until || utc < s_from)
+		tz_build(utc);
+	while (s_next < s_count && utc >= s_table[s_next].at)
+		s_offset = s_table[s_next++].offset;
+	return s_offset;
+}
+
+// Self checks, evaluated by the compiler
+
+static constexpr s_tz_zone zone(const char *spec) {
+	s_tz_zone z;
+	return tz_parse(spec, z) ? z : s_tz_zone{INT32_MIN};
+}
+
+static constexpr bool parses(const char *spec) {
+	s_tz_zone z;
+	return tz_parse(spec, z);
+}
+
+static_assert(parses("UTC0") && parses("GMT0BST,M3.5.0/1,M10.5.0") && parses("<+0530>-5:30") && parses("EST5EDT") &&
+	parses("AEST-10AEDT,M10.1.0,M4.1.0/3") && parses("<-03>3<-02>,M3.5.0/-2,M10.5.0/-1") && parses("XXX3YYY,J60/25,300/167"), "Valid TZ strings");
+static_assert(!parses("") && !parses("UTC") && !parses("U0") && !parses("GMT0BST,M3.5.0") && !parses("GMT0BST,M13.5.0,M10.5.0") &&
+	!parses("GMT0BST,M3.6.0,M10.5.0") && !parses("GMT0BST,M3.5.7,M10.5.0") && !parses("GMT0BST,M3.5.0,M10.5.0x") && !parses("EST25"),
+	"Invalid TZ strings");
+static_assert(zone("<+0530>-5:30").std_offset == 19800 && zone("EST5EDT").dst_offset == -14400, "Offsets");
+
+// Changes checked against the tz database
+static constexpr s_tz_zone k_uk = zone("GMT0BST,M3.5.0/1,M10.5.0");
+static constexpr s_tz_zone k_us = zone("EST5EDT,M3.2.0,M11.1.0");
+static constexpr s_tz_zone k_au = zone("AEST-10AEDT,M10.1.0,M4.1.0/3");
+static_assert(tz_offset_at(k_uk, 1711846799) == 0 && tz_offset_at(k_uk, 1711846800) == 3600 &&
+	tz_offset_at(k_uk, 1729990799) == 3600 && tz_offset_at(k_uk, 1729990800) == 0, "UK 2024");
+static_assert(tz_offset_at(k_us, 1710053999) == -18000 && tz_offset_at(k_us, 1710054000) == -14400 &&
+	tz_offset_at(k_us, 1730613599) == -14400 && tz_offset_at(k_us, 1730613600) == -18000, "US 2024");
+static_assert(tz_offset_at(k_au, 1712419199) == 39600 && tz_offset_at(k_au, 1712419200) == 36000 &&
+	tz_offset_at(k_au, 1728143999) == 36000 && tz_offset_at(k_au, 1728144000) == 39600 && tz_offset_at(k_au, 1735689600) == 39600, "Sydney 2024");
+
+/***
+ * Check every change from 2000 to 2049 falls on the right Sunday at the right local time, the skipped
+ * hour is skipped and the repeated hour repeats
+ * @param first_start,last_start range of day of month the start can fall on, likewise for the end
+ */
+static constexpr bool check_years(const s_tz_zone &z, uint32_t start_month, uint32_t first_start, uint32_t last_start,
+		uint32_t end_month, uint32_t first_end, uint32_t last_end) {
+	for (int32_t y = 2000; y < 2050; y++) {
+		s_tz_change c[6] = {};
+		if (tz_changes(z, y, c) != 6)
+			return false;
+		for (int i = 2; i < 4; i++) {
+			int64_t at = c[i].at;
+			int32_t before = tz_offset_at(z, at - 1), after = tz_offset_at(z, at);
+			bool start = after == z.dst_offset;
+			int32_t local_day = (int32_t) ((at + after) / 86400);
+			// Day of month, found by counting forward from the first of the month
+			uint32_t month = start ? start_month : end_month;
+			int32_t dom = local_day - days_from_civil(y, month, 1) + 1;
+			if (year_from_days(local_day) != y || weekday(local_day) != 0 || before == after)
+				return false;
+			if (dom < (int32_t) (start ? first_start : first_end) || dom > (int32_t) (start ? last_start : last_end))
+				return false;
+			// Local time jumps forward an hour at the start, and back an hour at the end
+			if ((at + after) - (at - 1 + before) != (start ? 3601 : -3599))
+				return false;
+			// Local clock time of the change matches the rule
+			if ((at + before) % 86400 != (start ? z.start.time : z.end.time))
+				return false;
+		}
+	}
+	return true;
+}
+static_assert(check_years(k_uk, 3, 25, 31, 10, 25, 31), "UK 2000-2049");
+static_assert(check_years(k_us, 3, 8, 14, 11, 1, 7), "US 2000-2049");
+static_assert(check_years(k_au, 10, 1, 7, 4, 1, 7), "Sydney 2000-2049");
@@ -0,0 +1,27 @@
+/*
+ * tz.h
+ *
+ * Local time from a POSIX TZ string, such as GMT0BST,M3.5.0/1,M10.5.0
+ * The next few daylight saving changes are worked out once, so each conversion from UTC is a
+ * comparison against the next change and an add
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#ifndef SRC_TZ_H_
+#define SRC_TZ_H_
+
+#include <stdint.h>
+
+#ifndef TZ_DEFAULT
+#define TZ_DEFAULT "UTC0" // Time zone until one is configured, the schedule runs on UTC
+#endif
+#define TZ_MAX_LEN 48 // Longest TZ string accepted, including the terminator
+#define TZ_CHANGES 4 // Daylight saving changes worked out at a time, two years for most zones
+
+bool tz_valid(const char *spec);
+bool tz_set(const char *spec);
+const char *tz_get();
+int32_t tz_offset(uint32_t utc);
+
+#endif /* SRC_TZ_H_ */
@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+"""
+Decode tokenised log output back into text
+
+Reads USB serial output or a /logs stream from stdin or a file, lines starting with $ are base64 binary frames
+and are expanded with the dictionary from the build, any other line is passed through unchanged
+"""
+
+import argparse
+import base64
+import binascii
+import csv
+import re
+import sys
+
+LEVELS = {1: 'E', 2: 'I', 3: 'D', 4: 'V'}
+SPEC = re.compile(r'%(0?)(\d*)l*([diuxXcs%])')
+
+
+def load_dictionary(path):
+    with open(path, newline='', encoding='utf-8') as f:
+        return {int(row['token'], 16): row['format'] for row in csv.DictReader(f)}
+
+
+def varint(data, pos):
+    value = shift = 0
+    while True:
+        b = data[pos]
+        pos += 1
+        value |= (b & 0x7F) << shift
+        shift += 7
+        if b < 0x80:
+            return value, pos
+
+
+def format_entry(fmt, args, text):
+    """Same conversions as ring_log_format in the firmware"""
+    it = iter(args)
+
+    def conv(m):
+        zero, width, c = m.groups()
+        if c == '%':
+            return '%'
+        if c == 's':
+            s = text
+        else:
+            v = next(it, 0)
+            if c in 'di':
+                s = str(v - (1 << 32) if v & 0x80000000 else v)
+            elif c == 'u':
+                s = str(v)
+            elif c == 'x':
+                s = f'{v:x}'
+            elif c == 'X':
+                s = f'{v:X}'
+            else:
+                s = chr(v & 0xFF)
+        return s.rjust(int(width or 0), '0' if zero and c != 's' else ' ')
+
+    return SPEC.sub(conv, fmt)
+
+
+def decode_line(line, dictionary):
+    try:
+        data = base64.b64decode(line[1:], validate=True)
+    except binascii.Error:
+        return line
+    token = int.from_bytes(data[:4], 'little')
+    pos = 4
+    time_ms, pos = varint(data, pos)
+    level, pos = varint(data, pos)
+    nargs, pos = varint(data, pos)
+    args = []
+    for _ in range(nargs):
+        v, pos = varint(data, pos)
+        args.append(v)
+    text_len, pos = varint(data, pos)
+    text = data[pos:pos + text_len].decode('utf-8', 'replace')
+    fmt = dictionary.get(token)
+    if fmt is None:
+        body = f'<unknown token {token:08x}> {args} {text!r}'
+    else:
+        body = format_entry(fmt, args, text)
+    return f'{time_ms // 1000}.{time_ms % 1000:03d} {LEVELS.get(level, "?")} {body}'
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__)
+    ap.add_argument('-d', '--dictionary', required=True, help='CSV written by log_dictionary.py')
+    ap.add_argument('input', nargs='?', type=argparse.FileType('r', errors='replace'), default=sys.stdin)
+    args = ap.parse_args()
+
+    dictionary = load_dictionary(args.dictionary)
+    for line in args.input:
+        line = line.rstrip('\r\n')
+        if line.startswith('$'):
+            line = decode_line(line, dictionary)
+        print(line, flush=True)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+"""
+Build the token dictionary for tokenised logging
+
+Scans sources for RLOG_ERROR/INFO/DEBUG calls and writes a CSV of token, level, format string and location
+The token is the same FNV-1a hash ring_log.h computes at compile time
+"""
+
+import argparse
+import csv
+import re
+import sys
+
+CALL = re.compile(r'\bRLOG_(ERROR|INFO|DEBUG)\(\s*"((?:[^"\\\n]|\\.)*)"')
+ESCAPES = {'n': '\n', 't': '\t', 'r': '\r', '\\': '\\', '"': '"', "'": "'", '0': '\0'}
+
+
+def unescape(s):
+    return re.sub(r'\\(.)', lambda m: ESCAPES.get(m.group(1), m.group(1)), s)
+
+
+def fnv1a(s):
+    h = 2166136261
+    for b in s.encode():
+        h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__)
+    ap.add_argument('-o', '--output', required=True)
+    ap.add_argument('sources', nargs='+')
+    args = ap.parse_args()
+
+    entries = {}
+    for path in args.sources:
+        if not path.endswith(('.c', '.cpp', '.h')):
+            continue
+        with open(path, encoding='utf-8') as f:
+            text = f.read()
+        for m in CALL.finditer(text):
+            fmt = unescape(m.group(2))
+            token = fnv1a(fmt)
+            line = text.count('\n', 0, m.start()) + 1
+            if token in entries and entries[token][1] != fmt:
+                sys.exit(f'{path}:{line}: token {token:08x} collides with "{entries[token][1]}"')
+            entries.setdefault(token, (m.group(1), fmt, f'{path}:{line}'))
+
+    with open(args.output, 'w', newline='', encoding='utf-8') as f:
+        w = csv.writer(f)
+        w.writerow(['token', 'level', 'format', 'location'])
+        for token, (level, fmt, loc) in sorted(entries.items()):
+            w.writerow([f'{token:08x}', level, fmt, loc])
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,389 @@
+/*
+ * mem_pool_soak.cpp
+ *
+ * Host soak test for src/mem_pool.cpp, built outside the Pico CMake:
+ *   g++ -std=c++17 -O2 -Itools/mem_pool_soak -Isrc tools/mem_pool_soak/mem_pool_soak.cpp -o mem_pool_soak && ./mem_pool_soak
+ * Connections open and close a million times, with up to the admission limits open at once. Each reads a
+ * request and then becomes an /api reply, a parked long-poll, a history export, a static file download, a
+ * websocket, an event stream or a /logs stream, allocating the way Mongoose and main.cpp do - connection,
+ * then receive and send buffers grown with mg_iobuf_resize(), file handles for downloads, idle buffers
+ * freed, and everything freed on close. Slow clients leave data queued, and streams skip a frame while one
+ * is still queued, as status_publish() does.
+ * The firmware's timers and listener are held throughout, and an SNTP client comes and goes.
+ * One random sequence runs through the whole soak. Traffic is split into periods that end with every
+ * connection closed, when every block must be back. Over the whole soak every pool must be used and must
+ * peak within its count, never falling back to the heap
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// mem_pool.cpp logs through the ring log, which needs the Pico, errors here are counted instead
+#define SRC_RING_LOG_H_
+static uint32_t s_log_errors = 0;
+#define RLOG_ERROR(fmt, ...) (s_log_errors++)
+
+#include "admission.h"
+#include "../../src/mem_pool.cpp"
+
+#define SOAK_CYCLES 1000000 // Connections opened and closed
+#define SOAK_PERIOD 10000 // Connections in each period, all closed at its end
+#define SOAK_SEED 2463534242u
+#define SOAK_STATUS_MIN 240 // Status JSON with small values
+#define SOAK_STATUS_MAX 505 // k_status_json.max_len, every field at its longest
+#define SOAK_SSE_FRAME 31 // id and data lines and the blank line, within SSE_FRAME_MAX
+#define SOAK_WS_FRAME 4 // Websocket header for a payload of 126 to 65535 bytes
+#define SOAK_TIMERS 8 // mg_timer_add() calls in main()
+#define SOAK_TIMER_SIZE 40 // struct mg_timer on the Pico
+#define SOAK_SEND_MAX 1024 // EXPORT_MAX_SEND and LOG_HTTP_MAX_SEND, where exports and /logs stop formatting
+
+static uint64_t s_now = 0;
+
+uint64_t mg_millis(void) {
+	return s_now;
+}
+
+int mg_iobuf_resize(struct mg_iobuf *io, size_t new_size) {
+	if (io->align > 0)
+		new_size = (new_size + io->align - 1) / io->align * io->align;
+	if (new_size == 0) {
+		mg_free(io->buf);
+		io->buf = NULL;
+		io->len = io->size = 0;
+	} else if (new_size != io->size) {
+		void *p = mg_calloc(1, new_size);
+		if (p == NULL)
+			return 0;
+		size_t len = MG_MIN(new_size, io->len);
+		if (len > 0)
+			memmove(p, io->buf, len);
+		mg_free(io->buf);
+		io->buf = (unsigned char *) p;
+		io->size = new_size;
+	}
+	return 1;
+}
+
+size_t mg_xprintf(void (*fn)(char, void *), void *arg, const char *fmt, ...) {
+	(void) fn, (void) arg, (void) fmt;
+	return 0;
+}
+
+size_t mg_print_esc(void (*fn)(char, void *), void *arg, va_list *ap) {
+	(void) fn, (void) arg, (void) ap;
+	return 0;
+}
+
+static uint32_t s_rand = SOAK_SEED;
+
+static uint32_t rnd(uint32_t n) {
+	s_rand ^= s_rand << 13;
+	s_rand ^= s_rand >> 17;
+	s_rand ^= s_rand << 5;
+	return s_rand % n;
+}
+
+// What a connection turns into once its request is read
+enum sim_kind {
+	SIM_REQUEST, // Still reading the request
+	SIM_API, // /api action, one reply
+	SIM_POLL, // /api/poll, parked then one status reply
+	SIM_HISTORY, // /api/history, chunks while the send buffer has room
+	SIM_STATIC, // File download, a send window at a time
+	SIM_WS, // Websocket, a frame per status change
+	SIM_SSE, // /events, an event per status change and heartbeats
+	SIM_LOGS, // /logs, chunks while the send buffer has room
+	SIM_KINDS
+};
+
+// Admission class for each kind, as classify() sets it
+static const conn_class k_class[SIM_KINDS] = {CONN_CLASSES, CONN_API, CONN_API, CONN_API, CONN_STATIC,
+	CONN_STREAM, CONN_STREAM, CONN_STREAM};
+static const int k_class_limit[CONN_CLASSES] = {MAX_CONN_STATIC, MAX_CONN_API, MAX_CONN_STREAM};
+
+struct s_sim {
+	struct mg_connection *c;
+	sim_kind kind;
+	uint32_t left; // Bytes of request still to read, then steps of work still to do
+	uint32_t idle; // Polls left as an idle keep-alive once the work is done
+	void *file[2]; // mg_fd and the packed file behind it, while a download is open
+};
+
+static s_sim s_conns[MAX_CONNECTIONS];
+static int s_open = 0;
+static struct mg_connection *s_sntp = NULL;
+
+static void io_add(struct mg_connection *c, struct mg_iobuf *io, size_t n, int ev) {
+	if (io->size - io->len < n && !mg_iobuf_resize(io, io->len + n)) {
+		fprintf(stderr, "Buffer allocation failed\n");
+		exit(1);
+	}
+	io->len += n;
+	io_buffers_event(c, ev);
+}
+
+/***
+ * Send some of what is queued, a slow client takes only part or none of it
+ */
+static void io_drain(struct mg_connection *c) {
+	uint32_t r = rnd(4);
+	c->send.len = r == 0 ? c->send.len : r == 1 ? c->send.len / 2 : 0;
+}
+
+/***
+ * @return true if a class has as many busy connections as it is allowed, parked long-polls are not busy
+ */
+static bool class_full(conn_class cls) {
+	int n = 0;
+	for (int i = 0; i < s_open; i++)
+		n += k_class[s_conns[i].kind] == cls && s_conns[i].kind != SIM_POLL && s_conns[i].left > 0;
+	return n >= k_class_limit[cls];
+}
+
+static uint32_t status_len() {
+	return SOAK_STATUS_MIN + rnd(SOAK_STATUS_MAX - SOAK_STATUS_MIN + 1);
+}
+
+static void sim_open() {
+	s_sim *s = &s_conns[s_open++];
+	s->c = (struct mg_connection *) mg_calloc(1, sizeof(struct mg_connection));
+	s->c->is_accepted = 1;
+	s->kind = SIM_REQUEST;
+	s->left = 250 + rnd(550); // Browser request headers, or an /api POST
+	s->idle = 0;
+	s->file[0] = s->file[1] = NULL;
+	io_buffers_event(s->c, MG_EV_ACCEPT);
+}
+
+static void sim_close(int i) {
+	s_sim *s = &s_conns[i];
+	mg_free(s->file[0]);
+	mg_free(s->file[1]);
+	mg_iobuf_resize(&s->c->recv, 0);
+	mg_iobuf_resize(&s->c->send, 0);
+	mg_free(s->c);
+	s_conns[i] = s_conns[--s_open];
+}
+
+/***
+ * Start the work for a request that has been read, as the handler in main.cpp does
+ * @return false if it was turned away and closed
+ */
+static bool sim_start(int i) {
+	s_sim *s = &s_conns[i];
+	struct mg_connection *c = s->c;
+	c->recv.len = 0;
+	static const sim_kind k_mix[16] = {SIM_API, SIM_API, SIM_API, SIM_API, SIM_API, SIM_POLL, SIM_POLL, SIM_HISTORY,
+		SIM_STATIC, SIM_STATIC, SIM_STATIC, SIM_STATIC, SIM_WS, SIM_WS, SIM_SSE, SIM_LOGS};
+	sim_kind kind = k_mix[rnd(16)];
+	if (class_full(k_class[kind])) {
+		// Over the class limit, a 503 and close
+		io_add(c, &c->send, 60, MG_EV_WRITE);
+		sim_close(i);
+		return false;
+	}
+	s->kind = kind;
+	s->idle = rnd(30);
+	switch (kind) {
+	case SIM_API:
+		// Most replies are short, get_stats and get_history run to a send window
+		io_add(c, &c->send, rnd(16) ? 80 + rnd(600) : 1000 + rnd(1000), MG_EV_WRITE);
+		s->left = 1;
+		break;
+	case SIM_POLL:
+		s->left = 1 + rnd(40);
+		break;
+	case SIM_HISTORY:
+		io_buffers_role(c, IO_ROLE_STATIC);
+		io_add(c, &c->send, 120, MG_EV_WRITE);
+		s->left = 1 + rnd(20);
+		break;
+	case SIM_STATIC:
+		io_buffers_role(c, IO_ROLE_STATIC);
+		s->file[0] = mg_calloc(1, 2 * sizeof(void *));
+		s->file[1] = mg_calloc(1, 3 * sizeof(size_t));
+		io_add(c, &c->send, 200, MG_EV_WRITE);
+		s->left = 1 + rnd(12);
+		break;
+	case SIM_WS:
+		// The upgrade reply goes out before the role is set, then the first frame
+		io_add(c, &c->send, 129, MG_EV_WRITE);
+		io_buffers_role(c, IO_ROLE_STREAM);
+		io_add(c, &c->send, SOAK_WS_FRAME + status_len(), MG_EV_WRITE);
+		s->left = 1 + rnd(40);
+		s->idle = 0;
+		break;
+	case SIM_SSE:
+		// Role first, then the headers, retry and first event
+		io_buffers_role(c, IO_ROLE_STREAM);
+		io_add(c, &c->send, 96 + 13 + SOAK_SSE_FRAME + status_len(), MG_EV_WRITE);
+		s->left = 1 + rnd(40);
+		s->idle = 0;
+		break;
+	case SIM_LOGS:
+		io_add(c, &c->send, 110, MG_EV_WRITE);
+		io_buffers_role(c, IO_ROLE_STREAM);
+		s->left = 1 + rnd(40);
+		s->idle = 0;
+		break;
+	default:
+		break;
+	}
+	io_drain(c);
+	return true;
+}
+
+/***
+ * Move one connection on a step
+ * @return false once it has closed
+ */
+static bool sim_step(int i) {
+	s_sim *s = &s_conns[i];
+	struct mg_connection *c = s->c;
+	if (s->kind == SIM_REQUEST) {
+		// Request segments of up to an MSS
+		uint32_t n = MG_MIN(s->left, 536u);
+		io_add(c, &c->recv, n, MG_EV_READ);
+		s->left -= n;
+		return s->left > 0 || sim_start(i);
+	}
+	if (s->left > 0) {
+		switch (s->kind) {
+		case SIM_POLL:
+			// Parked until the status changes, then the header and JSON
+			if (s->left == 1)
+				io_add(c, &c->send, 160 + status_len(), MG_EV_WRITE);
+			break;
+		case SIM_HISTORY:
+		case SIM_LOGS:
+			// Chunks of up to a line buffer while less than SOAK_SEND_MAX is waiting
+			while (c->send.len < SOAK_SEND_MAX)
+				io_add(c, &c->send, s->kind == SIM_LOGS ? 40 + rnd(100) : 8 + rnd(256), MG_EV_WRITE);
+			break;
+		case SIM_STATIC:
+			// A send window at a time, as mg_http_serve_file does
+			if (c->send.size < MG_IO_SIZE)
+				mg_iobuf_resize(&c->send, MG_IO_SIZE);
+			c->send.len = c->send.size;
+			io_buffers_event(c, MG_EV_WRITE);
+			break;
+		case SIM_WS:
+			// A status frame unless the last is still queued, and now and then a ping from the browser
+			if (c->send.len == 0)
+				io_add(c, &c->send, SOAK_WS_FRAME + status_len(), MG_EV_WRITE);
+			if (rnd(8) == 0) {
+				io_add(c, &c->recv, 6 + rnd(20), MG_EV_READ);
+				c->recv.len = 0;
+			}
+			break;
+		case SIM_SSE:
+			// An event or a heartbeat comment, unless the last is still queued
+			if (c->send.len == 0)
+				io_add(c, &c->send, rnd(4) ? SOAK_SSE_FRAME + status_len() : 6, MG_EV_WRITE);
+			break;
+		default:
+			break;
+		}
+		io_drain(c);
+		if (--s->left == 0) {
+			if (s->kind == SIM_STATIC) {
+				mg_free(s->file[0]);
+				mg_free(s->file[1]);
+				s->file[0] = s->file[1] = NULL;
+			}
+			c->send.len = 0;
+		}
+		return true;
+	}
+	if (s->idle > 0) {
+		s->idle--;
+		return true;
+	}
+	sim_close(i);
+	return false;
+}
+
+static void sntp_close() {
+	mg_iobuf_resize(&s_sntp->recv, 0);
+	mg_iobuf_resize(&s_sntp->send, 0);
+	mg_free(s_sntp);
+	s_sntp = NULL;
+}
+
+/***
+ * An SNTP exchange now and then, a client connection with Mongoose's default buffer step
+ */
+static void sim_sntp() {
+	if (s_sntp == NULL) {
+		if (rnd(500) != 0)
+			return;
+		s_sntp = (struct mg_connection *) mg_calloc(1, sizeof(struct mg_connection));
+		s_sntp->recv.align = s_sntp->send.align = MG_IO_SIZE;
+		io_add(s_sntp, &s_sntp->send, 48, MG_EV_WRITE);
+		s_sntp->send.len = 0;
+	} else if (rnd(20) == 0) {
+		io_add(s_sntp, &s_sntp->recv, 48, MG_EV_READ);
+		sntp_close();
+	}
+}
+
+/***
+ * Run one period of traffic, then close everything
+ */
+static void soak_period() {
+	for (uint32_t closed = 0; closed < SOAK_PERIOD;) {
+		if (s_open < MAX_CONNECTIONS && (s_open == 0 || rnd(3) == 0))
+			sim_open();
+		if (!sim_step((int) rnd(s_open)))
+			closed++;
+		sim_sntp();
+		// Time passes and every connection is polled, which frees idle buffers
+		s_now += rnd(200);
+		for (int j = 0; j < s_open; j++)
+			io_buffers_event(s_conns[j].c, MG_EV_POLL);
+	}
+	while (s_open > 0)
+		sim_close(s_open - 1);
+	if (s_sntp != NULL)
+		sntp_close();
+}
+
+int main() {
+	// Held for the life of the firmware
+	void *timers[SOAK_TIMERS];
+	for (int i = 0; i < SOAK_TIMERS; i++)
+		timers[i] = mg_calloc(1, SOAK_TIMER_SIZE);
+	struct mg_connection *listener = (struct mg_connection *) mg_calloc(1, sizeof(struct mg_connection));
+	uint16_t base[k_pools];
+	for (int i = 0; i < k_pools; i++)
+		base[i] = s_pools[i].in_use;
+
+	bool ok = true;
+	for (uint32_t p = 0; p < SOAK_CYCLES / SOAK_PERIOD && ok; p++) {
+		soak_period();
+		bool back = s_heap_allocs == 0;
+		for (int i = 0; i < k_pools; i++)
+			back = back && s_pools[i].in_use == base[i];
+		if (!back) {
+			printf("Blocks still held at the end of period %u\n", p);
+			ok = false;
+		}
+	}
+	for (int i = 0; i < k_pools; i++) {
+		bool fits = s_pools[i].peak > 0 && s_pools[i].peak <= s_pools[i].count && s_pools[i].fallback == 0;
+		printf("pool %4u x %2u: peak %2u, fallbacks %u%s\n", s_pools[i].size, s_pools[i].count, s_pools[i].peak,
+			s_pools[i].fallback, s_pools[i].peak == 0 ? ", unused" : fits ? "" : ", too small");
+		ok = ok && fits;
+	}
+	printf("heap failures %u, log errors %u\n", s_heap_failures, s_log_errors);
+	ok = ok && s_heap_failures == 0 && s_log_errors == 0;
+	printf("%u cycles: %s\n", SOAK_CYCLES, ok ? "PASS" : "FAIL");
+
+	mg_free(listener);
+	for (int i = 0; i < SOAK_TIMERS; i++)
+		mg_free(timers[i]);
+	return ok ? 0 : 1;
+}
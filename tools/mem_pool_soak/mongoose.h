@@ -0,0 +1,49 @@
+/*
+ * mongoose.h
+ *
+ * The few Mongoose 7.20 declarations src/mem_pool.cpp needs, for building it on the host with mem_pool_soak.cpp
+ * mg_iobuf_resize() follows Mongoose: the new block is allocated and filled before the old one is freed
+ *  Created on: October 2026
+ *      Author: electro-dan
+ */
+
+#ifndef TOOLS_MEM_POOL_SOAK_MONGOOSE_H_
+#define TOOLS_MEM_POOL_SOAK_MONGOOSE_H_
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define MG_IO_SIZE 2048 // As port/mongoose/mongoose_config.h
+#define MG_DATA_SIZE 32
+#define MG_MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MG_LL_ERROR 1
+
+enum { MG_EV_ERROR, MG_EV_OPEN, MG_EV_POLL, MG_EV_RESOLVE, MG_EV_CONNECT, MG_EV_ACCEPT, MG_EV_TLS_HS, MG_EV_READ,
+	MG_EV_WRITE, MG_EV_CLOSE };
+
+struct mg_iobuf {
+	unsigned char *buf;
+	size_t size, len, align;
+};
+
+// Padded to the size of the real struct on the Pico, so connections take the same pool class
+struct mg_connection {
+	struct mg_connection *next;
+	struct mg_iobuf recv, send;
+	char data[MG_DATA_SIZE];
+	unsigned is_accepted : 1;
+	uint8_t rest[160];
+};
+
+void *mg_calloc(size_t count, size_t size);
+void mg_free(void *ptr);
+uint64_t mg_millis(void);
+int mg_iobuf_resize(struct mg_iobuf *io, size_t new_size);
+size_t mg_xprintf(void (*fn)(char, void *), void *arg, const char *fmt, ...);
+size_t mg_print_esc(void (*fn)(char, void *), void *arg, va_list *ap);
+#define MG_ESC(str) mg_print_esc, 0, (str)
+
+#endif /* TOOLS_MEM_POOL_SOAK_MONGOOSE_H_ */
@@ -1,4 +1,5 @@
 var isChanging = false; // Used to prevent SSE updating controls when being edited
+var lastTimers = []; // Timers in the last status, the others are sent unchanged when one timer is saved
 var ws; // WebSocket
 var wsRetryAttempts = 0;
 var overlay = document.getElementById('overlay');
@@ -81,11 +82,13 @@ function updateStatus(strRequest) {
     console.log(json_response);
 
     if (json_response.status == "OK") {
+        lastTimers = json_response.timers;
         var dayOfWeek = ["Mon", "Tue", "Wed", "Thu", "Fri", "Sat", "Sun"];
-        document.getElementById("localTime").innerHTML = dayOfWeek[json_response.current_day - 1] + " " + formatTime(json_response.current_time) + " UTC";
+        document.getElementById("localTime").innerHTML = dayOfWeek[json_response.current_day - 1] + " " + formatTime(json_response.current_time);
         document.getElementById("boostTimer").innerHTML = formatCountdown(json_response.boost_timer_countdown);
         document.getElementById("heatingState").innerHTML = (json_response.heating_state ? "ENABLED" : "DISABLED");
         document.getElementById("isHeating").innerHTML = (json_response.is_heating ? "ON" : "OFF");
+        document.getElementById("energyToday").innerHTML = (json_response.energy_today_wh / 1000).toFixed(2);
         if (!isChanging) {
             const timerArr = json_response.timers;
             var timer = 1;
@@ -217,27 +220,14 @@ function editTimer(timer) {
             daysTest <<= 1; // Shift bit left in the test byte
         }
 
-        // Apply the changes
-        const jsonData = {
-            "action": "set_timer",
-            "timer_number": timer,
-            "new_days": newDays,
-            "new_on_time": +document.getElementById("t" + timer + "OnInput").value,
-            "new_off_time": +document.getElementById("t" + timer + "OffInput").value
-        };
-        // Post back to the python service
-        const xhttp = new XMLHttpRequest();
-        xhttp.onload = function() {
-            var json_response = JSON.parse(this.responseText);
-            console.log(json_response);
-
-            if (json_response.status != "OK") {
-                alert("Error setting timer: " + json_response.message);
-            }
+        // Apply the changes as one set_config, with the other timers as they were in the last status
+        if (lastTimers.length != 6) {
+            alert("Error setting timer: the timers have not been loaded yet");
+            return;
         }
-        xhttp.open("POST", "/api", true);
-        xhttp.setRequestHeader("Content-Type", "application/json;charset=UTF-8");
-        xhttp.send(JSON.stringify(jsonData));
+        const timerArr = lastTimers.map(function(t) { return t.slice(); });
+        timerArr[timer - 1] = [newDays, +document.getElementById("t" + timer + "OnInput").value, +document.getElementById("t" + timer + "OffInput").value];
+        setConfig({ "timers": timerArr });
 
         // Disable controls
         toggleControlsDisabled(timer, true);
@@ -250,6 +240,44 @@ function editTimer(timer) {
     }
 }
 
+// Copy one timer's days and on/off times to every timer, applied in a single request
+function copyTimerToAll(timer) {
+    if (!confirm("Copy timer " + timer + " to all timers?"))
+        return;
+    var newDays = 0;
+    var daysTest = 1;
+    // Loop from 1 to 7 - 1 = Monday
+    for (var i = 1; i < 8; i++) {
+        // If the day is checked, add on the test byte
+        if (document.getElementById("t" + timer + "Day" + i).checked)
+            newDays += daysTest;
+        daysTest <<= 1; // Shift bit left in the test byte
+    }
+    const timerArr = [];
+    for (var i = 0; i < 6; i++) {
+        timerArr.push([newDays, +document.getElementById("t" + timer + "OnInput").value, +document.getElementById("t" + timer + "OffInput").value]);
+    }
+    setConfig({ "timers": timerArr });
+}
+
+// Bulk change of timers, heating state and boost settings - any field can be left out
+function setConfig(config) {
+    const jsonData = Object.assign({ "action": "set_config" }, config);
+    // Post back to the python service
+    const xhttp = new XMLHttpRequest();
+    xhttp.onload = function() {
+        var json_response = JSON.parse(this.responseText);
+        console.log(json_response);
+
+        if (json_response.status != "OK") {
+            alert("Error setting configuration: " + json_response.message);
+        }
+    }
+    xhttp.open("POST", "/api", true);
+    xhttp.setRequestHeader("Content-Type", "application/json;charset=UTF-8");
+    xhttp.send(JSON.stringify(jsonData));
+}
+
 function cancelTimer(timer) {
     // Disable controls
     toggleControlsDisabled(timer, true);